@@ -0,0 +1,671 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+// Purpose: this file contains a C++ main procedure to run the benchmark
+// suite. Each case generates a parametrized model directly in the Domain,
+// no interpreter involved, and runs a static analysis of it with each of
+// the chosen linear solvers:
+//
+//      frame   2d RC frame of ForceBeamColumn2d elements with fiber sections,
+//              gravity followed by a displacement controlled pushover
+//      soil    3d soil column of Brick elements with PressureDependMultiYield,
+//              elastic gravity followed by a plastic surcharge
+//      shell   building of ShellMITC4 floor slabs and perimeter walls,
+//              gravity followed by lateral load
+//      truss   3d lattice of Truss elements with Steel01, vertical load
+//              followed by a displacement controlled lateral push
+//
+// For every case and solver one line of JSON is appended to the output
+// file holding the model size, the build and analysis wall times and the
+// phase times of the PhaseProfiler, so results can be compared across
+// commits. The models are deterministic, two runs on the same machine
+// do the same work.
+//
+// With -load numElements the truss lattice is instead sized to at least
+// numElements elements, saved with saveModel() and read back with
+// loadModel() into a new domain; the line written holds the build, save
+// and load wall times and the size of the model file. The target for the
+// model file is 10^6 elements loaded in seconds, the default of -load.
+//
+//      bench <-case frame|soil|shell|truss|all>
+//            <-solver ProfileSPD|BandGen|SparseGEN|Umfpack|all>
+//            <-size n> <-steps n> <-out file> <-label string>
+//      bench -load <numElements> <-out file> <-label string>
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <OPS_Globals.h>
+#include <StandardStream.h>
+#include <PhaseProfiler.h>
+#include <ModelFile.h>
+#include <FEM_ObjectBrokerAllClasses.h>
+
+// includes for the domain classes
+#include <Domain.h>
+#include <Node.h>
+#include <SP_Constraint.h>
+#include <LoadPattern.h>
+#include <LinearSeries.h>
+#include <NodalLoad.h>
+#include <Information.h>
+
+#include <ForceBeamColumn2d.h>
+#include <LobattoBeamIntegration.h>
+#include <LinearCrdTransf2d.h>
+#include <FiberSection2d.h>
+#include <UniaxialFiber2d.h>
+#include <Concrete01.h>
+#include <Steel01.h>
+#include <Brick.h>
+#include <PressureDependMultiYield.h>
+#include <ShellMITC4.h>
+#include <ElasticMembranePlateSection.h>
+#include <Truss.h>
+
+// includes for the analysis classes
+#include <StaticAnalysis.h>
+#include <AnalysisModel.h>
+#include <NewtonRaphson.h>
+#include <CTestNormDispIncr.h>
+#include <PlainHandler.h>
+#include <DOF_Numberer.h>
+#include <RCM.h>
+#include <LoadControl.h>
+#include <DisplacementControl.h>
+#include <ProfileSPDLinSOE.h>
+#include <ProfileSPDLinDirectSolver.h>
+#include <BandGenLinSOE.h>
+#include <BandGenLinLapackSolver.h>
+#include <SparseGenColLinSOE.h>
+#include <SuperLU.h>
+#include <UmfpackGenLinSOE.h>
+#include <UmfpackGenLinSolver.h>
+
+// init the global variabled defined in OPS_Globals.h
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+double        ops_Dt = 0;
+Domain       *ops_TheActiveDomain = 0;
+Element      *ops_TheActiveElement = 0;
+
+static const char *caseNames[] = {"frame", "soil", "shell", "truss"};
+static const int defaultSizes[] = {10, 40, 5, 6};
+static const int numCases = 4;
+
+static const char *solverNames[] = {"ProfileSPD", "BandGen", "SparseGEN", "Umfpack"};
+static const int numSolvers = 4;
+
+// what a case asks of the second stage of the analysis: a displacement
+// controlled push of controlNode, or if controlNode is 0 load control
+struct BenchControl {
+  int controlNode;
+  int controlDof;
+  double controlDisp;
+  UniaxialMaterial *theUniaxial;
+  NDMaterial *theNDMaterial;
+};
+
+static double
+elapsed(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void
+fix(Domain &theDomain, int nodeTag, int numDOF)
+{
+  for (int i=0; i<numDOF; i++)
+    theDomain.addSP_Constraint(new SP_Constraint(nodeTag, i, 0.0, true));
+}
+
+static int numLoads = 0;
+
+static void
+addLoad(Domain &theDomain, int pattern, int nodeTag, int numDOF, int dof, double value)
+{
+  Vector theLoad(numDOF);
+  theLoad(dof) = value;
+  theDomain.addNodalLoad(new NodalLoad(++numLoads, nodeTag, theLoad), pattern);
+}
+
+static void
+addPatterns(Domain &theDomain)
+{
+  for (int i=1; i<=2; i++) {
+    LoadPattern *thePattern = new LoadPattern(i);
+    thePattern->setTimeSeries(new LinearSeries());
+    theDomain.addLoadPattern(thePattern);
+  }
+}
+
+//
+// frame: size bays and size stories, 6m bays, 3.5m stories
+//
+
+static void
+buildFrame(Domain &theDomain, int size, BenchControl &theControl)
+{
+  int numBays = size;
+  int numStories = size;
+  int numCols = numBays+1;
+
+  for (int k=0; k<=numStories; k++)
+    for (int i=0; i<numCols; i++) {
+      int tag = k*numCols + i + 1;
+      theDomain.addNode(new Node(tag, 3, 6.0*i, 3.5*k));
+      if (k == 0)
+	fix(theDomain, tag, 3);
+    }
+
+  // 0.5 x 0.5 RC section, 10 concrete layers and 2 steel layers
+  Concrete01 theConcrete(1, -30.0e3, -0.002, -6.0e3, -0.006);
+  Steel01 theSteel(2, 420.0e3, 200.0e6, 0.01);
+  Fiber *theFibers[12];
+  for (int i=0; i<10; i++)
+    theFibers[i] = new UniaxialFiber2d(i, theConcrete, 0.025, -0.225 + 0.05*i);
+  theFibers[10] = new UniaxialFiber2d(10, theSteel, 0.002, -0.2);
+  theFibers[11] = new UniaxialFiber2d(11, theSteel, 0.002, 0.2);
+  FiberSection2d theSection(1, 12, theFibers);
+  for (int i=0; i<12; i++)
+    delete theFibers[i];
+
+  SectionForceDeformation *theSections[5];
+  for (int i=0; i<5; i++)
+    theSections[i] = &theSection;
+  LobattoBeamIntegration theIntegration;
+  LinearCrdTransf2d theTransf(1);
+
+  int eleTag = 1;
+  for (int k=0; k<numStories; k++) {
+    for (int i=0; i<numCols; i++) {
+      int iNode = k*numCols + i + 1;
+      theDomain.addElement(new ForceBeamColumn2d(eleTag++, iNode, iNode+numCols, 5, theSections,
+						 theIntegration, theTransf));
+    }
+    for (int i=0; i<numBays; i++) {
+      int iNode = (k+1)*numCols + i + 1;
+      theDomain.addElement(new ForceBeamColumn2d(eleTag++, iNode, iNode+1, 5, theSections,
+						 theIntegration, theTransf));
+    }
+  }
+
+  addPatterns(theDomain);
+  for (int k=1; k<=numStories; k++) {
+    for (int i=0; i<numCols; i++)
+      addLoad(theDomain, 1, k*numCols + i + 1, 3, 1, -100.0);
+    addLoad(theDomain, 2, k*numCols + 1, 3, 0, 1.0*k);
+  }
+
+  // push the roof to 2% drift
+  theControl.controlNode = numStories*numCols + 1;
+  theControl.controlDof = 0;
+  theControl.controlDisp = 0.02*3.5*numStories;
+}
+
+//
+// soil: size 1m layers of 2x2 bricks, roller side walls
+//
+
+static void
+buildSoil(Domain &theDomain, int size, BenchControl &theControl)
+{
+  int numLayers = size;
+
+  for (int k=0; k<=numLayers; k++)
+    for (int j=0; j<3; j++)
+      for (int i=0; i<3; i++) {
+	int tag = k*9 + j*3 + i + 1;
+	theDomain.addNode(new Node(tag, 3, 1.0*i, 1.0*j, 1.0*k));
+	if (k == 0)
+	  fix(theDomain, tag, 3);
+	else {
+	  if (i != 1)
+	    theDomain.addSP_Constraint(new SP_Constraint(tag, 0, 0.0, true));
+	  if (j != 1)
+	    theDomain.addSP_Constraint(new SP_Constraint(tag, 1, 0.0, true));
+	}
+      }
+
+  PressureDependMultiYield *theMaterial =
+    new PressureDependMultiYield(1, 3, 2.0, 9.0e4, 2.2e5, 31.4, 0.1, 80.0, 0.5,
+				 26.5, 0.1, 0.4, 2.0, 10.0, 0.015, 1.0);
+
+  addPatterns(theDomain);
+
+  int eleTag = 1;
+  for (int k=0; k<numLayers; k++)
+    for (int j=0; j<2; j++)
+      for (int i=0; i<2; i++) {
+	int n1 = k*9 + j*3 + i + 1;
+	int n5 = n1 + 9;
+	int nodes[8] = {n1, n1+1, n1+4, n1+3, n5, n5+1, n5+4, n5+3};
+	theDomain.addElement(new Brick(eleTag++, nodes[0], nodes[1], nodes[2], nodes[3],
+				       nodes[4], nodes[5], nodes[6], nodes[7], *theMaterial));
+
+	// self weight lumped to the corners
+	for (int n=0; n<8; n++)
+	  addLoad(theDomain, 1, nodes[n], 3, 2, -2.0*9.81/8.0);
+      }
+
+  // 50 kPa surcharge on the 1m x 1m cells of the top
+  for (int j=0; j<3; j++)
+    for (int i=0; i<3; i++) {
+      double area = ((i == 1) ? 1.0 : 0.5) * ((j == 1) ? 1.0 : 0.5);
+      addLoad(theDomain, 2, numLayers*9 + j*3 + i + 1, 3, 2, -50.0*area);
+    }
+
+  theControl.controlNode = 0;
+  theControl.theNDMaterial = theMaterial;
+}
+
+//
+// shell: size stories of 4x4 bays of 3m slabs, perimeter walls
+//
+
+static void
+buildShell(Domain &theDomain, int size, BenchControl &theControl)
+{
+  int numStories = size;
+
+  for (int k=0; k<=numStories; k++)
+    for (int j=0; j<5; j++)
+      for (int i=0; i<5; i++) {
+	int tag = k*25 + j*5 + i + 1;
+	theDomain.addNode(new Node(tag, 6, 3.0*i, 3.0*j, 3.0*k));
+	if (k == 0)
+	  fix(theDomain, tag, 6);
+      }
+
+  ElasticMembranePlateSection theSection(1, 30.0e6, 0.2, 0.2, 2.4);
+
+  int eleTag = 1;
+  for (int k=0; k<numStories; k++) {
+    int base = k*25 + 1;
+    int top = base + 25;
+
+    // the floor slab above
+    for (int j=0; j<4; j++)
+      for (int i=0; i<4; i++) {
+	int n1 = top + j*5 + i;
+	theDomain.addElement(new ShellMITC4(eleTag++, n1, n1+1, n1+6, n1+5, theSection));
+      }
+
+    // walls along the four sides
+    for (int i=0; i<4; i++) {
+      int s1 = i, s2 = 20 + i, s3 = i*5, s4 = i*5 + 4;
+      theDomain.addElement(new ShellMITC4(eleTag++, base+s1, base+s1+1, top+s1+1, top+s1, theSection));
+      theDomain.addElement(new ShellMITC4(eleTag++, base+s2, base+s2+1, top+s2+1, top+s2, theSection));
+      theDomain.addElement(new ShellMITC4(eleTag++, base+s3, base+s3+5, top+s3+5, top+s3, theSection));
+      theDomain.addElement(new ShellMITC4(eleTag++, base+s4, base+s4+5, top+s4+5, top+s4, theSection));
+    }
+  }
+
+  addPatterns(theDomain);
+  for (int k=1; k<=numStories; k++) {
+    for (int n=0; n<25; n++)
+      addLoad(theDomain, 1, k*25 + n + 1, 6, 2, -90.0);
+    addLoad(theDomain, 2, k*25 + 1, 6, 0, 10.0*k);
+    addLoad(theDomain, 2, k*25 + 21, 6, 0, 10.0*k);
+  }
+
+  theControl.controlNode = 0;
+}
+
+//
+// truss: size x size x size lattice of 1m cells, face and body diagonals
+//
+
+static void
+buildTruss(Domain &theDomain, int size, BenchControl &theControl)
+{
+  int n = size+1;
+
+  for (int k=0; k<n; k++)
+    for (int j=0; j<n; j++)
+      for (int i=0; i<n; i++) {
+	int tag = k*n*n + j*n + i + 1;
+	theDomain.addNode(new Node(tag, 3, 1.0*i, 1.0*j, 1.0*k));
+	if (k == 0)
+	  fix(theDomain, tag, 3);
+      }
+
+  Steel01 *theMaterial = new Steel01(1, 250.0e3, 200.0e6, 0.02);
+
+  int eleTag = 1;
+  for (int k=0; k<n; k++)
+    for (int j=0; j<n; j++)
+      for (int i=0; i<n; i++) {
+	int tag = k*n*n + j*n + i + 1;
+	int dx = 1, dy = n, dz = n*n;
+	if (i < size)
+	  theDomain.addElement(new Truss(eleTag++, 3, tag, tag+dx, *theMaterial, 1.0e-4));
+	if (j < size)
+	  theDomain.addElement(new Truss(eleTag++, 3, tag, tag+dy, *theMaterial, 1.0e-4));
+	if (k < size)
+	  theDomain.addElement(new Truss(eleTag++, 3, tag, tag+dz, *theMaterial, 1.0e-4));
+	if (i < size && j < size)
+	  theDomain.addElement(new Truss(eleTag++, 3, tag, tag+dx+dy, *theMaterial, 1.0e-4));
+	if (i < size && k < size)
+	  theDomain.addElement(new Truss(eleTag++, 3, tag, tag+dx+dz, *theMaterial, 1.0e-4));
+	if (j < size && k < size)
+	  theDomain.addElement(new Truss(eleTag++, 3, tag, tag+dy+dz, *theMaterial, 1.0e-4));
+	if (i < size && j < size && k < size)
+	  theDomain.addElement(new Truss(eleTag++, 3, tag, tag+dx+dy+dz, *theMaterial, 1.0e-4));
+      }
+
+  addPatterns(theDomain);
+  int topNode = size*n*n + 1;
+  for (int i=0; i<n*n; i++) {
+    addLoad(theDomain, 1, topNode + i, 3, 2, -5.0);
+    addLoad(theDomain, 2, topNode + i, 3, 0, 1.0);
+  }
+
+  // push the top to 1% drift
+  theControl.controlNode = topNode;
+  theControl.controlDof = 0;
+  theControl.controlDisp = 0.01*size;
+  theControl.theUniaxial = theMaterial;
+}
+
+static LinearSOE *
+createSOE(int solver)
+{
+  switch (solver) {
+  case 0:
+    return new ProfileSPDLinSOE(*(new ProfileSPDLinDirectSolver()));
+  case 1:
+    return new BandGenLinSOE(*(new BandGenLinLapackSolver()));
+  case 2:
+    return new SparseGenColLinSOE(*(new SuperLU()));
+  default:
+    return new UmfpackGenLinSOE(*(new UmfpackGenLinSolver()));
+  }
+}
+
+static int
+runCase(int theCase, int solver, int size, int numSteps, std::ofstream &theFile, const char *label)
+{
+  opserr << "bench - " << caseNames[theCase] << " size " << size;
+  opserr << " solver " << solverNames[solver] << endln;
+
+  numLoads = 0;
+  BenchControl theControl = {0, 0, 0.0, 0, 0};
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  Domain *theDomain = new Domain();
+  switch (theCase) {
+  case 0:
+    buildFrame(*theDomain, size, theControl);
+    break;
+  case 1:
+    buildSoil(*theDomain, size, theControl);
+    break;
+  case 2:
+    buildShell(*theDomain, size, theControl);
+    break;
+  default:
+    buildTruss(*theDomain, size, theControl);
+  }
+
+  double buildTime = elapsed(start);
+
+  AnalysisModel     *theModel = new AnalysisModel();
+  ConvergenceTest   *theTest = new CTestNormDispIncr(1.0e-8, 50, 0);
+  EquiSolnAlgo      *theSolnAlgo = new NewtonRaphson(*theTest);
+  StaticIntegrator  *theIntegrator = new LoadControl(1.0/numSteps, 1, 1.0/numSteps, 1.0/numSteps);
+  ConstraintHandler *theHandler = new PlainHandler();
+  RCM               *theRCM = new RCM();
+  DOF_Numberer      *theNumberer = new DOF_Numberer(*theRCM);
+  LinearSOE         *theSOE = createSOE(solver);
+
+  StaticAnalysis theAnalysis(*theDomain, *theHandler, *theNumberer, *theModel,
+			     *theSolnAlgo, *theSOE, *theIntegrator, theTest);
+
+  PhaseProfiler::reset();
+  start = std::chrono::steady_clock::now();
+
+  // stage 1: gravity, only pattern 1 is applied
+  theDomain->getLoadPattern(2)->setTimeSeries(new LinearSeries(0, 0.0));
+  int ok = theAnalysis.analyze(numSteps);
+  double gravityTime = elapsed(start);
+
+  // stage 2: hold gravity and apply pattern 2
+  if (ok == 0) {
+    theDomain->setLoadConstant();
+    theDomain->setCurrentTime(0.0);
+    theDomain->setCommittedTime(0.0);
+    theDomain->getLoadPattern(2)->setTimeSeries(new LinearSeries());
+
+    if (theControl.theNDMaterial != 0) {
+      Information theInfo;
+      theInfo.theInt = 1;
+      theControl.theNDMaterial->updateParameter(1, theInfo);
+    }
+
+    if (theControl.controlNode != 0) {
+      double incr = theControl.controlDisp/numSteps;
+      theAnalysis.setIntegrator(*(new DisplacementControl(theControl.controlNode, theControl.controlDof,
+							   incr, theDomain, 1, incr, incr)));
+    }
+    ok = theAnalysis.analyze(numSteps);
+  }
+
+  double analyzeTime = elapsed(start);
+
+  // one line of results
+  char buffer[256];
+  theFile << "{\"label\": \"" << label << "\", \"case\": \"" << caseNames[theCase];
+  theFile << "\", \"solver\": \"" << solverNames[solver] << "\", \"size\": " << size;
+  theFile << ", \"steps\": " << numSteps;
+  theFile << ", \"numNodes\": " << theDomain->getNumNodes();
+  theFile << ", \"numElements\": " << theDomain->getNumElements();
+  theFile << ", \"numEqn\": " << theSOE->getNumEqn();
+  theFile << ", \"converged\": " << (ok == 0 ? "true" : "false");
+  sprintf(buffer, ", \"build\": %.6f, \"gravity\": %.6f, \"analyze\": %.6f",
+	  buildTime, gravityTime, analyzeTime);
+  theFile << buffer << ", \"phases\": {";
+  for (int i=0; i<PROFILE_NUM_PHASES; i++) {
+    sprintf(buffer, "%s\"%s\": {\"count\": %d, \"wall\": %.6f}", (i == 0 ? "" : ", "),
+	    PhaseProfiler::getName(i), PhaseProfiler::getCount(i), PhaseProfiler::getWallTime(i));
+    theFile << buffer;
+  }
+  theFile << "}}\n";
+  theFile.flush();
+
+  if (ok != 0)
+    opserr << "bench - " << caseNames[theCase] << " failed to converge\n";
+
+  theAnalysis.clearAll();
+  delete theDomain;
+  if (theControl.theUniaxial != 0)
+    delete theControl.theUniaxial;
+  if (theControl.theNDMaterial != 0)
+    delete theControl.theNDMaterial;
+
+  return ok;
+}
+
+//
+// load: the truss lattice saved to a model file and loaded back
+//
+
+static int
+runLoad(int numElements, std::ofstream &theFile, const char *label)
+{
+  // the lattice of size s has 3s(s+1)^2 + 3s^2(s+1) + s^3 elements
+  int size = 1;
+  while (3*size*(size+1)*(size+1) + 3*size*size*(size+1) + size*size*size < numElements)
+    size++;
+
+  opserr << "bench - load size " << size << endln;
+
+  numLoads = 0;
+  BenchControl theControl = {0, 0, 0.0, 0, 0};
+  FEM_ObjectBrokerAllClasses theBroker;
+  const char *modelName = "bench.model";
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  Domain *theDomain = new Domain();
+  buildTruss(*theDomain, size, theControl);
+  double buildTime = elapsed(start);
+
+  int numNodes = theDomain->getNumNodes();
+  int numEle = theDomain->getNumElements();
+
+  start = std::chrono::steady_clock::now();
+  int ok = saveModel(modelName, *theDomain, theBroker);
+  double saveTime = elapsed(start);
+
+  delete theDomain;
+  delete theControl.theUniaxial;
+
+  double loadTime = 0.0;
+  long long numBytes = 0;
+  int numLoadedNodes = 0;
+  int numLoadedEle = 0;
+  if (ok >= 0) {
+    std::ifstream theModel(modelName, std::ios::in | std::ios::binary | std::ios::ate);
+    numBytes = theModel.tellg();
+    theModel.close();
+
+    start = std::chrono::steady_clock::now();
+    theDomain = new Domain();
+    ok = loadModel(modelName, *theDomain, theBroker);
+    loadTime = elapsed(start);
+
+    numLoadedNodes = theDomain->getNumNodes();
+    numLoadedEle = theDomain->getNumElements();
+    delete theDomain;
+  }
+  remove(modelName);
+
+  if (ok < 0 || numLoadedNodes != numNodes || numLoadedEle != numEle) {
+    opserr << "bench - load failed, " << numLoadedEle << " of " << numEle << " elements loaded\n";
+    ok = -1;
+  }
+
+  char buffer[256];
+  theFile << "{\"label\": \"" << label << "\", \"case\": \"load\", \"size\": " << size;
+  theFile << ", \"numNodes\": " << numNodes << ", \"numElements\": " << numEle;
+  theFile << ", \"fileBytes\": " << numBytes;
+  theFile << ", \"loaded\": " << (ok >= 0 ? "true" : "false");
+  sprintf(buffer, ", \"build\": %.6f, \"save\": %.6f, \"load\": %.6f",
+	  buildTime, saveTime, loadTime);
+  theFile << buffer << "}\n";
+  theFile.flush();
+
+  opserr << "bench - " << numEle << " elements loaded in " << loadTime << " seconds\n";
+
+  return (ok < 0) ? -1 : 0;
+}
+
+int main(int argc, char **argv)
+{
+  int theCase = -1;
+  int theSolver = -1;
+  int size = 0;
+  int numSteps = 10;
+  int numLoadElements = 0;
+  const char *fileName = "bench.json";
+  const char *label = "";
+
+  for (int i=1; i<argc; i++) {
+    if (strcmp(argv[i],"-case") == 0 && i+1 < argc) {
+      i++;
+      theCase = -1;
+      for (int j=0; j<numCases; j++)
+	if (strcmp(argv[i], caseNames[j]) == 0)
+	  theCase = j;
+      if (theCase == -1 && strcmp(argv[i],"all") != 0) {
+	opserr << "bench - unknown case " << argv[i] << endln;
+	exit(-1);
+      }
+    } else if (strcmp(argv[i],"-solver") == 0 && i+1 < argc) {
+      i++;
+      theSolver = -1;
+      for (int j=0; j<numSolvers; j++)
+	if (strcmp(argv[i], solverNames[j]) == 0)
+	  theSolver = j;
+      if (theSolver == -1 && strcmp(argv[i],"all") != 0) {
+	opserr << "bench - unknown solver " << argv[i] << endln;
+	exit(-1);
+      }
+    } else if (strcmp(argv[i],"-size") == 0 && i+1 < argc)
+      size = atoi(argv[++i]);
+    else if (strcmp(argv[i],"-steps") == 0 && i+1 < argc)
+      numSteps = atoi(argv[++i]);
+    else if (strcmp(argv[i],"-out") == 0 && i+1 < argc)
+      fileName = argv[++i];
+    else if (strcmp(argv[i],"-label") == 0 && i+1 < argc)
+      label = argv[++i];
+    else if (strcmp(argv[i],"-load") == 0) {
+      numLoadElements = 1000000;
+      if (i+1 < argc && argv[i+1][0] != '-')
+	numLoadElements = atoi(argv[++i]);
+    } else {
+      opserr << "bench <-case name|all> <-solver name|all> <-size n> <-steps n> ";
+      opserr << "<-out file> <-label string>\n";
+      opserr << "bench -load <numElements> <-out file> <-label string>\n";
+      exit(-1);
+    }
+  }
+
+  if (numSteps < 1)
+    numSteps = 1;
+
+  std::ofstream theFile(fileName, std::ios::out | std::ios::app);
+  if (!theFile.is_open()) {
+    opserr << "bench - could not open file " << fileName << endln;
+    exit(-1);
+  }
+
+  if (numLoadElements > 0) {
+    int numFailed = (runLoad(numLoadElements, theFile, label) != 0) ? 1 : 0;
+    theFile.close();
+    exit(numFailed);
+  }
+
+  PhaseProfiler::setEnabled(true);
+
+  int numFailed = 0;
+  for (int i=0; i<numCases; i++) {
+    if (theCase != -1 && theCase != i)
+      continue;
+    for (int j=0; j<numSolvers; j++) {
+      if (theSolver != -1 && theSolver != j)
+	continue;
+      if (runCase(i, j, (size > 0) ? size : defaultSizes[i], numSteps, theFile, label) != 0)
+	numFailed++;
+    }
+  }
+
+  theFile.close();
+
+  exit(numFailed);
+}
@@ -0,0 +1,389 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+// Purpose: this file contains a C++ main procedure to replay a linear
+// system written by the captureSOE command. The system is assembled into
+// each of the chosen SOE types and solved, outside of any model, so that
+// solvers and orderings can be compared on the systems of a real analysis.
+//
+// For every solver one line of JSON is appended to the output file holding
+// the wall times of setSize (ordering and symbolic work), assembly and
+// solve, the relative residual ||Ax-b||/||b|| and the bytes allocated by
+// setSize and by the first solve; the latter measures the fill-in of the
+// factorization for the solvers that allocate it with new. Symmetric
+// storages (ProfileSPD, BandSPD, SymSparse) only see one triangle of A,
+// their residual shows if the system was not symmetric.
+//
+//      soeReplay file <-solver name|all> <-repeat n> <-out file> <-label string>
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <OPS_Globals.h>
+#include <StandardStream.h>
+
+#include <Domain.h>
+#include <Element.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+
+#include <LinearSOECapture.h>
+#include <ProfileSPDLinSOE.h>
+#include <ProfileSPDLinDirectSolver.h>
+#include <BandSPDLinSOE.h>
+#include <BandSPDLinLapackSolver.h>
+#include <BandGenLinSOE.h>
+#include <BandGenLinLapackSolver.h>
+#include <FullGenLinSOE.h>
+#include <FullGenLinLapackSolver.h>
+#include <SparseGenColLinSOE.h>
+#include <SuperLU.h>
+#include <UmfpackGenLinSOE.h>
+#include <UmfpackGenLinSolver.h>
+#include <SymSparseLinSOE.h>
+#include <SymSparseLinSolver.h>
+#include <DiagonalSOE.h>
+#include <DiagonalDirectSolver.h>
+
+// init the global variabled defined in OPS_Globals.h
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+double        ops_Dt = 0;
+Domain       *ops_TheActiveDomain = 0;
+Element      *ops_TheActiveElement = 0;
+
+static const char *solverNames[] = {"ProfileSPD", "BandSPD", "BandGen", "FullGen",
+				    "SparseGEN", "Umfpack", "SymSparse", "Diagonal"};
+static const int numSolvers = 8;
+
+// FullGen is only tried on systems up to this size
+static const int maxFullSize = 5000;
+
+//
+// heap accounting, used for the memory of setSize and solve
+//
+
+static long long numAllocatedBytes = 0;
+
+void *operator new(size_t size)
+{
+  // the size is kept in front of the block, 16 bytes to keep the alignment
+  char *block = (char *)malloc(size + 16);
+  if (block == 0)
+    throw std::bad_alloc();
+  *((size_t *)block) = size;
+  numAllocatedBytes += size;
+  return block + 16;
+}
+
+void operator delete(void *ptr) noexcept
+{
+  if (ptr == 0)
+    return;
+  free((char *)ptr - 16);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+  ::operator delete(ptr);
+}
+
+static double
+elapsed(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static LinearSOE *
+createSOE(int solver)
+{
+  switch (solver) {
+  case 0:
+    return new ProfileSPDLinSOE(*(new ProfileSPDLinDirectSolver()));
+  case 1:
+    return new BandSPDLinSOE(*(new BandSPDLinLapackSolver()));
+  case 2:
+    return new BandGenLinSOE(*(new BandGenLinLapackSolver()));
+  case 3:
+    return new FullGenLinSOE(*(new FullGenLinLapackSolver()));
+  case 4:
+    return new SparseGenColLinSOE(*(new SuperLU()));
+  case 5:
+    return new UmfpackGenLinSOE(*(new UmfpackGenLinSolver()));
+  case 6:
+    return new SymSparseLinSOE(*(new SymSparseLinSolver()), 1);
+  default:
+    return new DiagonalSOE(*(new DiagonalDirectSolver()));
+  }
+}
+
+// the system read from file, off diagonal entries paired so that a symmetric
+// storage is given both a(i,j) and a(j,i) in one 2x2 block
+struct ReplaySystem {
+  int size;
+  bool diagonal;
+  std::vector<double> diag;
+  std::map<std::pair<int,int>, std::pair<double,double> > pairs;
+  Vector *B;
+};
+
+static int
+readSystem(const char *fileName, ReplaySystem &theSystem)
+{
+  std::vector<int> rows, cols;
+  std::vector<double> values, B;
+  bool symmetric;
+  int size;
+  if (LinearSOECapture::read(fileName, size, rows, cols, values, symmetric, B) < 0)
+    return -1;
+
+  theSystem.size = size;
+  theSystem.diagonal = true;
+  theSystem.diag.assign(size, 0.0);
+  for (size_t k=0; k<values.size(); k++) {
+    int i = rows[k];
+    int j = cols[k];
+    if (i < 0 || j < 0 || i >= size || j >= size) {
+      opserr << "soeReplay - entry " << (int)k << " outside the system\n";
+      return -1;
+    }
+    if (i == j) {
+      theSystem.diag[i] += values[k];
+      continue;
+    }
+    theSystem.diagonal = false;
+    if (i < j)
+      theSystem.pairs[std::make_pair(i,j)].first += values[k];
+    else
+      theSystem.pairs[std::make_pair(j,i)].second += values[k];
+    if (symmetric == true) {
+      if (i < j)
+	theSystem.pairs[std::make_pair(i,j)].second += values[k];
+      else
+	theSystem.pairs[std::make_pair(j,i)].first += values[k];
+    }
+  }
+
+  theSystem.B = new Vector(size);
+  for (int i=0; i<size && i<(int)B.size(); i++)
+    (*theSystem.B)(i) = B[i];
+
+  return 0;
+}
+
+static void
+assemble(LinearSOE &theSOE, ReplaySystem &theSystem)
+{
+  static Matrix one(1,1);
+  static ID oneID(1);
+  static Matrix two(2,2);
+  static ID twoID(2);
+
+  theSOE.zeroA();
+  theSOE.zeroB();
+
+  for (int i=0; i<theSystem.size; i++) {
+    one(0,0) = theSystem.diag[i];
+    oneID(0) = i;
+    theSOE.addA(one, oneID);
+  }
+
+  std::map<std::pair<int,int>, std::pair<double,double> >::iterator it;
+  for (it = theSystem.pairs.begin(); it != theSystem.pairs.end(); it++) {
+    twoID(0) = it->first.first;
+    twoID(1) = it->first.second;
+    two(0,1) = it->second.first;
+    two(1,0) = it->second.second;
+    theSOE.addA(two, twoID);
+  }
+
+  theSOE.setB(*theSystem.B);
+}
+
+static double
+residual(ReplaySystem &theSystem, const Vector &X)
+{
+  Vector R(*theSystem.B);
+  for (int i=0; i<theSystem.size; i++)
+    R(i) -= theSystem.diag[i]*X(i);
+
+  std::map<std::pair<int,int>, std::pair<double,double> >::iterator it;
+  for (it = theSystem.pairs.begin(); it != theSystem.pairs.end(); it++) {
+    int i = it->first.first;
+    int j = it->first.second;
+    R(i) -= it->second.first*X(j);
+    R(j) -= it->second.second*X(i);
+  }
+
+  double normB = theSystem.B->Norm();
+  return (normB > 0.0) ? R.Norm()/normB : R.Norm();
+}
+
+static int
+replay(int solver, ReplaySystem &theSystem, int numRepeat, std::ofstream &theFile,
+       const char *fileName, const char *label)
+{
+  opserr << "soeReplay - " << fileName << " solver " << solverNames[solver] << endln;
+
+  int size = theSystem.size;
+
+  // the graph of the system, an edge for each off diagonal pair
+  Graph theGraph(size);
+  for (int i=0; i<size; i++)
+    theGraph.addVertex(new Vertex(i, i), false);
+  std::map<std::pair<int,int>, std::pair<double,double> >::iterator it;
+  for (it = theSystem.pairs.begin(); it != theSystem.pairs.end(); it++)
+    theGraph.addEdge(it->first.first, it->first.second);
+
+  LinearSOE *theSOE = createSOE(solver);
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  long long bytes = numAllocatedBytes;
+  int res = theSOE->setSize(theGraph);
+  double setSizeTime = elapsed(start);
+  long long setSizeBytes = numAllocatedBytes - bytes;
+  if (res < 0) {
+    opserr << "soeReplay - setSize failed for " << solverNames[solver] << endln;
+    delete theSOE;
+    return -1;
+  }
+
+  double assembleTime = 0.0;
+  double solveTime = 0.0;
+  double minSolveTime = 0.0;
+  long long solveBytes = 0;
+  for (int i=0; i<numRepeat && res >= 0; i++) {
+    start = std::chrono::steady_clock::now();
+    assemble(*theSOE, theSystem);
+    assembleTime += elapsed(start);
+
+    start = std::chrono::steady_clock::now();
+    bytes = numAllocatedBytes;
+    res = theSOE->solve();
+    double time = elapsed(start);
+    if (i == 0)
+      solveBytes = numAllocatedBytes - bytes;
+    solveTime += time;
+    if (i == 0 || time < minSolveTime)
+      minSolveTime = time;
+  }
+
+  if (res < 0)
+    opserr << "soeReplay - solve failed for " << solverNames[solver] << endln;
+
+  double norm = (res < 0) ? -1.0 : residual(theSystem, theSOE->getX());
+
+  char buffer[400];
+  theFile << "{\"label\": \"" << label << "\", \"file\": \"" << fileName;
+  theFile << "\", \"solver\": \"" << solverNames[solver] << "\"";
+  theFile << ", \"numEqn\": " << size << ", \"numPairs\": " << (int)theSystem.pairs.size();
+  theFile << ", \"solved\": " << (res < 0 ? "false" : "true");
+  sprintf(buffer, ", \"setSize\": %.6f, \"assemble\": %.6f, \"solve\": %.6f, \"solveMin\": %.6f",
+	  setSizeTime, assembleTime/numRepeat, solveTime/numRepeat, minSolveTime);
+  theFile << buffer;
+  sprintf(buffer, ", \"residual\": %.6e, \"setSizeBytes\": %lld, \"solveBytes\": %lld}\n",
+	  norm, setSizeBytes, solveBytes);
+  theFile << buffer;
+  theFile.flush();
+
+  delete theSOE;
+
+  return (res < 0) ? -1 : 0;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc < 2) {
+    opserr << "soeReplay file <-solver name|all> <-repeat n> <-out file> <-label string>\n";
+    exit(-1);
+  }
+
+  const char *systemName = argv[1];
+  int theSolver = -1;
+  int numRepeat = 1;
+  const char *fileName = "soeReplay.json";
+  const char *label = "";
+
+  for (int i=2; i<argc; i++) {
+    if (strcmp(argv[i],"-solver") == 0 && i+1 < argc) {
+      i++;
+      theSolver = -1;
+      for (int j=0; j<numSolvers; j++)
+	if (strcmp(argv[i], solverNames[j]) == 0)
+	  theSolver = j;
+      if (theSolver == -1 && strcmp(argv[i],"all") != 0) {
+	opserr << "soeReplay - unknown solver " << argv[i] << endln;
+	exit(-1);
+      }
+    } else if (strcmp(argv[i],"-repeat") == 0 && i+1 < argc)
+      numRepeat = atoi(argv[++i]);
+    else if (strcmp(argv[i],"-out") == 0 && i+1 < argc)
+      fileName = argv[++i];
+    else if (strcmp(argv[i],"-label") == 0 && i+1 < argc)
+      label = argv[++i];
+    else {
+      opserr << "soeReplay file <-solver name|all> <-repeat n> <-out file> <-label string>\n";
+      exit(-1);
+    }
+  }
+
+  if (numRepeat < 1)
+    numRepeat = 1;
+
+  ReplaySystem theSystem;
+  if (readSystem(systemName, theSystem) < 0)
+    exit(-1);
+
+  std::ofstream theFile(fileName, std::ios::out | std::ios::app);
+  if (!theFile.is_open()) {
+    opserr << "soeReplay - could not open file " << fileName << endln;
+    exit(-1);
+  }
+
+  int numFailed = 0;
+  for (int j=0; j<numSolvers; j++) {
+    if (theSolver != -1 && theSolver != j)
+      continue;
+    // with all, skip the solvers that do not fit the system
+    if (theSolver == -1 && j == 3 && theSystem.size > maxFullSize)
+      continue;
+    if (theSolver == -1 && j == 7 && theSystem.diagonal == false)
+      continue;
+    if (replay(j, theSystem, numRepeat, theFile, systemName, label) != 0)
+      numFailed++;
+  }
+
+  theFile.close();
+  delete theSystem.B;
+
+  exit(numFailed);
+}
@@ -0,0 +1,96 @@
+# CompressedRecorder Example
+
+# Records the free vibration of a nonlinear truss twice, once to a text
+# file at full precision (17 digits, which round trip exactly) and once to
+# a -compressed file, which is then converted back to text. The compression
+# is lossless, so the two files must hold the same rows and exactly the
+# same numbers.
+
+puts "CompressedRecorder.tcl: Verification of -compressed recorder write and read-back"
+
+set testOK 0
+
+wipe
+
+model Basic -ndm 2 -ndf 2
+
+node 1 0.0   0.0
+node 2 100.0 0.0
+node 3 0.0   100.0
+
+fix 1 1 1
+fix 3 1 1
+fix 2 0 0
+
+mass 2 1.0 1.0
+
+uniaxialMaterial Steel01 1 60.0 30000.0 0.02
+element Truss 1 1 2 1.0 1
+element Truss 2 3 2 1.0 1
+
+# an initial displacement, released in a transient analysis
+setNodeDisp 2 1 0.5 -commit
+setNodeDisp 2 2 -0.3 -commit
+
+recorder Node -file compressed.txt -precision 17 -time -node 2 -dof 1 2 disp vel
+recorder Node -compressed compressed.bin -time -node 2 -dof 1 2 disp vel
+
+constraints Plain
+numberer Plain
+system BandGeneral
+test NormDispIncr 1.0e-10 20
+algorithm Newton
+integrator Newmark 0.5 0.25
+analysis Transient
+
+analyze 500 0.01
+
+# wipe closes the recorders, flushing the last record
+wipe
+convertCompressedToText compressed.bin compressed.out
+
+set fileA [open compressed.txt r]
+set fileB [open compressed.out r]
+set numRows 0
+while {[gets $fileA lineA] >= 0} {
+    if {[gets $fileB lineB] < 0} {
+	puts "failed, the read-back file ends at row $numRows"
+	set testOK -1
+	break
+    }
+    incr numRows
+    if {[llength $lineA] != [llength $lineB]} {
+	puts "failed, row $numRows has [llength $lineB] columns, expected [llength $lineA]"
+	set testOK -1
+	break
+    }
+    foreach a $lineA b $lineB {
+	if {[expr {double($a) != double($b)}]} {
+	    puts "failed, row $numRows read back $b, expected $a"
+	    set testOK -1
+	    break
+	}
+    }
+}
+if {$testOK == 0 && [gets $fileB lineB] >= 0} {
+    puts "failed, the read-back file has more rows than the text file"
+    set testOK -1
+}
+close $fileA
+close $fileB
+file delete compressed.txt compressed.bin compressed.out
+
+puts "compared $numRows rows, expected 500"
+if {$numRows != 500} {
+    set testOK -1
+}
+
+set results [open results.out a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test CompressedRecorder.tcl \n\n"
+    puts $results "PASSED : CompressedRecorder.tcl"
+} else {
+    puts "\nFAILED Verification Test CompressedRecorder.tcl \n\n"
+    puts $results "FAILED : CompressedRecorder.tcl"
+}
+close $results
@@ -0,0 +1,85 @@
+# ConvergenceLog Example
+
+# Logs the convergence of a nonlinear truss analysis to a JSON lines file.
+# Every step must be on the file as soon as it is run, each line must hold
+# all the fields of a step, and wipe must close the log.
+
+puts "ConvergenceLog.tcl: Verification of the convergenceLog JSON lines file"
+
+set testOK 0
+
+wipe
+
+model Basic -ndm 2 -ndf 2
+
+node 1 0.0   0.0
+node 2 100.0 0.0
+node 3 0.0   100.0
+
+fix 1 1 1
+fix 3 1 1
+fix 2 0 0
+
+uniaxialMaterial Steel01 1 60.0 30000.0 0.02
+element Truss 1 1 2 1.0 1
+element Truss 2 3 2 1.0 1
+
+timeSeries Linear 1
+pattern Plain 1 1 {
+    load 2 10.0 -10.0
+}
+
+constraints Plain
+numberer Plain
+system BandGeneral
+test NormDispIncr 1.0e-10 20
+algorithm Newton
+integrator LoadControl 1.0
+analysis Static
+
+convergenceLog convergence.json
+analyze 5
+
+# read back while the log is still open, each step is flushed as written
+proc checkLog {fileName numSteps} {
+    set ok 0
+    set numLines 0
+    set fileId [open $fileName r]
+    while {[gets $fileId line] >= 0} {
+	incr numLines
+	if {![regexp "^\\{\"step\": $numLines, \"time\": " $line] ||
+	    ![regexp {"result": 0, } $line] ||
+	    ![regexp {"wall": [^,]+, "norms": \[[^]]+\]\}$} $line] ||
+	    [regexp -nocase {nan|inf} $line]} {
+	    puts "failed, bad line: $line"
+	    set ok -1
+	}
+    }
+    close $fileId
+    if {$numLines != $numSteps} {
+	puts "failed, $numLines steps logged, expected $numSteps"
+	set ok -1
+    }
+    return $ok
+}
+
+if {[checkLog convergence.json 5] != 0} {
+    set testOK -1
+}
+
+# wipe closes the log, further steps are not logged
+wipe
+if {[checkLog convergence.json 5] != 0} {
+    set testOK -1
+}
+file delete convergence.json
+
+set results [open results.out a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test ConvergenceLog.tcl \n\n"
+    puts $results "PASSED : ConvergenceLog.tcl"
+} else {
+    puts "\nFAILED Verification Test ConvergenceLog.tcl \n\n"
+    puts $results "FAILED : ConvergenceLog.tcl"
+}
+close $results
@@ -0,0 +1,63 @@
+# mergeProcessFiles Example
+
+# Writes the files and index a -perProcess recorder writes in a 2 process
+# run and merges them. Both processes record the time column (order 0) and
+# node 2, shared by the partitions (order 2); node 1, 2 dofs (order 1), is
+# on process 0 and node 3 (order 3) on process 1. The merged file must
+# hold each column once, in the order process 0 would have written them.
+
+puts "MergeProcessFiles.tcl: Verification of mergeProcessFiles on 2 processes"
+
+set testOK 0
+
+set fileId [open merge.out.0 w]
+puts $fileId "0.1 1.0 1.5 2.0"
+puts $fileId "0.2 1.1 1.6 2.1"
+close $fileId
+
+set fileId [open merge.out.1 w]
+puts $fileId "0.1 2.0 3.0"
+puts $fileId "0.2 2.1 3.1"
+close $fileId
+
+set fileId [open merge.out.index w]
+puts $fileId "text"
+puts $fileId "2"
+puts $fileId "merge.out.0 4 0 1 1 2"
+puts $fileId "merge.out.1 3 0 2 3"
+close $fileId
+
+mergeProcessFiles merge.out.index merge.out
+
+set expected {{0.1 1.0 1.5 2.0 3.0} {0.2 1.1 1.6 2.1 3.1}}
+set fileId [open merge.out r]
+set lines [split [string trim [read $fileId]] "\n"]
+close $fileId
+
+puts [format "%10s %s" merged: $lines]
+puts [format "%10s %s" expected: $expected]
+if {[llength $lines] != [llength $expected]} {
+    set testOK -1
+    puts "failed, wrong number of rows"
+} else {
+    foreach line $lines row $expected {
+	if {$line != $row} {
+	    set testOK -1
+	    puts "failed row-> $line, expected $row"
+	}
+    }
+}
+
+foreach name {merge.out merge.out.0 merge.out.1 merge.out.index} {
+    file delete $name
+}
+
+set results [open results.out a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test MergeProcessFiles.tcl \n\n"
+    puts $results "PASSED : MergeProcessFiles.tcl"
+} else {
+    puts "\nFAILED Verification Test MergeProcessFiles.tcl \n\n"
+    puts $results "FAILED : MergeProcessFiles.tcl"
+}
+close $results
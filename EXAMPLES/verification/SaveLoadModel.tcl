@@ -0,0 +1,99 @@
+# SaveLoadModel Example
+
+# Saves a nonlinear truss part way through a load controlled analysis and
+# loads it back after a wipe. The loaded model must have the node and
+# element response of the saved one, and continuing the analysis must give
+# the response of the model that was never saved.
+
+puts "SaveLoadModel.tcl: Verification of saveModel/loadModel round-trip"
+
+set testOK 0
+set tol 1.0e-12
+
+proc checkResponse {what dispRef forceRef} {
+    global tol testOK
+    set disp [list [nodeDisp 2 1] [nodeDisp 2 2]]
+    set force [concat [eleResponse 1 axialForce] [eleResponse 2 axialForce]]
+    foreach a $disp b $dispRef {
+	if {[expr abs($a-$b)] > $tol} {
+	    puts "failed $what, node displacement $a, expected $b"
+	    set testOK -1
+	}
+    }
+    foreach a $force b $forceRef {
+	if {[expr abs($a-$b)] > [expr $tol*(1.0+abs($b))]} {
+	    puts "failed $what, element force $a, expected $b"
+	    set testOK -1
+	}
+    }
+}
+
+proc analysisOptions {} {
+    constraints Plain
+    numberer Plain
+    system BandGeneral
+    test NormDispIncr 1.0e-10 20
+    algorithm Newton
+    integrator LoadControl 1.0
+    analysis Static
+}
+
+wipe
+
+model Basic -ndm 2 -ndf 2
+
+node 1 0.0   0.0
+node 2 100.0 0.0
+node 3 0.0   100.0
+
+fix 1 1 1
+fix 3 1 1
+fix 2 0 0
+
+uniaxialMaterial Steel01 1 60.0 30000.0 0.02
+element Truss 1 1 2 1.0 1
+element Truss 2 3 2 1.0 1
+
+timeSeries Linear 1
+pattern Plain 1 1 {
+    load 2 10.0 -10.0
+}
+
+analysisOptions
+analyze 3
+
+set dispSaved [list [nodeDisp 2 1] [nodeDisp 2 2]]
+set forceSaved [concat [eleResponse 1 axialForce] [eleResponse 2 axialForce]]
+set timeSaved [getTime]
+saveModel saveLoad.model
+
+analyze 3
+set dispEnd [list [nodeDisp 2 1] [nodeDisp 2 2]]
+set forceEnd [concat [eleResponse 1 axialForce] [eleResponse 2 axialForce]]
+
+wipe
+loadModel saveLoad.model
+file delete saveLoad.model
+
+if {[expr abs([getTime]-$timeSaved)] > $tol} {
+    puts "failed loading the time, [getTime] expected $timeSaved"
+    set testOK -1
+}
+checkResponse "loading the model" $dispSaved $forceSaved
+
+# continuing from the loaded model, the response of the model not saved
+analysisOptions
+analyze 3
+checkResponse "continuing the analysis of the loaded model" $dispEnd $forceEnd
+
+wipe
+
+set results [open results.out a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test SaveLoadModel.tcl \n\n"
+    puts $results "PASSED : SaveLoadModel.tcl"
+} else {
+    puts "\nFAILED Verification Test SaveLoadModel.tcl \n\n"
+    puts $results "FAILED : SaveLoadModel.tcl"
+}
+close $results
@@ -0,0 +1,100 @@
+# Snapshot Example
+
+# Takes two snapshots of a nonlinear truss during a load controlled analysis
+# and restores the first after the second. The state must be that of the
+# first snapshot, and as the model is unchanged the restore must be made in
+# place, keeping the recorder, which must have recorded every step run.
+
+puts "Snapshot.tcl: Verification of snapshot create/restore across two snapshots"
+
+set testOK 0
+set tol 1.0e-12
+
+wipe
+
+model Basic -ndm 2 -ndf 2
+
+node 1 0.0   0.0
+node 2 100.0 0.0
+node 3 0.0   100.0
+
+fix 1 1 1
+fix 3 1 1
+fix 2 0 0
+
+uniaxialMaterial Steel01 1 60.0 30000.0 0.02
+element Truss 1 1 2 1.0 1
+element Truss 2 3 2 1.0 1
+
+timeSeries Linear 1
+pattern Plain 1 1 {
+    load 2 10.0 -10.0
+}
+
+recorder Node -file snapshot.out -time -node 2 -dof 1 2 disp
+
+constraints Plain
+numberer Plain
+system BandGeneral
+test NormDispIncr 1.0e-10 20
+algorithm Newton
+integrator LoadControl 1.0
+analysis Static
+
+analyze 3
+set timeA [getTime]
+set dispA [nodeDisp 2 1]
+snapshot create A
+
+analyze 3
+set timeB [getTime]
+set dispB [nodeDisp 2 1]
+snapshot create B
+
+analyze 3
+snapshot restore A
+
+if {[expr abs([getTime]-$timeA)] > $tol || [expr abs([nodeDisp 2 1]-$dispA)] > $tol} {
+    set testOK -1
+    puts "failed restoring snapshot A after creating B"
+}
+
+# continue from A, this must give the state of B again
+analyze 3
+if {[expr abs([getTime]-$timeB)] > $tol || [expr abs([nodeDisp 2 1]-$dispB)] > $tol} {
+    set testOK -1
+    puts "failed continuing the analysis from snapshot A"
+}
+
+snapshot restore B
+if {[expr abs([getTime]-$timeB)] > $tol || [expr abs([nodeDisp 2 1]-$dispB)] > $tol} {
+    set testOK -1
+    puts "failed restoring snapshot B"
+}
+snapshot drop
+
+# the recorder must have survived the restores and recorded all 12 steps
+wipe
+set numLines 0
+set fileId [open snapshot.out r]
+while {[gets $fileId line] >= 0} {
+    incr numLines
+}
+close $fileId
+file delete snapshot.out
+
+puts "recorded $numLines steps, expected 12"
+if {$numLines != 12} {
+    set testOK -1
+    puts "failed, the recorder did not survive the restores"
+}
+
+set results [open results.out a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test Snapshot.tcl \n\n"
+    puts $results "PASSED : Snapshot.tcl"
+} else {
+    puts "\nFAILED Verification Test Snapshot.tcl \n\n"
+    puts $results "FAILED : Snapshot.tcl"
+}
+close $results
@@ -14,5 +14,10 @@ source EigenFrame.Extra.tcl
 source AISC25.tcl
 source PlanarShearWall.tcl
 source PinchedCylinder.tcl
+source Snapshot.tcl
+source MergeProcessFiles.tcl
+source ConvergenceLog.tcl
+source CompressedRecorder.tcl
+source SaveLoadModel.tcl
 
 exit
@@ -33,6 +33,7 @@
 
 #include <MovableObject.h>
 #include <OPS_Globals.h>
+#include <MemoryReport.h>
 
 MovableObject::MovableObject(int cTag, int dTag)
 :classTag(cTag), dbTag(dTag)
@@ -111,3 +112,9 @@ MovableObject::getVariable(const char *variable, Information &theInfo)
 {
   return -1;
 }
+
+void
+MovableObject::reportMemory(MemoryReport &theReport)
+{
+  theReport.addUnreported(*this);
+}
@@ -43,6 +43,7 @@ class Channel;
 class FEM_ObjectBroker;
 class Information;
 class Parameter;
+class MemoryReport;
 
 class MovableObject
 {
@@ -68,6 +69,9 @@ class MovableObject
 
     virtual int setVariable(const char *variable, Information &);
     virtual int getVariable(const char *variable, Information &);
+
+    // adds the heap used by the object, the default counts it as unreported
+    virtual void reportMemory(MemoryReport &theReport);
     
   protected:
     
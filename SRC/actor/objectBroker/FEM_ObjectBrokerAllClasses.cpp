@@ -314,6 +314,7 @@
 #include <BinaryFileStream.h>
 #include <DatabaseStream.h>
 #include <DummyStream.h>
+#include <AsyncStream.h>
 
 #include <NodeRecorder.h>
 #include <ElementRecorder.h>
@@ -1690,6 +1691,9 @@ FEM_ObjectBrokerAllClasses::getPtrNewStream(int classTag)
     case OPS_STREAM_TAGS_DummyStream:
       return new DummyStream();
 
+    case OPS_STREAM_TAGS_AsyncStream:
+      return new AsyncStream();
+
 
 	     
     default:
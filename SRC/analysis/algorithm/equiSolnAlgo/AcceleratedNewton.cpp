@@ -47,6 +47,7 @@
 #include <ID.h>
 
 #include <fstream>
+#include <PhaseProfiler.h>
 
 // Constructor
 AcceleratedNewton::AcceleratedNewton(int theTangentToUse)
@@ -208,7 +209,10 @@ AcceleratedNewton::solveCurrentStep(void)
     numIterations++;
 
     // Check convergence criteria
-    result = theTest->test();
+    {
+      PhaseTimer theTimer(PROFILE_TEST);
+      result = theTest->test();
+    }
 
     if (result == -1) {
       // Let the accelerator update the tangent if needed
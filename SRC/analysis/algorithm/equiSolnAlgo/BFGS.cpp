@@ -37,6 +37,7 @@
 #include <ConvergenceTest.h>
 #include <ID.h>
 #include <elementAPI.h>
+#include <PhaseProfiler.h>
 
 void* OPS_BFGS()
 {
@@ -370,13 +371,19 @@ BFGS::solveCurrentStep(void)
           opserr << "the Integrator failed in formUnbalance()\n";	
         }	    
 
-        result = localTest->test();
+        {
+          PhaseTimer theTimer(PROFILE_TEST);
+          result = localTest->test();
+        }
  
         
       } while ( result == -1 && nBFGS <= numberLoops );
 
 
-      result = theTest->test();
+      {
+        PhaseTimer theTimer(PROFILE_TEST);
+        result = theTest->test();
+      }
       this->record(count++);
 
     }  while (result == -1);
@@ -43,6 +43,7 @@
 #include <ID.h>
 #include <math.h>
 #include <elementAPI.h>
+#include <PhaseProfiler.h>
 
 void* OPS_Broyden()
 {
@@ -353,12 +354,18 @@ Broyden::solveCurrentStep(void)
           opserr << "the Integrator failed in formUnbalance()\n";	
         }	    
 	
-	result = localTest->test() ;
+	{
+	  PhaseTimer theTimer(PROFILE_TEST);
+	  result = localTest->test();
+	}
         
       } while ( result == -1 && nBroyden <= numberLoops );
 
 
-      result = theTest->test();
+      {
+        PhaseTimer theTimer(PROFILE_TEST);
+        result = theTest->test();
+      }
       this->record(count++);
 
     }  while (result == -1);
@@ -558,7 +565,10 @@ Broyden::Print(OPS_Stream &s, int flag)
 	    return -2;
 	}	
 	
-	result = theTest->test();
+	{
+	  PhaseTimer theTimer(PROFILE_TEST);
+	  result = theTest->test();
+	}
 	this->record(nBroyden++);
 
       const Vector &du = BroydengetX( theIntegrator, theSOE, nBroyden )  ;
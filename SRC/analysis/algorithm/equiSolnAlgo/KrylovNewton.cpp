@@ -44,6 +44,7 @@
 #include <Matrix.h>
 #include <Vector.h>
 #include <ID.h>
+#include <PhaseProfiler.h>
 
 // Constructor
 KrylovNewton::KrylovNewton(int theTangentToUse, int maxDim)
@@ -216,7 +217,10 @@ KrylovNewton::solveCurrentStep(void)
     // Increase current dimension of Krylov subspace
     dim++;
 
-    result = theTest->test();
+    {
+      PhaseTimer theTimer(PROFILE_TEST);
+      result = theTest->test();
+    }
     this->record(k++);
 
   } while (result == -1);
@@ -48,6 +48,7 @@
 #include <ConvergenceTest.h>
 #include <Timer.h>
 #include <elementAPI.h>
+#include <PhaseProfiler.h>
 
 void* OPS_ModifiedNewton()
 {
@@ -173,7 +174,10 @@ ModifiedNewton::solveCurrentStep(void)
 	}	
 
 	this->record(numIterations++);
-	result = theTest->test();
+	{
+	  PhaseTimer theTimer(PROFILE_TEST);
+	  result = theTest->test();
+	}
 
 	if(((theIncIntegratorr->activateSensitivity())==true) && (theIncIntegratorr->computeSensitivityAtEachIteration())==true)
 	{
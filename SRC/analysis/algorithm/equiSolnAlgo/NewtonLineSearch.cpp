@@ -39,6 +39,7 @@
 #include <FEM_ObjectBroker.h>
 #include <ConvergenceTest.h>
 #include <ID.h>
+#include <PhaseProfiler.h>
 
 
 //Null Constructor
@@ -152,7 +153,10 @@ NewtonLineSearch::solveCurrentStep(void)
 
 	// do a line search only if convergence criteria not met
 	theOtherTest->start();
-	result = theOtherTest->test();
+	{
+	  PhaseTimer theTimer(PROFILE_TEST);
+	  result = theOtherTest->test();
+	}
 
 	if (result < 1) {
 	  //new residual 
@@ -167,7 +171,10 @@ NewtonLineSearch::solveCurrentStep(void)
 
 	this->record(0);
 	  
-	result = theTest->test();
+	{
+	  PhaseTimer theTimer(PROFILE_TEST);
+	  result = theTest->test();
+	}
 
     } while (result == -1);
 
@@ -49,6 +49,7 @@
 #include <ID.h>
 #include <elementAPI.h>
 #include <string>
+#include <PhaseProfiler.h>
 
 
 void* OPS_NewtonRaphsonAlgorithm()
@@ -201,7 +202,10 @@ NewtonRaphson::solveCurrentStep(void)
 	return -2;
       }	
 
-      result = theTest->test();
+      {
+        PhaseTimer theTimer(PROFILE_TEST);
+        result = theTest->test();
+      }
        numIterations++;
       this->record(numIterations);
 
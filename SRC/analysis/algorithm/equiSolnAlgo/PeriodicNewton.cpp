@@ -40,6 +40,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <ConvergenceTest.h>
+#include <PhaseProfiler.h>
 
 // Constructor
 PeriodicNewton::PeriodicNewton(int theTangentToUse, int mc)
@@ -125,7 +126,10 @@ PeriodicNewton::solveCurrentStep(void)
 	}	
 
 	this->record(count++);
-	result = theTest->test();
+	{
+	  PhaseTimer theTimer(PROFILE_TEST);
+	  result = theTest->test();
+	}
 	
 	iter++;
 	if (iter > maxCount) {
@@ -0,0 +1,226 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+// Description: This file contains the class implementation for ConvergenceLog.
+
+#include <ConvergenceLog.h>
+#include <Domain.h>
+#include <EquiSolnAlgo.h>
+#include <ConvergenceTest.h>
+#include <ColumnarBinaryStream.h>
+#include <PhaseProfiler.h>
+#include <Vector.h>
+#include <OPS_Globals.h>
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <cmath>
+
+static const char *columnNames[CONVERGENCE_LOG_NUM_COLUMNS] = {
+  "step",
+  "time",
+  "dt",
+  "result",
+  "iterations",
+  "solves",
+  "factorizations",
+  "wall",
+  "firstNorm",
+  "lastNorm",
+  "algorithm"
+};
+
+static std::ofstream *theJSONFile = 0;
+static ColumnarBinaryStream *theBinaryFile = 0;
+
+static Vector lastStep(CONVERGENCE_LOG_NUM_COLUMNS);
+static Vector lastNorms(0);
+static const char *lastAlgorithm = "";
+
+static int numSteps = 0;
+static double startTime = 0.0;
+static int startSolves = 0;
+static int startFactorizations = 0;
+static std::chrono::steady_clock::time_point startWall;
+
+// closes the log at program exit, so the last steps logged are not lost
+// in a buffer, nor the index of a binary log
+static struct ConvergenceLogCloser {
+  ~ConvergenceLogCloser() {ConvergenceLog::close();}
+} theCloser;
+
+// JSON has no nan or inf, a diverging step writes null
+static void
+writeNumber(std::ostream &s, double value)
+{
+  if (std::isfinite(value))
+    s << value;
+  else
+    s << "null";
+}
+
+int
+ConvergenceLog::open(const char *fileName, bool binary)
+{
+  ConvergenceLog::close();
+
+  if (binary == true) {
+    theBinaryFile = new ColumnarBinaryStream(fileName);
+
+    // the schema, a column for each entry of the last step
+    theBinaryFile->tag("ConvergenceOutput");
+    for (int i=0; i<CONVERGENCE_LOG_NUM_COLUMNS; i++) {
+      theBinaryFile->tag("ResponseType", columnNames[i]);
+    }
+    theBinaryFile->endTag();
+
+  } else {
+    theJSONFile = new std::ofstream(fileName, std::ios::out);
+    if (!theJSONFile->is_open()) {
+      opserr << "WARNING ConvergenceLog::open() - could not open file " << fileName << endln;
+      delete theJSONFile;
+      theJSONFile = 0;
+      return -1;
+    }
+    (*theJSONFile) << std::setprecision(10);
+  }
+
+  numSteps = 0;
+
+  return 0;
+}
+
+void
+ConvergenceLog::close(void)
+{
+  if (theJSONFile != 0) {
+    theJSONFile->close();
+    delete theJSONFile;
+    theJSONFile = 0;
+  }
+
+  if (theBinaryFile != 0) {
+    delete theBinaryFile;
+    theBinaryFile = 0;
+  }
+}
+
+bool
+ConvergenceLog::isOpen(void)
+{
+  return (theJSONFile != 0 || theBinaryFile != 0);
+}
+
+void
+ConvergenceLog::startStep(Domain &theDomain)
+{
+  startTime = theDomain.getCurrentTime();
+  startSolves = PhaseProfiler::getCount(PROFILE_LINEAR_SOLVE);
+  startFactorizations = PhaseProfiler::getCount(PROFILE_FACTOR);
+  startWall = std::chrono::steady_clock::now();
+}
+
+void
+ConvergenceLog::endStep(Domain &theDomain, EquiSolnAlgo &theAlgorithm, int result)
+{
+  double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - startWall).count();
+  double time = theDomain.getCurrentTime();
+
+  // the norms of the iterations of the step
+  int numIters = 1;
+  ConvergenceTest *theTest = theAlgorithm.getConvergenceTest();
+  if (theTest != 0) {
+    numIters = theTest->getNumTests();
+    const Vector &norms = theTest->getNorms();
+    int numNorms = (numIters < norms.Size()) ? numIters : norms.Size();
+    if (numNorms < 0)
+      numNorms = 0;
+    lastNorms.resize(numNorms);
+    for (int i=0; i<numNorms; i++)
+      lastNorms(i) = norms(i);
+  } else
+    lastNorms.resize(0);
+
+  int numNorms = lastNorms.Size();
+  lastAlgorithm = theAlgorithm.getClassType();
+
+  lastStep(CONVERGENCE_LOG_STEP) = ++numSteps;
+  lastStep(CONVERGENCE_LOG_TIME) = time;
+  lastStep(CONVERGENCE_LOG_DT) = time - startTime;
+  lastStep(CONVERGENCE_LOG_RESULT) = result;
+  lastStep(CONVERGENCE_LOG_ITERATIONS) = numIters;
+  lastStep(CONVERGENCE_LOG_SOLVES) = PhaseProfiler::getCount(PROFILE_LINEAR_SOLVE) - startSolves;
+  lastStep(CONVERGENCE_LOG_FACTORIZATIONS) = PhaseProfiler::getCount(PROFILE_FACTOR) - startFactorizations;
+  lastStep(CONVERGENCE_LOG_WALL) = wall;
+  lastStep(CONVERGENCE_LOG_FIRST_NORM) = (numNorms > 0) ? lastNorms(0) : 0.0;
+  lastStep(CONVERGENCE_LOG_LAST_NORM) = (numNorms > 0) ? lastNorms(numNorms-1) : 0.0;
+  lastStep(CONVERGENCE_LOG_ALGORITHM) = theAlgorithm.getClassTag();
+
+  if (theBinaryFile != 0)
+    theBinaryFile->write(lastStep);
+
+  if (theJSONFile != 0) {
+    std::ofstream &s = *theJSONFile;
+    s << "{\"step\": " << numSteps << ", \"time\": ";
+    writeNumber(s, time);
+    s << ", \"dt\": ";
+    writeNumber(s, lastStep(CONVERGENCE_LOG_DT));
+    s << ", \"algorithm\": \"" << lastAlgorithm << "\", \"result\": " << result;
+    s << ", \"iterations\": " << numIters;
+    s << ", \"solves\": " << (int)lastStep(CONVERGENCE_LOG_SOLVES);
+    s << ", \"factorizations\": " << (int)lastStep(CONVERGENCE_LOG_FACTORIZATIONS);
+    s << ", \"wall\": ";
+    writeNumber(s, wall);
+    s << ", \"norms\": [";
+    for (int i=0; i<numNorms; i++) {
+      s << (i == 0 ? "" : ", ");
+      writeNumber(s, lastNorms(i));
+    }
+    s << "]}" << std::endl;
+  }
+}
+
+const Vector &
+ConvergenceLog::getLastStep(void)
+{
+  return lastStep;
+}
+
+const Vector &
+ConvergenceLog::getLastNorms(void)
+{
+  return lastNorms;
+}
+
+const char *
+ConvergenceLog::getLastAlgorithm(void)
+{
+  return lastAlgorithm;
+}
+
+const char *
+ConvergenceLog::getColumnName(int column)
+{
+  if (column < 0 || column >= CONVERGENCE_LOG_NUM_COLUMNS)
+    return "";
+  return columnNames[column];
+}
@@ -0,0 +1,79 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+#ifndef ConvergenceLog_h
+#define ConvergenceLog_h
+
+// Description: This file contains the class definition for ConvergenceLog.
+// ConvergenceLog keeps, for every step solved by StaticAnalysis,
+// DirectIntegrationAnalysis and VariableTimeStepDirectIntegrationAnalysis,
+// the step number, time, time (or load) increment, algorithm, result,
+// number of iterations, linear solves and factorizations, wall time and
+// the norm history of the convergence test. The last step is always
+// kept, for use by scripts; when a log is open every step, failed ones
+// included, is also written to file, either as a line of JSON
+//
+//    {"step": 12, "time": 1.2, "dt": 0.1, "algorithm": "NewtonRaphson",
+//     "result": 0, "iterations": 3, "solves": 3, "factorizations": 3,
+//     "wall": 0.0123, "norms": [1.2e-2, 3.1e-5, 4.0e-10]}
+//
+// or as a row of a ColumnarBinaryStream file holding the columns of
+// getLastStep(); the binary file keeps the first and last norm only.
+// Solves and factorizations are counted through the PhaseProfiler, the
+// factorizations only for the solvers timing them separately.
+
+class Domain;
+class EquiSolnAlgo;
+class Vector;
+
+enum ConvergenceLogColumn {
+  CONVERGENCE_LOG_STEP,
+  CONVERGENCE_LOG_TIME,
+  CONVERGENCE_LOG_DT,
+  CONVERGENCE_LOG_RESULT,
+  CONVERGENCE_LOG_ITERATIONS,
+  CONVERGENCE_LOG_SOLVES,
+  CONVERGENCE_LOG_FACTORIZATIONS,
+  CONVERGENCE_LOG_WALL,
+  CONVERGENCE_LOG_FIRST_NORM,
+  CONVERGENCE_LOG_LAST_NORM,
+  CONVERGENCE_LOG_ALGORITHM,  // class tag of the algorithm
+  CONVERGENCE_LOG_NUM_COLUMNS
+};
+
+class ConvergenceLog
+{
+  public:
+    static int open(const char *fileName, bool binary = false);
+    static void close(void);
+    static bool isOpen(void);
+
+    // invoked by the analyses before the new step and after its solution
+    static void startStep(Domain &theDomain);
+    static void endStep(Domain &theDomain, EquiSolnAlgo &theAlgorithm, int result);
+
+    static const Vector &getLastStep(void);
+    static const Vector &getLastNorms(void);
+    static const char *getLastAlgorithm(void);
+    static const char *getColumnName(int column);
+};
+
+#endif
@@ -151,6 +151,8 @@ DirectIntegrationAnalysis::clearAll(void)
 
 #include <NodeIter.h>
 #include <Node.h>
+#include <PhaseProfiler.h>
+#include <ConvergenceLog.h>
 
 int 
 DirectIntegrationAnalysis::initialize(void)
@@ -202,7 +204,12 @@ DirectIntegrationAnalysis::analyze(int numSteps, double dT)
       }	
     }
 
-    if (theIntegrator->newStep(dT) < 0) {
+    ConvergenceLog::startStep(*the_Domain);
+    {
+      PhaseTimer theTimer(PROFILE_NEW_STEP);
+      result = theIntegrator->newStep(dT);
+    }
+    if (result < 0) {
       opserr << "DirectIntegrationAnalysis::analyze() - the Integrator failed";
       opserr << " at time " << the_Domain->getCurrentTime() << endln;
       the_Domain->revertToLastCommit();
@@ -211,6 +218,7 @@ DirectIntegrationAnalysis::analyze(int numSteps, double dT)
     }
     
     result = theAlgorithm->solveCurrentStep();
+    ConvergenceLog::endStep(*the_Domain, *theAlgorithm, result);
     if (result < 0) {
       opserr << "DirectIntegrationAnalysis::analyze() - the Algorithm failed";
       opserr << " at time " << the_Domain->getCurrentTime() << endln;
@@ -48,6 +48,8 @@
 #include <Graph.h>
 #include <Timer.h>
 #include <Integrator.h>//Abbas
+#include <PhaseProfiler.h>
+#include <ConvergenceLog.h>
 
 // AddingSensitivity:BEGIN //////////////////////////////////
 #ifdef _RELIABILITY
@@ -180,7 +182,11 @@ StaticAnalysis::analyze(int numSteps)
 	    }	
 	}
 
-	result = theIntegrator->newStep();
+	ConvergenceLog::startStep(*the_Domain);
+	{
+	    PhaseTimer theTimer(PROFILE_NEW_STEP);
+	    result = theIntegrator->newStep();
+	}
 	if (result < 0) {
 	    opserr << "StaticAnalysis::analyze() - the Integrator failed";
 	    opserr << " at iteration: " << i << " with domain at load factor ";
@@ -193,6 +199,7 @@ StaticAnalysis::analyze(int numSteps)
 	}
 
            result = theAlgorithm->solveCurrentStep();
+	ConvergenceLog::endStep(*the_Domain, *theAlgorithm, result);
 	if (result < 0) {
 	    opserr << "StaticAnalysis::analyze() - the Algorithm failed";
 	    opserr << " at iteration: " << i << " with domain at load factor ";
@@ -41,6 +41,8 @@
 #include <ConvergenceTest.h>
 #include <float.h>
 #include <AnalysisModel.h>
+#include <PhaseProfiler.h>
+#include <ConvergenceLog.h>
 
 // Constructor
 VariableTimeStepDirectIntegrationAnalysis::VariableTimeStepDirectIntegrationAnalysis(
@@ -102,13 +104,18 @@ VariableTimeStepDirectIntegrationAnalysis::analyze(int numSteps, double dT, doub
     // if a failure - we stop the analysis & resize time step if failure
     //
 
-    if (theIntegratr->newStep(currentDt) < 0) {
-      result = -2;
+    ConvergenceLog::startStep(*theDom);
+    {
+      PhaseTimer theTimer(PROFILE_NEW_STEP);
+      if (theIntegratr->newStep(currentDt) < 0) {
+	result = -2;
+      }
     }
 
 
     if (result >= 0) {
       result = theAlgo->solveCurrentStep();
+      ConvergenceLog::endStep(*theDom, *theAlgo, result);
       if (result < 0) 
 	result = -3;
     }    
@@ -42,6 +42,7 @@
 #include <Vector.h>
 #include <Matrix.h>
 #include <TransientIntegrator.h>
+#include <MemoryReport.h>
 
 #define MAX_NUM_DOF 256
 
@@ -975,6 +976,18 @@ DOF_Group::resetNodePtr(void)
   myNode = 0;
 }
 
+void
+DOF_Group::reportMemory(MemoryReport &theReport)
+{
+  size_t bytes = sizeof(DOF_Group) + MemoryReport::bytes(myID);
+
+  // small groups share class wide matrices and vectors
+  if (numDOF > MAX_NUM_DOF)
+    bytes += MemoryReport::bytes(unbalance) + MemoryReport::bytes(tangent);
+
+  theReport.add("analysis", "DOF_Group", bytes);
+}
+
 
 double 
 DOF_Group::getDampingBetaFactor(int mode, double ratio, double wn)
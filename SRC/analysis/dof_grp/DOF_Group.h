@@ -44,6 +44,7 @@
 #include <TaggedObject.h>
 
 class Node;
+class MemoryReport;
 class Vector;
 class Matrix;
 class TransientIntegrator;
@@ -126,6 +127,7 @@ class DOF_Group: public TaggedObject
 				const Vector &vdotdot, int gradNum, int numGrads);
 // AddingSensitivity:END //////////////////////////////////////
     virtual void  Print(OPS_Stream&, int = 0) {return;};
+    virtual void  reportMemory(MemoryReport &theReport);
     virtual void resetNodePtr(void);
   
    protected:
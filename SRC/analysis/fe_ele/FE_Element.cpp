@@ -42,6 +42,8 @@
 #include <AnalysisModel.h>
 #include <Matrix.h>
 #include <Vector.h>
+#include <ClassProfiler.h>
+#include <MemoryReport.h>
 
 #define MAX_NUM_DOF 64
 
@@ -58,7 +60,8 @@ FE_Element::FE_Element(int tag, Element *ele)
   :TaggedObject(tag),
    myDOF_Groups((ele->getExternalNodes()).Size()), myID(ele->getNumDOF()), 
    numDOF(ele->getNumDOF()), theModel(0), myEle(ele), 
-   theResidual(0), theTangent(0), theIntegrator(0)
+   theResidual(0), theTangent(0), theIntegrator(0),
+   linear(false), linearStamp(0), linearK(0), linearC(0), linearM(0), linearTang(0)
 {
   if (numDOF <= 0) {
     opserr << "FE_Element::FE_Element(Element *) ";
@@ -149,6 +152,10 @@ FE_Element::FE_Element(int tag, Element *ele)
 		exit(-1);
 	    }
 	} 
+
+	// if the element is linear its matrices are formed once & cached
+	linear = ele->isLinear();
+	linearStamp = Element::getLinearStamp();
     } else {
 
 	// as subdomains have own matrix for tangent and residual don't need
@@ -167,7 +174,8 @@ FE_Element::FE_Element(int tag, Element *ele)
 FE_Element::FE_Element(int tag, int numDOF_Group, int ndof)
   :TaggedObject(tag),
    myDOF_Groups(numDOF_Group), myID(ndof), numDOF(ndof), theModel(0),
-   myEle(0), theResidual(0), theTangent(0), theIntegrator(0)
+   myEle(0), theResidual(0), theTangent(0), theIntegrator(0),
+   linear(false), linearStamp(0), linearK(0), linearC(0), linearM(0), linearTang(0)
 {
     // this is for a subtype, the subtype must set the myDOF_Groups ID array
     numFEs++;
@@ -209,6 +217,12 @@ FE_Element::~FE_Element()
 	if (theResidual != 0) delete theResidual;
     }
 
+    // delete any matrices cached for a linear element
+    if (linearK != 0) delete linearK;
+    if (linearC != 0) delete linearC;
+    if (linearM != 0) delete linearM;
+    if (linearTang != 0) delete linearTang;
+
     // if this is the last FE_Element, clean up the
     // storage for the matrix and vector objects
     if (numFEs == 0) {
@@ -357,7 +371,7 @@ FE_Element::addKtToTang(double fact)
 	if (fact == 0.0) 
 	    return;
 	else if (myEle->isSubdomain() == false)	    
-	    theTangent->addMatrix(1.0, myEle->getTangentStiff(),fact);
+	    theTangent->addMatrix(1.0, this->getEleTangentStiff(),fact);
 	else {
 	    opserr << "WARNING FE_Element::addKToTang() - ";
 	    opserr << "- this should not be called on a Subdomain!\n";
@@ -374,7 +388,7 @@ FE_Element::addCtoTang(double fact)
 	if (fact == 0.0) 
 	  return;
 	else if (myEle->isSubdomain() == false)	    	    
-	  theTangent->addMatrix(1.0, myEle->getDamp(),fact);
+	  theTangent->addMatrix(1.0, this->getEleDamp(),fact);
 	else {
 	  opserr << "WARNING FE_Element::addCToTang() - ";
 	  opserr << "- this should not be called on a Subdomain!\n";
@@ -391,7 +405,7 @@ FE_Element::addMtoTang(double fact)
 	if (fact == 0.0) 
 	  return;
 	else if (myEle->isSubdomain() == false)	    	    
-	  theTangent->addMatrix(1.0, myEle->getMass(),fact);
+	  theTangent->addMatrix(1.0, this->getEleMass(),fact);
 	else {
 	  opserr << "WARNING FE_Element::addMToTang() - ";
 	  opserr << "- this should not be called on a Subdomain!\n";
@@ -408,7 +422,7 @@ FE_Element::addKiToTang(double fact)
     if (fact == 0.0) 
       return;
     else if (myEle->isSubdomain() == false)	    	    
-      theTangent->addMatrix(1.0, myEle->getInitialStiff(), fact);
+      theTangent->addMatrix(1.0, this->getEleInitialStiff(), fact);
     else {
 	opserr << "WARNING FE_Element::addKiToTang() - ";
 	opserr << "- this should not be called on a Subdomain!\n";
@@ -462,6 +476,53 @@ FE_Element::storePreviousK(int numP)
 }
 
 
+bool
+FE_Element::isLinear(void)
+{
+  return linear;
+}
+
+// void formLinearTangent(double cK, double cC, double cM);
+//	Method to set the tangent to cK*K + cC*C + cM*M for a linear element.
+//	The combination is formed only when the factors or the element
+//	matrices change, otherwise the cached tangent is reused.
+
+void
+FE_Element::formLinearTangent(double cK, double cC, double cM)
+{
+  if (linear == false) {
+    this->zeroTangent();
+    this->addKtToTang(cK);
+    this->addCtoTang(cC);
+    this->addMtoTang(cM);
+    return;
+  }
+
+  this->checkLinearStamp();
+
+  if (linearTang == 0 || linearFact[0] != cK || 
+      linearFact[1] != cC || linearFact[2] != cM) {
+
+    if (linearTang == 0)
+      linearTang = new Matrix(numDOF, numDOF);
+
+    linearTang->Zero();
+    if (cK != 0.0)
+      linearTang->addMatrix(1.0, this->getEleTangentStiff(), cK);
+    if (cC != 0.0)
+      linearTang->addMatrix(1.0, this->getEleDamp(), cC);
+    if (cM != 0.0)
+      linearTang->addMatrix(1.0, this->getEleMass(), cM);
+
+    linearFact[0] = cK;
+    linearFact[1] = cC;
+    linearFact[2] = cM;
+  }
+
+  *theTangent = *linearTang;
+}
+
+
 void  
 FE_Element::zeroResidual(void)
 {
@@ -487,6 +548,7 @@ FE_Element::addRtoResidual(double fact)
     if (fact == 0.0) 
       return;
     else if (myEle->isSubdomain() == false) {
+      ClassTimer theTimer(CLASS_PROFILE_RESIST, myEle);
       const Vector &eleResisting = myEle->getResistingForce();
       theResidual->addVector(1.0, eleResisting, -fact);
     }
@@ -510,6 +572,7 @@ FE_Element::addRIncInertiaToResidual(double fact)
 	if (fact == 0.0) 
 	    return;
 	else if (myEle->isSubdomain() == false) {
+	  ClassTimer theTimer(CLASS_PROFILE_RESIST, myEle);
 	  const Vector &eleResisting = myEle->getResistingForceIncInertia();
 	  theResidual->addVector(1.0, eleResisting, -fact);
 	}
@@ -597,7 +660,7 @@ FE_Element::getK_Force(const Vector &disp, double fact)
 	    tmp(i) = 0.0;
 	}
 
-	if (theResidual->addMatrixVector(1.0, myEle->getTangentStiff(), tmp, fact) < 0){
+	if (theResidual->addMatrixVector(1.0, this->getEleTangentStiff(), tmp, fact) < 0){
 	  opserr << "WARNING FE_Element::getKForce() - ";
 	  opserr << "- addMatrixVector returned error\n";		 
 	}		
@@ -635,7 +698,7 @@ FE_Element::getKi_Force(const Vector &disp, double fact)
 	    tmp(i) = 0.0;
 	}
 
-	if (theResidual->addMatrixVector(1.0, myEle->getInitialStiff(), tmp, fact) < 0){
+	if (theResidual->addMatrixVector(1.0, this->getEleInitialStiff(), tmp, fact) < 0){
 	  opserr << "WARNING FE_Element::getKForce() - ";
 	  opserr << "- addMatrixVector returned error\n";		 
 	}		
@@ -673,7 +736,7 @@ FE_Element::getM_Force(const Vector &disp, double fact)
 	    tmp(i) = 0.0;
 	}
 
-	if (theResidual->addMatrixVector(1.0, myEle->getMass(), tmp, fact) < 0){
+	if (theResidual->addMatrixVector(1.0, this->getEleMass(), tmp, fact) < 0){
 	  opserr << "WARNING FE_Element::getMForce() - ";
 	  opserr << "- addMatrixVector returned error\n";		 
 	}		
@@ -711,7 +774,7 @@ FE_Element::getC_Force(const Vector &disp, double fact)
 	    tmp(i) = 0.0;
 	}
 
-	if (theResidual->addMatrixVector(1.0, myEle->getDamp(), tmp, fact) < 0){
+	if (theResidual->addMatrixVector(1.0, this->getEleDamp(), tmp, fact) < 0){
 	  opserr << "WARNING FE_Element::getDForce() - ";
 	  opserr << "- addMatrixVector returned error\n";		 
 	}		
@@ -779,7 +842,7 @@ FE_Element::addM_Force(const Vector &accel, double fact)
 		    tmp(i) = 0.0;		
 	    }	 
 		
-	    if (theResidual->addMatrixVector(1.0, myEle->getMass(), tmp, fact) < 0){
+	    if (theResidual->addMatrixVector(1.0, this->getEleMass(), tmp, fact) < 0){
 		opserr << "WARNING FE_Element::addM_Force() - ";
 		opserr << "- addMatrixVector returned error\n";		 
 	    }		
@@ -815,7 +878,7 @@ FE_Element::addD_Force(const Vector &accel, double fact)
 		    tmp(i) = 0.0;		
 	    }	  
 		
-	    if (theResidual->addMatrixVector(1.0, myEle->getDamp(), tmp, fact) < 0){
+	    if (theResidual->addMatrixVector(1.0, this->getEleDamp(), tmp, fact) < 0){
 		opserr << "WARNING FE_Element::addD_Force() - ";
 		opserr << "- addMatrixVector returned error\n";		 
 	    }		
@@ -851,7 +914,7 @@ FE_Element::addK_Force(const Vector &disp, double fact)
 		    tmp(i) = 0.0;		
 	    }	  
 		
-	    if (theResidual->addMatrixVector(1.0, myEle->getTangentStiff(), tmp, fact) < 0){
+	    if (theResidual->addMatrixVector(1.0, this->getEleTangentStiff(), tmp, fact) < 0){
 		opserr << "WARNING FE_Element::addK_Force() - ";
 		opserr << "- addMatrixVector returned error\n";		 
 	    }		
@@ -913,7 +976,7 @@ FE_Element::addLocalM_Force(const Vector &accel, double fact)
 	if (fact == 0.0) 
 	    return;
 	if (myEle->isSubdomain() == false) {
-	    if (theResidual->addMatrixVector(1.0, myEle->getMass(),
+	    if (theResidual->addMatrixVector(1.0, this->getEleMass(),
 					     accel, fact) < 0){
 
 	      opserr << "WARNING FE_Element::addLocalM_Force() - ";
@@ -940,7 +1003,7 @@ FE_Element::addLocalD_Force(const Vector &accel, double fact)
 	if (fact == 0.0) 
 	    return;
 	if (myEle->isSubdomain() == false) {
-	    if (theResidual->addMatrixVector(1.0, myEle->getDamp(),
+	    if (theResidual->addMatrixVector(1.0, this->getEleDamp(),
 					     accel, fact) < 0){
 
 	      opserr << "WARNING FE_Element::addLocalD_Force() - ";
@@ -965,6 +1028,97 @@ FE_Element::getElement(void)
   return myEle;
 }
 
+void
+FE_Element::reportMemory(MemoryReport &theReport)
+{
+  size_t bytes = sizeof(FE_Element);
+  bytes += MemoryReport::bytes(myDOF_Groups) + MemoryReport::bytes(myID);
+
+  // small elements share class wide matrices and vectors
+  if (numDOF > MAX_NUM_DOF || theTangent == 0)
+    bytes += MemoryReport::bytes(theResidual) + MemoryReport::bytes(theTangent);
+
+  bytes += MemoryReport::bytes(linearK) + MemoryReport::bytes(linearC);
+  bytes += MemoryReport::bytes(linearM) + MemoryReport::bytes(linearTang);
+
+  theReport.add("analysis", "FE_Element", bytes);
+}
+
+
+const Matrix &
+FE_Element::getEleTangentStiff(void)
+{
+  ClassTimer theTimer(CLASS_PROFILE_TANGENT, myEle);
+
+  if (linear == false)
+    return myEle->getTangentStiff();
+
+  this->checkLinearStamp();
+  if (linearK == 0)
+    linearK = new Matrix(myEle->getTangentStiff());
+
+  return *linearK;
+}
+
+const Matrix &
+FE_Element::getEleInitialStiff(void)
+{
+  // for a linear element the initial and current stiffness are the same
+  if (linear == false)
+    return myEle->getInitialStiff();
+
+  return this->getEleTangentStiff();
+}
+
+const Matrix &
+FE_Element::getEleDamp(void)
+{
+  if (linear == false)
+    return myEle->getDamp();
+
+  this->checkLinearStamp();
+  if (linearC == 0)
+    linearC = new Matrix(myEle->getDamp());
+
+  return *linearC;
+}
+
+const Matrix &
+FE_Element::getEleMass(void)
+{
+  if (linear == false)
+    return myEle->getMass();
+
+  this->checkLinearStamp();
+  if (linearM == 0)
+    linearM = new Matrix(myEle->getMass());
+
+  return *linearM;
+}
+
+// void checkLinearStamp(void);
+//	Method to discard the cached matrices if a parameter or the damping
+//	factors have been changed since they were formed.
+
+void
+FE_Element::checkLinearStamp(void)
+{
+  int currentStamp = Element::getLinearStamp();
+  if (linearStamp == currentStamp)
+    return;
+
+  if (linearK != 0) delete linearK;
+  if (linearC != 0) delete linearC;
+  if (linearM != 0) delete linearM;
+  if (linearTang != 0) delete linearTang;
+  linearK = 0;
+  linearC = 0;
+  linearM = 0;
+  linearTang = 0;
+
+  linearStamp = currentStamp;
+}
+
 
 // AddingSensitivity:BEGIN /////////////////////////////////
 void  
@@ -43,6 +43,7 @@ class TransientIntegrator;
 class Element;
 class Integrator;
 class AnalysisModel;
+class MemoryReport;
 
 class FE_Element: public TaggedObject
 {
@@ -70,6 +71,10 @@ class FE_Element: public TaggedObject
     virtual void  addMtoTang(double fact = 1.0);    
     virtual void  addKpToTang(double fact = 1.0, int numP = 0);
     virtual int   storePreviousK(int numP);
+
+    // methods to reuse the constant matrices of linear elements
+    virtual bool  isLinear(void);
+    virtual void  formLinearTangent(double cK, double cC, double cM);
     
     // methods to allow integrator to build residual    
     virtual void  zeroResidual(void);    
@@ -94,6 +99,7 @@ class FE_Element: public TaggedObject
     Element *getElement(void);
 
     virtual void  Print(OPS_Stream&, int = 0) {return;};
+    virtual void  reportMemory(MemoryReport &theReport);
 
     // AddingSensitivity:BEGIN ////////////////////////////////////
     virtual void addResistingForceSensitivity(int gradNumber, double fact = 1.0);
@@ -108,6 +114,13 @@ class FE_Element: public TaggedObject
     void  addLocalM_ForceSensitivity(int gradNumber, const Vector &accel, double fact = 1.0);    
     void  addLocalD_ForceSensitivity(int gradNumber, const Vector &vel, double fact = 1.0);    
 
+    // methods returning the element matrices, cached if element is linear
+    const Matrix &getEleTangentStiff(void);
+    const Matrix &getEleInitialStiff(void);
+    const Matrix &getEleDamp(void);
+    const Matrix &getEleMass(void);
+    void  checkLinearStamp(void);
+
 
     // protected variables - a copy for each object of the class        
     ID myDOF_Groups;
@@ -122,6 +135,12 @@ class FE_Element: public TaggedObject
     Matrix *theTangent;
     Integrator *theIntegrator; // need for Subdomain
 
+    // cached matrices for linear elements
+    bool linear;
+    int linearStamp;
+    Matrix *linearK, *linearC, *linearM, *linearTang;
+    double linearFact[3];   // cK, cC and cM used to form linearTang
+
     
     // static variables - single copy for all objects of the class	
     static Matrix errMatrix;
@@ -40,6 +40,7 @@
 #include <DOF_GrpIter.h>
 #include <EigenSOE.h>
 #include <cmath>
+#include <PhaseProfiler.h>
 
 IncrementalIntegrator::IncrementalIntegrator(int clasTag)
 :Integrator(clasTag),
@@ -84,6 +85,7 @@ IncrementalIntegrator::setEigenSOE(EigenSOE *theEigSOE) {
 int 
 IncrementalIntegrator::formTangent(int statFlag)
 {
+    PhaseTimer theTimer(PROFILE_FORM_TANGENT);
     int result = 0;
     statusFlag = statFlag;
 
@@ -129,6 +131,7 @@ IncrementalIntegrator::formIndependentSensitivityLHS(int statFlag)
 int 
 IncrementalIntegrator::formUnbalance(void)
 {
+    PhaseTimer theTimer(PROFILE_FORM_UNBALANCE);
     if (theAnalysisModel == 0 || theSOE == 0) {
 	opserr << "WARNING IncrementalIntegrator::formUnbalance -";
 	opserr << " no AnalysisModel or LinearSOE has been set\n";
@@ -268,6 +268,15 @@ int Newmark::formEleTangent(FE_Element *theEle)
     if (determiningMass == true)
         return 0;
 
+    // linear elements reuse the cached c1*K + c2*C + c3*M
+    if (theEle->isLinear() == true)  {
+        if (statusFlag == HALL_TANGENT)
+            theEle->formLinearTangent(c1*(cFactor+iFactor), c2, c3);
+        else
+            theEle->formLinearTangent(c1, c2, c3);
+        return 0;
+    }
+
     theEle->zeroTangent();
     
     if (statusFlag == CURRENT_TANGENT)  {
@@ -44,6 +44,7 @@
 #include <DOF_Group.h>
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
+#include <PhaseProfiler.h>
 
 TransientIntegrator::TransientIntegrator(int clasTag)
 :IncrementalIntegrator(clasTag)
@@ -67,6 +68,7 @@ TransientIntegrator::formTangent(int statFlag, double iFact, double cFact)
 int 
 TransientIntegrator::formTangent(int statFlag)
 {
+    PhaseTimer theTimer(PROFILE_FORM_TANGENT);
     int result = 0;
     statusFlag = statFlag;
 
@@ -120,6 +122,7 @@ TransientIntegrator::formTangent(int statFlag)
     
 int
 TransientIntegrator::formUnbalance(void) {
+    PhaseTimer theTimer(PROFILE_FORM_UNBALANCE);
     LinearSOE *theLinSOE = this->getLinearSOE();
     AnalysisModel *theModel = this->getAnalysisModel();
 
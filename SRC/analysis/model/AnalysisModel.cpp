@@ -52,6 +52,8 @@
 
 
 #include <MapOfTaggedObjects.h>
+#include <PhaseProfiler.h>
+#include <MemoryReport.h>
 
 #define START_EQN_NUM 0
 #define START_VERTEX_NUM 0
@@ -428,6 +430,28 @@ AnalysisModel::getDOFGroupGraph(void)
   return *myGroupGraph;
 }
 
+void
+AnalysisModel::reportMemory(MemoryReport &theReport)
+{
+  theReport.add(*this, sizeof(AnalysisModel));
+
+  FE_Element *fePtr;
+  FE_EleIter &theFEs = this->getFEs();
+  while ((fePtr = theFEs()) != 0)
+    fePtr->reportMemory(theReport);
+
+  DOF_Group *dofPtr;
+  DOF_GrpIter &theDOFs = this->getDOFs();
+  while ((dofPtr = theDOFs()) != 0)
+    dofPtr->reportMemory(theReport);
+
+  // the graphs only if they have been built
+  if (myDOFGraph != 0)
+    myDOFGraph->reportMemory(theReport);
+  if (myGroupGraph != 0)
+    myGroupGraph->reportMemory(theReport);
+}
+
 
 
 
@@ -571,6 +595,7 @@ AnalysisModel::applyLoadDomain(double pseudoTime)
 int
 AnalysisModel::updateDomain(void)
 {
+    PhaseTimer theTimer(PROFILE_UPDATE);
     // check to see there is a Domain linked to the Model
 
     if (myDomain == 0) {
@@ -590,6 +615,7 @@ AnalysisModel::updateDomain(void)
 int
 AnalysisModel::updateDomain(double newTime, double dT)
 {
+    PhaseTimer theTimer(PROFILE_UPDATE);
 
     // check to see there is a Domain linked to the Model
 
@@ -646,6 +672,7 @@ AnalysisModel::eigenAnalysis(int numMode, bool generalized, bool findSmallest)
 int
 AnalysisModel::commitDomain(void)
 {
+    PhaseTimer theTimer(PROFILE_COMMIT);
     // check to see there is a Domain linked to the Model
     if (myDomain == 0) {
 	opserr << "WARNING: AnalysisModel::commitDomain. No Domain linked.\n";
@@ -79,6 +79,9 @@ class AnalysisModel: public MovableObject
     virtual int getNumEqn(void) const ; 
     virtual Graph &getDOFGraph(void);
     virtual Graph &getDOFGroupGraph(void);
+
+    // adds the heap used by the FE_Elements, DOF_Groups and graphs
+    void reportMemory(MemoryReport &theReport);
     
     // methods to update the response quantities at the DOF_Groups,
     // which in turn set the new nodal trial response quantities.
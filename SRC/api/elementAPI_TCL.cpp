@@ -98,6 +98,11 @@ static TCL_Char **currentArgv = 0;
 static int currentArg = 0;
 static int maxArg = 0;
 
+// the objects of currentArgv when invoked from an object command; the
+// numbers are then read from their internal representation
+static TCL_Char **currentObjArgv = 0;
+static Tcl_Obj *CONST *currentObjv = 0;
+
 extern const char *getInterpPWD(Tcl_Interp *interp);
 extern FE_Datastore *theDatabase;
 
@@ -181,6 +186,16 @@ int OPS_GetIntInput(int *numData, int*data)
 {
   int size = *numData;
 
+  if (currentObjv != 0 && currentArgv == currentObjArgv) {
+    for (int i=0; i<size; i++) {
+      if ((currentArg >= maxArg) || (Tcl_GetIntFromObj(theInterp, currentObjv[currentArg], &data[i]) != TCL_OK))
+	return -1;
+      else
+	currentArg++;
+    }
+    return 0;
+  }
+
   for (int i=0; i<size; i++) {
     if ((currentArg >= maxArg) || (Tcl_GetInt(theInterp, currentArgv[currentArg], &data[i]) != TCL_OK)) {    
       //opserr << "OPS_GetIntInput -- error reading " << currentArg << endln;
@@ -197,6 +212,17 @@ extern "C"
 int OPS_GetDoubleInput(int *numData, double *data)
 {
   int size = *numData;
+
+  if (currentObjv != 0 && currentArgv == currentObjArgv) {
+    for (int i=0; i<size; i++) {
+      if ((currentArg >= maxArg) || (Tcl_GetDoubleFromObj(theInterp, currentObjv[currentArg], &data[i]) != TCL_OK))
+	return -1;
+      else
+	currentArg++;
+    }
+    return 0;
+  }
+
   for (int i=0; i<size; i++) {
     if ((currentArg >= maxArg) || (Tcl_GetDouble(theInterp, currentArgv[currentArg], &data[i]) != TCL_OK)) {    
       //opserr << "OPS_GetDoubleInput -- error reading " << currentArg << endln;
@@ -963,6 +989,17 @@ OPS_ResetInput(ClientData clientData,
   return 0;
 }
 
+// give the objects of the argv of the following OPS_ResetInput calls,
+// OPS_SetInputObjects(0,0) once the command is done
+int
+OPS_SetInputObjects(TCL_Char **argv, Tcl_Obj *CONST *objv)
+{
+  currentObjArgv = argv;
+  currentObjv = objv;
+
+  return 0;
+}
+
 int
 OPS_ResetInputNoBuilder(ClientData clientData, 
 			Tcl_Interp *interp,  
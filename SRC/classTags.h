@@ -983,6 +983,10 @@
 #define OPS_STREAM_TAGS_ChannelStream           9
 #define OPS_STREAM_TAGS_DataTurbineStream      10
 #define OPS_STREAM_TAGS_DataFileStreamAdd      11
+#define OPS_STREAM_TAGS_AsyncStream            12
+#define OPS_STREAM_TAGS_ColumnarBinaryStream   13
+#define OPS_STREAM_TAGS_CompressedStream       14
+#define OPS_STREAM_TAGS_StatisticsStream       15
 
 
 #define DomDecompALGORITHM_TAGS_DomainDecompAlgo 1
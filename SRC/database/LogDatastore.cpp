@@ -0,0 +1,547 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class implementation for LogDatastore,
+// an append-only FE_Datastore for checkpoints.
+
+#include <LogDatastore.h>
+#include <OPS_Globals.h>
+#include <ID.h>
+#include <Vector.h>
+#include <Matrix.h>
+
+#include <string.h>
+#include <stdio.h>
+
+#ifdef _ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+static const char LOG_MAGIC[8] = {'O','P','S','L','O','G','D','1'};
+static const char INDEX_MAGIC[8] = {'O','P','S','L','O','G','I','1'};
+static const char HEAD_MAGIC[8] = {'O','P','S','L','O','G','H','1'};
+static const int LOG_HEADER_SIZE = 32;
+static const size_t MAX_BUFFER = 8*1024*1024;
+
+bool
+LogDatastoreKey::operator<(const LogDatastoreKey &other) const
+{
+  if (type != other.type)
+    return type < other.type;
+  if (dbTag != other.dbTag)
+    return dbTag < other.dbTag;
+  if (commitTag != other.commitTag)
+    return commitTag < other.commitTag;
+  return size < other.size;
+}
+
+
+LogDatastore::LogDatastore(const char *dataBaseName,
+			   Domain &theDomain, 
+			   FEM_ObjectBroker &theObjBroker,
+			   bool comp) 
+  :FE_Datastore(theDomain, theObjBroker), 
+   logName(dataBaseName), headName(dataBaseName), compress(comp),
+   logSize(0), lastIndex(0), mapped(0), mappedSize(0)
+{
+#ifdef _WIN32
+  theFileHandle = 0;
+  theMapping = 0;
+#endif
+#ifndef _ZLIB
+  if (compress == true) {
+    opserr << "WARNING LogDatastore - compression needs OpenSees built with zlib, ignored\n";
+    compress = false;
+  }
+#endif
+
+  logName += ".log";
+  headName += ".head";
+
+  // continue a log with a complete checkpoint
+  std::ifstream head(headName.c_str(), std::ios::in | std::ios::binary);
+  char magic[8];
+  long long headData[2];
+  if (head.is_open() && head.read(magic, 8) && memcmp(magic, HEAD_MAGIC, 8) == 0 &&
+      head.read((char *)headData, sizeof(headData))) {
+
+    head.close();
+    theLog.open(logName.c_str(), std::ios::out | std::ios::app | std::ios::binary);
+    theLog.seekp(0, std::ios::end);
+    logSize = theLog.tellp();
+    lastIndex = headData[0];
+
+    if (logSize >= headData[1] && this->readIndex() == 0)
+      return;
+
+    opserr << "WARNING LogDatastore - " << logName.c_str() << " does not match ";
+    opserr << headName.c_str() << ", starting a new log\n";
+    theLog.close();
+    theIndex.clear();
+  }
+  head.close();
+
+  // a new log
+  theLog.open(logName.c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
+  if (!theLog.is_open()) {
+    opserr << "WARNING LogDatastore - could not open file " << logName.c_str() << endln;
+    return;
+  }
+
+  char header[LOG_HEADER_SIZE];
+  memset(header, 0, LOG_HEADER_SIZE);
+  memcpy(header, LOG_MAGIC, 8);
+  theLog.write(header, LOG_HEADER_SIZE);
+  theLog.flush();
+  logSize = LOG_HEADER_SIZE;
+  lastIndex = 0;
+}
+
+LogDatastore::~LogDatastore() 
+{
+  this->flush();
+  theLog.close();
+  this->unmapLog();
+}
+
+
+int 
+LogDatastore::commitState(int commitTag)
+{
+  int result = FE_Datastore::commitState(commitTag);
+  if (result < 0)
+    return result;
+
+  // the index block of what has been sent since the last commit
+  long long indexOffset = logSize;
+  long long indexData[2];
+  indexData[0] = lastIndex;
+  indexData[1] = (long long)pending.size();
+  buffer.insert(buffer.end(), INDEX_MAGIC, INDEX_MAGIC+8);
+  buffer.insert(buffer.end(), (char *)indexData, (char *)indexData + sizeof(indexData));
+  if (pending.empty() == false)
+    buffer.insert(buffer.end(), (char *)&pending[0],
+		  (char *)&pending[0] + pending.size()*sizeof(LogDatastoreEntry));
+  logSize += 8 + sizeof(indexData) + pending.size()*sizeof(LogDatastoreEntry);
+  pending.clear();
+  lastIndex = indexOffset;
+
+  if (this->flush() < 0 || this->writeHead() < 0) {
+    opserr << "LogDatastore::commitState() - failed to write checkpoint " << commitTag << endln;
+    return -1;
+  }
+
+  return result;
+}
+
+int 
+LogDatastore::restoreState(int commitTag)
+{
+  if (this->flush() < 0 || this->mapLog() < 0) {
+    opserr << "LogDatastore::restoreState() - could not read " << logName.c_str() << endln;
+    return -1;
+  }
+
+  return FE_Datastore::restoreState(commitTag);
+}
+
+
+int 
+LogDatastore::sendMsg(int dataTag, int commitTag, 
+		      const Message &, 
+		      ChannelAddress *theAddress)
+{
+  opserr << "LogDatastore::sendMsg() - not yet implemented\n";
+  return -1;
+}		       
+
+int 
+LogDatastore::recvMsg(int dataTag, int commitTag, 
+		      Message &, 
+		      ChannelAddress *theAddress)
+{
+  opserr << "LogDatastore::recvMsg() - not yet implemented\n";
+  return -1;
+}		       
+
+int 
+LogDatastore::recvMsgUnknownSize(int dataTag, int commitTag, 
+				 Message &, 
+				 ChannelAddress *theAddress)
+{
+  opserr << "LogDatastore::recvMsgUnknownSize() - not yet implemented\n";
+  return -1;
+}		       
+
+
+int 
+LogDatastore::sendID(int dataTag, int commitTag, 
+		     const ID &theID, 
+		     ChannelAddress *theAddress)
+{
+  int size = theID.Size();
+  ints.resize(size+1);
+  for (int i=0; i<size; i++)
+    ints[i] = theID(i);
+
+  return this->append(1, size, dataTag, commitTag, &ints[0], size*sizeof(int));
+}		       
+
+int 
+LogDatastore::recvID(int dataTag, int commitTag, 
+		     ID &theID, 
+		     ChannelAddress *theAddress)
+{
+  int size = theID.Size();
+  const char *data = this->find(1, size, dataTag, commitTag, size*sizeof(int));
+  if (data == 0) {
+    opserr << "LogDatastore::recvID() - no ID of size " << size << " for dbTag " << dataTag;
+    opserr << " commitTag " << commitTag << endln;
+    return -1;
+  }
+
+  ints.resize(size+1);
+  memcpy(&ints[0], data, size*sizeof(int));
+  for (int i=0; i<size; i++)
+    theID(i) = ints[i];
+
+  return 0;
+}		       
+
+
+int 
+LogDatastore::sendMatrix(int dataTag, int commitTag, 
+			 const Matrix &theMatrix, 
+			 ChannelAddress *theAddress)
+{
+  int noRows = theMatrix.noRows();
+  int noCols = theMatrix.noCols();
+  int size = noRows*noCols;
+  values.resize(size+1);
+  int loc = 0;
+  for (int j=0; j<noCols; j++)
+    for (int i=0; i<noRows; i++)
+      values[loc++] = theMatrix(i,j);
+
+  return this->append(3, size, dataTag, commitTag, &values[0], size*sizeof(double));
+}		       
+
+int 
+LogDatastore::recvMatrix(int dataTag, int commitTag, 
+			 Matrix &theMatrix, 
+			 ChannelAddress *theAddress)
+{
+  int noRows = theMatrix.noRows();
+  int noCols = theMatrix.noCols();
+  int size = noRows*noCols;
+  const char *data = this->find(3, size, dataTag, commitTag, size*sizeof(double));
+  if (data == 0) {
+    opserr << "LogDatastore::recvMatrix() - no Matrix of size " << size << " for dbTag " << dataTag;
+    opserr << " commitTag " << commitTag << endln;
+    return -1;
+  }
+
+  values.resize(size+1);
+  memcpy(&values[0], data, size*sizeof(double));
+  int loc = 0;
+  for (int j=0; j<noCols; j++)
+    for (int i=0; i<noRows; i++)
+      theMatrix(i,j) = values[loc++];
+
+  return 0;
+}		       
+
+
+int 
+LogDatastore::sendVector(int dataTag, int commitTag, 
+			 const Vector &theVector, 
+			 ChannelAddress *theAddress)
+{
+  int size = theVector.Size();
+  values.resize(size+1);
+  for (int i=0; i<size; i++)
+    values[i] = theVector(i);
+
+  return this->append(2, size, dataTag, commitTag, &values[0], size*sizeof(double));
+}		       
+
+int 
+LogDatastore::recvVector(int dataTag, int commitTag, 
+			 Vector &theVector, 
+			 ChannelAddress *theAddress)
+{
+  int size = theVector.Size();
+  const char *data = this->find(2, size, dataTag, commitTag, size*sizeof(double));
+  if (data == 0) {
+    opserr << "LogDatastore::recvVector() - no Vector of size " << size << " for dbTag " << dataTag;
+    opserr << " commitTag " << commitTag << endln;
+    return -1;
+  }
+
+  values.resize(size+1);
+  memcpy(&values[0], data, size*sizeof(double));
+  for (int i=0; i<size; i++)
+    theVector(i) = values[i];
+
+  return 0;
+}		       
+
+
+int
+LogDatastore::append(int type, int size, int dbTag, int commitTag,
+		     const void *data, int numBytes)
+{
+  if (!theLog.is_open())
+    return -1;
+
+  LogDatastoreEntry theEntry;
+  theEntry.key.type = type;
+  theEntry.key.size = size;
+  theEntry.key.dbTag = dbTag;
+  theEntry.key.commitTag = commitTag;
+  theEntry.compressed = 0;
+  theEntry.offset = logSize;
+  theEntry.numBytes = numBytes;
+
+#ifdef _ZLIB
+  // store compressed if it is smaller
+  if (compress == true && numBytes > 64) {
+    uLongf numCompressed = compressBound(numBytes);
+    size_t start = buffer.size();
+    buffer.resize(start + numCompressed);
+    if (compress2((Bytef *)&buffer[start], &numCompressed, (const Bytef *)data, numBytes,
+		  Z_BEST_SPEED) == Z_OK && numCompressed < (uLongf)numBytes) {
+      buffer.resize(start + numCompressed);
+      theEntry.compressed = 1;
+      theEntry.numBytes = numCompressed;
+    } else
+      buffer.resize(start);
+  }
+#endif
+
+  if (theEntry.compressed == 0)
+    buffer.insert(buffer.end(), (const char *)data, (const char *)data + numBytes);
+
+  logSize += theEntry.numBytes;
+  pending.push_back(theEntry);
+  theIndex[theEntry.key] = theEntry;
+
+  if (buffer.size() > MAX_BUFFER)
+    return this->flush();
+
+  return 0;
+}
+
+const char *
+LogDatastore::find(int type, int size, int dbTag, int commitTag, int numBytes)
+{
+  LogDatastoreKey key;
+  key.type = type;
+  key.size = size;
+  key.dbTag = dbTag;
+  key.commitTag = commitTag;
+
+  std::map<LogDatastoreKey, LogDatastoreEntry>::iterator it = theIndex.find(key);
+  if (it == theIndex.end())
+    return 0;
+
+  const LogDatastoreEntry &theEntry = it->second;
+
+  // sent since the log was mapped
+  if (theEntry.offset + theEntry.numBytes > mappedSize) {
+    if (this->flush() < 0 || this->mapLog() < 0)
+      return 0;
+  }
+
+  const char *data = mapped + theEntry.offset;
+  if (theEntry.compressed == 0)
+    return data;
+
+#ifdef _ZLIB
+  expanded.resize(numBytes+1);
+  uLongf numExpanded = numBytes;
+  if (uncompress((Bytef *)&expanded[0], &numExpanded, (const Bytef *)data,
+		 (uLong)theEntry.numBytes) == Z_OK && numExpanded == (uLongf)numBytes)
+    return &expanded[0];
+#endif
+
+  opserr << "LogDatastore - could not expand compressed data for dbTag " << dbTag << endln;
+  return 0;
+}
+
+int
+LogDatastore::flush(void)
+{
+  if (buffer.empty())
+    return 0;
+
+  if (!theLog.is_open())
+    return -1;
+
+  theLog.write(&buffer[0], buffer.size());
+  theLog.flush();
+  buffer.clear();
+
+  if (theLog.bad()) {
+    opserr << "LogDatastore - failed writing " << logName.c_str() << endln;
+    return -1;
+  }
+
+  return 0;
+}
+
+int
+LogDatastore::writeHead(void)
+{
+  std::string tmpName = headName + ".tmp";
+  std::ofstream head(tmpName.c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
+  if (!head.is_open())
+    return -1;
+
+  long long headData[2];
+  headData[0] = lastIndex;
+  headData[1] = logSize;
+  head.write(HEAD_MAGIC, 8);
+  head.write((char *)headData, sizeof(headData));
+  head.close();
+  if (head.fail())
+    return -1;
+
+  // replace the last head in one step
+#ifdef _WIN32
+  if (MoveFileExA(tmpName.c_str(), headName.c_str(), MOVEFILE_REPLACE_EXISTING) == 0)
+    return -1;
+#else
+  if (rename(tmpName.c_str(), headName.c_str()) != 0)
+    return -1;
+#endif
+
+  return 0;
+}
+
+int
+LogDatastore::readIndex(void)
+{
+  std::ifstream theFile(logName.c_str(), std::ios::in | std::ios::binary);
+  if (!theFile.is_open())
+    return -1;
+
+  // from the last index back, the newest record of a key is kept
+  long long offset = lastIndex;
+  while (offset != 0) {
+    char magic[8];
+    long long indexData[2];
+    theFile.seekg(offset);
+    if (!theFile.read(magic, 8) || memcmp(magic, INDEX_MAGIC, 8) != 0 ||
+	!theFile.read((char *)indexData, sizeof(indexData)))
+      return -1;
+
+    std::vector<LogDatastoreEntry> entries(indexData[1]);
+    if (indexData[1] > 0 &&
+	!theFile.read((char *)&entries[0], indexData[1]*sizeof(LogDatastoreEntry)))
+      return -1;
+
+    for (int i=(int)entries.size()-1; i>=0; i--)
+      if (theIndex.find(entries[i].key) == theIndex.end())
+	theIndex[entries[i].key] = entries[i];
+
+    offset = indexData[0];
+  }
+
+  return 0;
+}
+
+int
+LogDatastore::mapLog(void)
+{
+  this->unmapLog();
+
+#ifdef _WIN32
+  HANDLE theFile = CreateFileA(logName.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
+			       NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (theFile == INVALID_HANDLE_VALUE)
+    return -1;
+
+  LARGE_INTEGER fileSize;
+  HANDLE mapping = NULL;
+  if (GetFileSizeEx(theFile, &fileSize) != 0)
+    mapping = CreateFileMapping(theFile, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (mapping != NULL)
+    mapped = (char *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (mapped == 0) {
+    if (mapping != NULL)
+      CloseHandle(mapping);
+    CloseHandle(theFile);
+    return -1;
+  }
+  theFileHandle = theFile;
+  theMapping = mapping;
+  mappedSize = fileSize.QuadPart;
+#else
+  int fd = ::open(logName.c_str(), O_RDONLY);
+  if (fd < 0)
+    return -1;
+
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0) {
+    close(fd);
+    return -1;
+  }
+
+  void *base = mmap(0, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED)
+    return -1;
+
+  mapped = (char *)base;
+  mappedSize = fileStat.st_size;
+#endif
+
+  return 0;
+}
+
+void
+LogDatastore::unmapLog(void)
+{
+  if (mapped == 0)
+    return;
+
+#ifdef _WIN32
+  UnmapViewOfFile(mapped);
+  CloseHandle((HANDLE)theMapping);
+  CloseHandle((HANDLE)theFileHandle);
+  theMapping = 0;
+  theFileHandle = 0;
+#else
+  munmap(mapped, mappedSize);
+#endif
+
+  mapped = 0;
+  mappedSize = 0;
+}
@@ -0,0 +1,145 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef LogDatastore_h
+#define LogDatastore_h
+
+// Description: This file contains the class definition for LogDatastore.
+// LogDatastore is a concrete subclass of FE_Datastore meant for
+// checkpointing. All data is appended to a single file, fileName.log:
+//
+//    32 byte header    "OPSLOGD1", 24 reserved bytes
+//    data records      the raw data (zlib compressed if asked for)
+//    index blocks      "OPSLOGI1", int64 previous index offset,
+//                      int64 numEntries, numEntries LogDatastoreEntry
+//
+// commitState() appends the data sent by the domain followed by one index
+// block listing the records written since the last commit, and then
+// writes fileName.head ("OPSLOGH1", int64 last index offset, int64 log
+// size) to a temporary file renamed over the old one, so a checkpoint is
+// only visible once complete. On restoreState() the log is memory mapped
+// and the data read straight from the mapping. A record is found by the
+// type, size, dbTag and commitTag it was sent with; the last one written
+// is returned.
+
+#include <FE_Datastore.h>
+
+#include <fstream>
+#include <map>
+#include <vector>
+#include <string>
+
+class FEM_ObjectBroker;
+
+struct LogDatastoreKey {
+  int type;       // 1 ID, 2 Vector, 3 Matrix
+  int size;
+  int dbTag;
+  int commitTag;
+  bool operator<(const LogDatastoreKey &other) const;
+};
+
+struct LogDatastoreEntry {
+  LogDatastoreKey key;
+  int compressed;        // 1 if numBytes of zlib data
+  long long offset;
+  long long numBytes;
+};
+
+class LogDatastore: public FE_Datastore
+{
+  public:
+    LogDatastore(const char *dataBase,
+		 Domain &theDomain, 
+		 FEM_ObjectBroker &theBroker,
+		 bool compress = false);
+    
+    ~LogDatastore();
+
+    // methods for sending and receiving the data
+    int sendMsg(int dbTag, int commitTag, 
+		const Message &, 
+		ChannelAddress *theAddress =0);    
+    int recvMsg(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+    int recvMsgUnknownSize(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+
+    int sendMatrix(int dbTag, int commitTag, 
+		   const Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag, 
+		   Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendVector(int dbTag, int commitTag, 
+		   const Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag, 
+		   Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendID(int dbTag, int commitTag,
+	       const ID &theID,
+	       ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag,
+	       ID &theID,
+	       ChannelAddress *theAddress =0);
+
+    // the commitState & restoreState methods
+    int commitState(int commitTag);        
+    int restoreState(int commitTag);        
+    
+  private:
+    int append(int type, int size, int dbTag, int commitTag,
+	       const void *data, int numBytes);
+    const char *find(int type, int size, int dbTag, int commitTag, int numBytes);
+    int flush(void);
+    int writeHead(void);
+    int readIndex(void);
+    int mapLog(void);
+    void unmapLog(void);
+
+    std::string logName;
+    std::string headName;
+    bool compress;
+
+    std::ofstream theLog;
+    long long logSize;               // bytes in the file & buffer
+    long long lastIndex;             // offset of the last index block, 0 if none
+    std::vector<char> buffer;        // data not yet written to the file
+    std::vector<LogDatastoreEntry> pending; // entries since the last commit
+    std::map<LogDatastoreKey, LogDatastoreEntry> theIndex;
+
+    std::vector<double> values;      // the data of a Vector or Matrix
+    std::vector<int> ints;           // the data of an ID
+    std::vector<char> expanded;      // a decompressed record
+
+    char *mapped;                    // the memory mapped log
+    long long mappedSize;
+#ifdef _WIN32
+    void *theFileHandle;
+    void *theMapping;
+#endif
+};
+
+#endif
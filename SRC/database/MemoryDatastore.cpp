@@ -0,0 +1,356 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+// Description: This file contains the class implementation for
+// MemoryDatastore, an FE_Datastore held in memory.
+
+#include <MemoryDatastore.h>
+#include <OPS_Globals.h>
+#include <ID.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <Message.h>
+#include <Domain.h>
+
+#include <string.h>
+#include <string>
+
+// all snapshots are kept in the one datastore, each under its own
+// commitTag, so the domain sees the same channel whichever snapshot is
+// restored and only rebuilds itself if its objects have changed. The
+// commitTags are negative, the geometry data the domain sends under its
+// geoTag (>= 0) is then never taken for snapshot data.
+static MemoryDatastore *theSnapshotStore = 0;
+static std::map<std::string, int> theSnapshots;
+static int lastSnapshotTag = 0;
+
+int
+createSnapshot(const char *name, Domain &theDomain, FEM_ObjectBroker &theBroker)
+{
+  if (theSnapshotStore == 0)
+    theSnapshotStore = new MemoryDatastore(theDomain, theBroker);
+
+  // a snapshot taken again reuses its commitTag
+  int commitTag;
+  std::map<std::string, int>::iterator it = theSnapshots.find(name);
+  if (it != theSnapshots.end())
+    commitTag = it->second;
+  else {
+    commitTag = --lastSnapshotTag;
+    theSnapshots[name] = commitTag;
+  }
+
+  if (theSnapshotStore->commitState(commitTag) < 0) {
+    opserr << "WARNING createSnapshot() - failed to store the domain in snapshot " << name << endln;
+    theSnapshotStore->removeCommit(commitTag);
+    theSnapshots.erase(name);
+    return -1;
+  }
+
+  return 0;
+}
+
+int
+restoreSnapshot(const char *name, Domain &theDomain)
+{
+  std::map<std::string, int>::iterator it = theSnapshots.find(name);
+  if (it == theSnapshots.end()) {
+    opserr << "WARNING restoreSnapshot() - no snapshot " << name << endln;
+    return -1;
+  }
+
+  if (theSnapshotStore->restoreState(it->second) < 0) {
+    opserr << "WARNING restoreSnapshot() - failed to restore the domain from snapshot " << name << endln;
+    return -1;
+  }
+
+  theDomain.domainChange();
+
+  return 0;
+}
+
+int
+dropSnapshot(const char *name)
+{
+  if (name == 0) {
+    if (theSnapshotStore != 0)
+      delete theSnapshotStore;
+    theSnapshotStore = 0;
+    theSnapshots.clear();
+    return 0;
+  }
+
+  std::map<std::string, int>::iterator it = theSnapshots.find(name);
+  if (it == theSnapshots.end()) {
+    opserr << "WARNING dropSnapshot() - no snapshot " << name << endln;
+    return -1;
+  }
+
+  theSnapshotStore->removeCommit(it->second);
+  theSnapshots.erase(it);
+
+  return 0;
+}
+
+bool
+MemoryDatastoreKey::operator<(const MemoryDatastoreKey &other) const
+{
+  if (dbTag != other.dbTag)
+    return dbTag < other.dbTag;
+  if (commitTag != other.commitTag)
+    return commitTag < other.commitTag;
+  if (type != other.type)
+    return type < other.type;
+  return size < other.size;
+}
+
+static MemoryDatastoreKey
+makeKey(int type, int size, int dbTag, int commitTag)
+{
+  MemoryDatastoreKey theKey;
+  theKey.type = type;
+  theKey.size = size;
+  theKey.dbTag = dbTag;
+  theKey.commitTag = commitTag;
+  return theKey;
+}
+
+
+MemoryDatastore::MemoryDatastore(Domain &theDomain, 
+				 FEM_ObjectBroker &theObjBroker) 
+  :FE_Datastore(theDomain, theObjBroker)
+{
+
+}
+
+MemoryDatastore::~MemoryDatastore() 
+{
+
+}
+
+void
+MemoryDatastore::removeCommit(int commitTag)
+{
+  std::map<MemoryDatastoreKey, std::vector<char> >::iterator msgIter = theMessages.begin();
+  while (msgIter != theMessages.end()) {
+    if (msgIter->first.commitTag == commitTag)
+      theMessages.erase(msgIter++);
+    else
+      msgIter++;
+  }
+
+  std::map<MemoryDatastoreKey, std::vector<int> >::iterator idIter = theIDs.begin();
+  while (idIter != theIDs.end()) {
+    if (idIter->first.commitTag == commitTag)
+      theIDs.erase(idIter++);
+    else
+      idIter++;
+  }
+
+  std::map<MemoryDatastoreKey, std::vector<double> >::iterator dIter = theDoubles.begin();
+  while (dIter != theDoubles.end()) {
+    if (dIter->first.commitTag == commitTag)
+      theDoubles.erase(dIter++);
+    else
+      dIter++;
+  }
+}
+
+long long
+MemoryDatastore::getNumBytes(void)
+{
+  long long numBytes = 0;
+
+  std::map<MemoryDatastoreKey, std::vector<char> >::iterator msgIter;
+  for (msgIter = theMessages.begin(); msgIter != theMessages.end(); msgIter++)
+    numBytes += msgIter->second.size();
+
+  std::map<MemoryDatastoreKey, std::vector<int> >::iterator idIter;
+  for (idIter = theIDs.begin(); idIter != theIDs.end(); idIter++)
+    numBytes += idIter->second.size()*sizeof(int);
+
+  std::map<MemoryDatastoreKey, std::vector<double> >::iterator dIter;
+  for (dIter = theDoubles.begin(); dIter != theDoubles.end(); dIter++)
+    numBytes += dIter->second.size()*sizeof(double);
+
+  return numBytes;
+}
+
+
+int 
+MemoryDatastore::sendMsg(int dataTag, int commitTag, 
+			 const Message &theMessage, 
+			 ChannelAddress *theAddress)
+{
+  Message &msg = const_cast<Message &>(theMessage);
+  int size = msg.getSize();
+  std::vector<char> &data = theMessages[makeKey(0, size, dataTag, commitTag)];
+  data.resize(size);
+  if (size > 0)
+    memcpy(&data[0], msg.getData(), size);
+
+  return 0;
+}		       
+
+int 
+MemoryDatastore::recvMsg(int dataTag, int commitTag, 
+			 Message &theMessage, 
+			 ChannelAddress *theAddress)
+{
+  int size = theMessage.getSize();
+  std::map<MemoryDatastoreKey, std::vector<char> >::iterator theData =
+    theMessages.find(makeKey(0, size, dataTag, commitTag));
+  if (theData == theMessages.end()) {
+    opserr << "MemoryDatastore::recvMsg() - no Message of size " << size << " for dbTag " << dataTag;
+    opserr << " commitTag " << commitTag << endln;
+    return -1;
+  }
+
+  if (size > 0)
+    memcpy((char *)theMessage.getData(), &(theData->second)[0], size);
+
+  return 0;
+}		       
+
+int 
+MemoryDatastore::recvMsgUnknownSize(int dataTag, int commitTag, 
+				    Message &, 
+				    ChannelAddress *theAddress)
+{
+  opserr << "MemoryDatastore::recvMsgUnknownSize() - not yet implemented\n";
+  return -1;
+}		       
+
+
+int 
+MemoryDatastore::sendID(int dataTag, int commitTag, 
+			const ID &theID, 
+			ChannelAddress *theAddress)
+{
+  int size = theID.Size();
+  std::vector<int> &data = theIDs[makeKey(1, size, dataTag, commitTag)];
+  data.resize(size);
+  for (int i=0; i<size; i++)
+    data[i] = theID(i);
+
+  return 0;
+}		       
+
+int 
+MemoryDatastore::recvID(int dataTag, int commitTag, 
+			ID &theID, 
+			ChannelAddress *theAddress)
+{
+  int size = theID.Size();
+  std::map<MemoryDatastoreKey, std::vector<int> >::iterator theData =
+    theIDs.find(makeKey(1, size, dataTag, commitTag));
+  if (theData == theIDs.end()) {
+    opserr << "MemoryDatastore::recvID() - no ID of size " << size << " for dbTag " << dataTag;
+    opserr << " commitTag " << commitTag << endln;
+    return -1;
+  }
+
+  const std::vector<int> &data = theData->second;
+  for (int i=0; i<size; i++)
+    theID(i) = data[i];
+
+  return 0;
+}		       
+
+
+int 
+MemoryDatastore::sendMatrix(int dataTag, int commitTag, 
+			    const Matrix &theMatrix, 
+			    ChannelAddress *theAddress)
+{
+  int noRows = theMatrix.noRows();
+  int noCols = theMatrix.noCols();
+  int size = noRows*noCols;
+  std::vector<double> &data = theDoubles[makeKey(3, size, dataTag, commitTag)];
+  data.resize(size);
+  int loc = 0;
+  for (int j=0; j<noCols; j++)
+    for (int i=0; i<noRows; i++)
+      data[loc++] = theMatrix(i,j);
+
+  return 0;
+}		       
+
+int 
+MemoryDatastore::recvMatrix(int dataTag, int commitTag, 
+			    Matrix &theMatrix, 
+			    ChannelAddress *theAddress)
+{
+  int noRows = theMatrix.noRows();
+  int noCols = theMatrix.noCols();
+  int size = noRows*noCols;
+  std::map<MemoryDatastoreKey, std::vector<double> >::iterator theData =
+    theDoubles.find(makeKey(3, size, dataTag, commitTag));
+  if (theData == theDoubles.end()) {
+    opserr << "MemoryDatastore::recvMatrix() - no Matrix of size " << size << " for dbTag " << dataTag;
+    opserr << " commitTag " << commitTag << endln;
+    return -1;
+  }
+
+  const std::vector<double> &data = theData->second;
+  int loc = 0;
+  for (int j=0; j<noCols; j++)
+    for (int i=0; i<noRows; i++)
+      theMatrix(i,j) = data[loc++];
+
+  return 0;
+}		       
+
+
+int 
+MemoryDatastore::sendVector(int dataTag, int commitTag, 
+			    const Vector &theVector, 
+			    ChannelAddress *theAddress)
+{
+  int size = theVector.Size();
+  std::vector<double> &data = theDoubles[makeKey(2, size, dataTag, commitTag)];
+  data.resize(size);
+  for (int i=0; i<size; i++)
+    data[i] = theVector(i);
+
+  return 0;
+}		       
+
+int 
+MemoryDatastore::recvVector(int dataTag, int commitTag, 
+			    Vector &theVector, 
+			    ChannelAddress *theAddress)
+{
+  int size = theVector.Size();
+  std::map<MemoryDatastoreKey, std::vector<double> >::iterator theData =
+    theDoubles.find(makeKey(2, size, dataTag, commitTag));
+  if (theData == theDoubles.end()) {
+    opserr << "MemoryDatastore::recvVector() - no Vector of size " << size << " for dbTag " << dataTag;
+    opserr << " commitTag " << commitTag << endln;
+    return -1;
+  }
+
+  const std::vector<double> &data = theData->second;
+  for (int i=0; i<size; i++)
+    theVector(i) = data[i];
+
+  return 0;
+}		       
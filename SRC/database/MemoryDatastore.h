@@ -0,0 +1,114 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+#ifndef MemoryDatastore_h
+#define MemoryDatastore_h
+
+// Description: This file contains the class definition for MemoryDatastore.
+// MemoryDatastore is a concrete subclass of FE_Datastore that keeps all
+// the data sent to it in memory, keyed by the type, size, dbTag and
+// commitTag it was sent with. It is used for snapshots of the domain:
+// commitState() stores the committed state of the domain and
+// restoreState() brings the domain back to it, without any disk I/O.
+// Sending data with a key already stored replaces the old data.
+//
+// The snapshot functions keep the named snapshots of the snapshot command
+// in one MemoryDatastore, each under its own commitTag. Restoring a
+// snapshot to the domain it was created from with no elements, nodes or
+// constraints added or removed since updates the objects in place,
+// whichever snapshot was taken or restored last, so recorders and regions
+// are kept; otherwise the domain is rebuilt from the snapshot. Sending the
+// domain to another channel (database, saveModel) in between also forces
+// a rebuild. domainChange() is invoked on restore so the analysis, and
+// with it the integrator, picks up the restored state.
+
+#include <FE_Datastore.h>
+
+#include <map>
+#include <vector>
+
+class FEM_ObjectBroker;
+
+int createSnapshot(const char *name, Domain &theDomain, FEM_ObjectBroker &theBroker);
+int restoreSnapshot(const char *name, Domain &theDomain);
+int dropSnapshot(const char *name);     // name 0 drops all
+
+struct MemoryDatastoreKey {
+  int type;       // 0 Message, 1 ID, 2 Vector, 3 Matrix
+  int size;
+  int dbTag;
+  int commitTag;
+  bool operator<(const MemoryDatastoreKey &other) const;
+};
+
+class MemoryDatastore: public FE_Datastore
+{
+  public:
+    MemoryDatastore(Domain &theDomain, 
+		    FEM_ObjectBroker &theBroker);
+    
+    ~MemoryDatastore();
+
+    // methods for sending and receiving the data
+    int sendMsg(int dbTag, int commitTag, 
+		const Message &, 
+		ChannelAddress *theAddress =0);    
+    int recvMsg(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+    int recvMsgUnknownSize(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+
+    int sendMatrix(int dbTag, int commitTag, 
+		   const Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag, 
+		   Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendVector(int dbTag, int commitTag, 
+		   const Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag, 
+		   Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendID(int dbTag, int commitTag,
+	       const ID &theID,
+	       ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag,
+	       ID &theID,
+	       ChannelAddress *theAddress =0);
+
+    // remove the data sent with commitTag
+    void removeCommit(int commitTag);
+
+    // the number of bytes of data held
+    long long getNumBytes(void);
+
+  private:
+    std::map<MemoryDatastoreKey, std::vector<char> > theMessages;
+    std::map<MemoryDatastoreKey, std::vector<int> > theIDs;
+    std::map<MemoryDatastoreKey, std::vector<double> > theDoubles;
+};
+
+#endif
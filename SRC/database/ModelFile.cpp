@@ -0,0 +1,502 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+// Description: This file contains the class implementation for ModelFile,
+// the FE_Datastore of the saveModel and loadModel commands.
+
+#include <ModelFile.h>
+#include <OPS_Globals.h>
+#include <ID.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <Message.h>
+#include <Domain.h>
+
+#include <string.h>
+#include <algorithm>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+static const char MODEL_MAGIC[8] = {'O','P','S','M','D','L','1','\0'};
+static const int MODEL_VERSION = 1;
+
+int
+saveModel(const char *fileName, Domain &theDomain, FEM_ObjectBroker &theBroker)
+{
+  ModelFile theFile(fileName, theDomain, theBroker);
+  if (theFile.save() < 0) {
+    opserr << "WARNING saveModel() - failed to save the domain to " << fileName << endln;
+    return -1;
+  }
+
+  return 0;
+}
+
+int
+loadModel(const char *fileName, Domain &theDomain, FEM_ObjectBroker &theBroker)
+{
+  ModelFile theFile(fileName, theDomain, theBroker);
+  if (theFile.load() < 0) {
+    opserr << "WARNING loadModel() - failed to load the domain from " << fileName << endln;
+    return -1;
+  }
+
+  theDomain.domainChange();
+
+  return 0;
+}
+
+static bool
+lessEntry(const ModelFileEntry &a, const ModelFileEntry &b)
+{
+  if (a.dbTag != b.dbTag)
+    return a.dbTag < b.dbTag;
+  if (a.commitTag != b.commitTag)
+    return a.commitTag < b.commitTag;
+  if (a.type != b.type)
+    return a.type < b.type;
+  return a.size < b.size;
+}
+
+
+ModelFile::ModelFile(const char *name,
+		     Domain &theDom, 
+		     FEM_ObjectBroker &theObjBroker) 
+  :FE_Datastore(theDom, theObjBroker), 
+   theDomain(&theDom), fileName(name), fileSize(0), mapped(0), mappedSize(0),
+   theIndex(0), numEntries(0)
+{
+#ifdef _WIN32
+  theFileHandle = 0;
+  theMapping = 0;
+#endif
+}
+
+ModelFile::~ModelFile() 
+{
+  theFile.close();
+  this->unmapFile();
+}
+
+
+int
+ModelFile::save(void)
+{
+  theFile.open(fileName.c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
+  if (!theFile.is_open()) {
+    opserr << "WARNING ModelFile - could not open file " << fileName.c_str() << endln;
+    return -1;
+  }
+
+  // the header is written again once the index is known
+  ModelFileHeader header;
+  memset(&header, 0, sizeof(ModelFileHeader));
+  theFile.write((char *)&header, sizeof(ModelFileHeader));
+  fileSize = sizeof(ModelFileHeader);
+  theEntries.clear();
+
+  if (this->commitState(0) < 0) {
+    theFile.close();
+    return -1;
+  }
+
+  // sort the index, a record sent again replaces the earlier one
+  std::stable_sort(theEntries.begin(), theEntries.end(), lessEntry);
+  std::vector<ModelFileEntry> index;
+  index.reserve(theEntries.size());
+  for (size_t i=0; i<theEntries.size(); i++) {
+    if (!index.empty() && !lessEntry(index.back(), theEntries[i]))
+      index.back() = theEntries[i];
+    else
+      index.push_back(theEntries[i]);
+  }
+
+  memcpy(header.magic, MODEL_MAGIC, 8);
+  header.version = MODEL_VERSION;
+  header.numNodes = theDomain->getNumNodes();
+  header.numElements = theDomain->getNumElements();
+  header.numSPs = theDomain->getNumSPs();
+  header.numMPs = theDomain->getNumMPs();
+  header.numLoadPatterns = theDomain->getNumLoadPatterns();
+  header.numEntries = index.size();
+  header.indexOffset = fileSize;
+  header.time = theDomain->getCurrentTime();
+  header.check = 1.0;
+
+  if (!index.empty())
+    theFile.write((char *)&index[0], index.size()*sizeof(ModelFileEntry));
+  theFile.seekp(0);
+  theFile.write((char *)&header, sizeof(ModelFileHeader));
+  theFile.close();
+
+  if (theFile.fail()) {
+    opserr << "WARNING ModelFile - failed writing " << fileName.c_str() << endln;
+    return -1;
+  }
+
+  return 0;
+}
+
+int
+ModelFile::load(void)
+{
+  if (this->mapFile() < 0) {
+    opserr << "WARNING ModelFile - could not open file " << fileName.c_str() << endln;
+    return -1;
+  }
+
+  ModelFileHeader header;
+  if (mappedSize < (long long)sizeof(ModelFileHeader)) {
+    opserr << "WARNING ModelFile - " << fileName.c_str() << " is not a model file\n";
+    return -1;
+  }
+  memcpy(&header, mapped, sizeof(ModelFileHeader));
+
+  if (memcmp(header.magic, MODEL_MAGIC, 8) != 0) {
+    opserr << "WARNING ModelFile - " << fileName.c_str() << " is not a model file\n";
+    return -1;
+  }
+
+  if (header.version > MODEL_VERSION) {
+    opserr << "WARNING ModelFile - " << fileName.c_str() << " is of version " << header.version;
+    opserr << ", only up to version " << MODEL_VERSION << " can be read\n";
+    return -1;
+  }
+
+  if (header.check != 1.0) {
+    opserr << "WARNING ModelFile - " << fileName.c_str();
+    opserr << " was written on a machine of different byte order\n";
+    return -1;
+  }
+
+  if (header.numEntries < 0 || header.indexOffset < (long long)sizeof(ModelFileHeader) ||
+      header.indexOffset + header.numEntries*(long long)sizeof(ModelFileEntry) > mappedSize) {
+    opserr << "WARNING ModelFile - " << fileName.c_str() << " is truncated\n";
+    return -1;
+  }
+
+  theIndex = (const ModelFileEntry *)(mapped + header.indexOffset);
+  numEntries = header.numEntries;
+
+  if (this->restoreState(0) < 0)
+    return -1;
+
+  if (theDomain->getNumNodes() != header.numNodes ||
+      theDomain->getNumElements() != header.numElements) {
+    opserr << "WARNING ModelFile - loaded " << theDomain->getNumNodes() << " nodes and ";
+    opserr << theDomain->getNumElements() << " elements, " << fileName.c_str();
+    opserr << " holds " << header.numNodes << " nodes and " << header.numElements << " elements\n";
+    return -1;
+  }
+
+  return 0;
+}
+
+
+int 
+ModelFile::sendMsg(int dataTag, int commitTag, 
+		   const Message &theMessage, 
+		   ChannelAddress *theAddress)
+{
+  Message &msg = const_cast<Message &>(theMessage);
+  int size = msg.getSize();
+  return this->append(0, size, dataTag, commitTag, msg.getData(), size);
+}		       
+
+int 
+ModelFile::recvMsg(int dataTag, int commitTag, 
+		   Message &theMessage, 
+		   ChannelAddress *theAddress)
+{
+  int size = theMessage.getSize();
+  const char *data = this->find(0, size, dataTag, commitTag, size);
+  if (data == 0) {
+    opserr << "ModelFile::recvMsg() - no Message of size " << size << " for dbTag " << dataTag;
+    opserr << " commitTag " << commitTag << endln;
+    return -1;
+  }
+
+  if (size > 0)
+    memcpy((char *)theMessage.getData(), data, size);
+
+  return 0;
+}		       
+
+int 
+ModelFile::recvMsgUnknownSize(int dataTag, int commitTag, 
+			      Message &, 
+			      ChannelAddress *theAddress)
+{
+  opserr << "ModelFile::recvMsgUnknownSize() - not yet implemented\n";
+  return -1;
+}		       
+
+
+int 
+ModelFile::sendID(int dataTag, int commitTag, 
+		  const ID &theID, 
+		  ChannelAddress *theAddress)
+{
+  int size = theID.Size();
+  ints.resize(size+1);
+  for (int i=0; i<size; i++)
+    ints[i] = theID(i);
+
+  return this->append(1, size, dataTag, commitTag, &ints[0], size*sizeof(int));
+}		       
+
+int 
+ModelFile::recvID(int dataTag, int commitTag, 
+		  ID &theID, 
+		  ChannelAddress *theAddress)
+{
+  int size = theID.Size();
+  const char *data = this->find(1, size, dataTag, commitTag, size*sizeof(int));
+  if (data == 0) {
+    opserr << "ModelFile::recvID() - no ID of size " << size << " for dbTag " << dataTag;
+    opserr << " commitTag " << commitTag << endln;
+    return -1;
+  }
+
+  const int *theData = (const int *)data;
+  for (int i=0; i<size; i++)
+    theID(i) = theData[i];
+
+  return 0;
+}		       
+
+
+int 
+ModelFile::sendMatrix(int dataTag, int commitTag, 
+		      const Matrix &theMatrix, 
+		      ChannelAddress *theAddress)
+{
+  int noRows = theMatrix.noRows();
+  int noCols = theMatrix.noCols();
+  int size = noRows*noCols;
+  values.resize(size+1);
+  int loc = 0;
+  for (int j=0; j<noCols; j++)
+    for (int i=0; i<noRows; i++)
+      values[loc++] = theMatrix(i,j);
+
+  return this->append(3, size, dataTag, commitTag, &values[0], size*sizeof(double));
+}		       
+
+int 
+ModelFile::recvMatrix(int dataTag, int commitTag, 
+		      Matrix &theMatrix, 
+		      ChannelAddress *theAddress)
+{
+  int noRows = theMatrix.noRows();
+  int noCols = theMatrix.noCols();
+  int size = noRows*noCols;
+  const char *data = this->find(3, size, dataTag, commitTag, size*sizeof(double));
+  if (data == 0) {
+    opserr << "ModelFile::recvMatrix() - no Matrix of size " << size << " for dbTag " << dataTag;
+    opserr << " commitTag " << commitTag << endln;
+    return -1;
+  }
+
+  const double *theData = (const double *)data;
+  int loc = 0;
+  for (int j=0; j<noCols; j++)
+    for (int i=0; i<noRows; i++)
+      theMatrix(i,j) = theData[loc++];
+
+  return 0;
+}		       
+
+
+int 
+ModelFile::sendVector(int dataTag, int commitTag, 
+		      const Vector &theVector, 
+		      ChannelAddress *theAddress)
+{
+  int size = theVector.Size();
+  values.resize(size+1);
+  for (int i=0; i<size; i++)
+    values[i] = theVector(i);
+
+  return this->append(2, size, dataTag, commitTag, &values[0], size*sizeof(double));
+}		       
+
+int 
+ModelFile::recvVector(int dataTag, int commitTag, 
+		      Vector &theVector, 
+		      ChannelAddress *theAddress)
+{
+  int size = theVector.Size();
+  const char *data = this->find(2, size, dataTag, commitTag, size*sizeof(double));
+  if (data == 0) {
+    opserr << "ModelFile::recvVector() - no Vector of size " << size << " for dbTag " << dataTag;
+    opserr << " commitTag " << commitTag << endln;
+    return -1;
+  }
+
+  const double *theData = (const double *)data;
+  for (int i=0; i<size; i++)
+    theVector(i) = theData[i];
+
+  return 0;
+}		       
+
+
+int
+ModelFile::append(int type, int size, int dbTag, int commitTag,
+		  const void *data, int numBytes)
+{
+  if (!theFile.is_open()) {
+    opserr << "ModelFile - " << fileName.c_str() << " is open for reading only\n";
+    return -1;
+  }
+
+  ModelFileEntry theEntry;
+  theEntry.type = type;
+  theEntry.size = size;
+  theEntry.dbTag = dbTag;
+  theEntry.commitTag = commitTag;
+  theEntry.offset = fileSize;
+  theEntry.numBytes = numBytes;
+
+  // keep every record on an 8 byte boundary so it can be read in place
+  static const char padding[8] = {0,0,0,0,0,0,0,0};
+  int numPadding = (8 - numBytes%8)%8;
+  if (numBytes > 0)
+    theFile.write((const char *)data, numBytes);
+  if (numPadding > 0)
+    theFile.write(padding, numPadding);
+
+  if (theFile.bad()) {
+    opserr << "ModelFile - failed writing " << fileName.c_str() << endln;
+    return -1;
+  }
+
+  fileSize += numBytes + numPadding;
+  theEntries.push_back(theEntry);
+
+  return 0;
+}
+
+const char *
+ModelFile::find(int type, int size, int dbTag, int commitTag, int numBytes)
+{
+  if (theIndex == 0)
+    return 0;
+
+  ModelFileEntry key;
+  key.type = type;
+  key.size = size;
+  key.dbTag = dbTag;
+  key.commitTag = commitTag;
+
+  const ModelFileEntry *last = theIndex + numEntries;
+  const ModelFileEntry *theEntry = std::lower_bound(theIndex, last, key, lessEntry);
+  if (theEntry == last || lessEntry(key, *theEntry))
+    return 0;
+
+  if (theEntry->numBytes != numBytes || theEntry->offset < 0 ||
+      theEntry->offset + theEntry->numBytes > mappedSize)
+    return 0;
+
+  return mapped + theEntry->offset;
+}
+
+int
+ModelFile::mapFile(void)
+{
+  this->unmapFile();
+
+#ifdef _WIN32
+  HANDLE theHandle = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ,
+				 NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (theHandle == INVALID_HANDLE_VALUE)
+    return -1;
+
+  LARGE_INTEGER size;
+  HANDLE mapping = NULL;
+  if (GetFileSizeEx(theHandle, &size) != 0)
+    mapping = CreateFileMapping(theHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (mapping != NULL)
+    mapped = (char *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (mapped == 0) {
+    if (mapping != NULL)
+      CloseHandle(mapping);
+    CloseHandle(theHandle);
+    return -1;
+  }
+  theFileHandle = theHandle;
+  theMapping = mapping;
+  mappedSize = size.QuadPart;
+#else
+  int fd = ::open(fileName.c_str(), O_RDONLY);
+  if (fd < 0)
+    return -1;
+
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0) {
+    close(fd);
+    return -1;
+  }
+
+  void *base = mmap(0, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED)
+    return -1;
+
+  // the records are read once, in about the order they were written
+  madvise(base, fileStat.st_size, MADV_WILLNEED);
+
+  mapped = (char *)base;
+  mappedSize = fileStat.st_size;
+#endif
+
+  return 0;
+}
+
+void
+ModelFile::unmapFile(void)
+{
+  if (mapped == 0)
+    return;
+
+#ifdef _WIN32
+  UnmapViewOfFile(mapped);
+  CloseHandle((HANDLE)theMapping);
+  CloseHandle((HANDLE)theFileHandle);
+  theMapping = 0;
+  theFileHandle = 0;
+#else
+  munmap(mapped, mappedSize);
+#endif
+
+  mapped = 0;
+  mappedSize = 0;
+  theIndex = 0;
+  numEntries = 0;
+}
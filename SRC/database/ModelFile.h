@@ -0,0 +1,152 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+#ifndef ModelFile_h
+#define ModelFile_h
+
+// Description: This file contains the class definition for ModelFile.
+// ModelFile is a concrete subclass of FE_Datastore that stores the
+// domain, as sent by Domain::sendSelf(), in a single binary file from
+// which a domain can be rebuilt without interpreting the script that
+// built it. The objects are created by the FEM_ObjectBroker from their
+// class tags and filled by their recvSelf(), so a model can be saved
+// provided its nodes, elements, materials, sections, constraints, load
+// patterns and time series implement sendSelf() and recvSelf().
+//
+// The file is written once and afterwards only read:
+//
+//    header            ModelFileHeader, magic "OPSMDL1", the version,
+//                      the location of the index and the number of
+//                      nodes, elements, ... of the domain saved
+//    data records      the raw data, each starting on an 8 byte boundary
+//    index             numEntries ModelFileEntry sorted by key
+//
+// On load() the file is memory mapped and each record is found by a
+// binary search of the index and read straight from the mapping.
+// Loading a model replaces all that is in the domain.
+
+#include <FE_Datastore.h>
+
+#include <fstream>
+#include <vector>
+#include <string>
+
+class FEM_ObjectBroker;
+
+int saveModel(const char *fileName, Domain &theDomain, FEM_ObjectBroker &theBroker);
+int loadModel(const char *fileName, Domain &theDomain, FEM_ObjectBroker &theBroker);
+
+struct ModelFileHeader {
+  char magic[8];
+  int version;
+  int numNodes;
+  int numElements;
+  int numSPs;
+  int numMPs;
+  int numLoadPatterns;
+  long long numEntries;
+  long long indexOffset;
+  double time;
+  double check;            // 1.0, to detect a different byte order
+};
+
+struct ModelFileEntry {
+  int type;                // 0 Message, 1 ID, 2 Vector, 3 Matrix
+  int size;
+  int dbTag;
+  int commitTag;
+  long long offset;
+  long long numBytes;
+};
+
+class ModelFile: public FE_Datastore
+{
+  public:
+    ModelFile(const char *fileName,
+	      Domain &theDomain, 
+	      FEM_ObjectBroker &theBroker);
+    
+    ~ModelFile();
+
+    // write the domain to the file, read the domain from the file
+    int save(void);
+    int load(void);
+
+    // methods for sending and receiving the data
+    int sendMsg(int dbTag, int commitTag, 
+		const Message &, 
+		ChannelAddress *theAddress =0);    
+    int recvMsg(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+    int recvMsgUnknownSize(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+
+    int sendMatrix(int dbTag, int commitTag, 
+		   const Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag, 
+		   Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendVector(int dbTag, int commitTag, 
+		   const Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag, 
+		   Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendID(int dbTag, int commitTag,
+	       const ID &theID,
+	       ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag,
+	       ID &theID,
+	       ChannelAddress *theAddress =0);
+
+  private:
+    int append(int type, int size, int dbTag, int commitTag,
+	       const void *data, int numBytes);
+    const char *find(int type, int size, int dbTag, int commitTag, int numBytes);
+    int mapFile(void);
+    void unmapFile(void);
+
+    Domain *theDomain;
+    std::string fileName;
+
+    std::ofstream theFile;
+    long long fileSize;              // bytes written to the file
+    std::vector<ModelFileEntry> theEntries; // the records written
+
+    std::vector<double> values;      // the data of a Vector or Matrix
+    std::vector<int> ints;           // the data of an ID
+
+    char *mapped;                    // the memory mapped file
+    long long mappedSize;
+    const ModelFileEntry *theIndex;  // the index in the mapping
+    long long numEntries;
+#ifdef _WIN32
+    void *theFileHandle;
+    void *theMapping;
+#endif
+};
+
+#endif
@@ -46,6 +46,7 @@
 
 // known databases
 #include <FileDatastore.h>
+#include <LogDatastore.h>
 
 // linked list of struct for other types of
 // databases that can be added dynamically
@@ -123,6 +124,29 @@ TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **a
       return TCL_ERROR;
     } 
     
+    return TCL_OK;
+
+  // an append-only Log Database for checkpoints
+  } else if (strcmp(argv[1],"Log") == 0) {
+    if (argc < 3) {
+      opserr << "WARNING database Log fileName? <-compress>";
+      return TCL_ERROR;
+    }    
+
+    bool compress = false;
+    if (argc > 3 && strcmp(argv[3],"-compress") == 0)
+      compress = true;
+
+    // delete the old database
+    if (theDatabase != 0)
+      delete theDatabase;
+
+    theDatabase = new LogDatastore(argv[2], theDomain, theBroker, compress);
+    if (theDatabase == 0) {
+      opserr << "WARNING ran out of memory - database Log " << argv[2] << endln;
+      return TCL_ERROR;
+    } 
+    
     return TCL_OK;
   } else {
 
@@ -173,7 +197,7 @@ TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **a
     }
   }
   opserr << "WARNING No database type exists ";
-  opserr << "for database of type:" << argv[1] << "valid database type File\n";
+  opserr << "for database of type:" << argv[1] << "valid database type File, Log\n";
 
   return TCL_ERROR;
 }    
@@ -25,6 +25,7 @@
 #include <classTags.h>
 #include <Parameter.h>
 #include <DomainComponent.h>
+#include <Element.h>
 
 Parameter::Parameter(int passedTag,
 		     DomainComponent *parentObject,
@@ -185,6 +186,9 @@ Parameter::update(int newValue)
   for (int i = 0; i < numObjects; i++)
     ok += theObjects[i]->updateParameter(parameterID[i], theInfo);
 
+  // any matrices cached for linear elements may now be stale
+  Element::changeLinearStamp();
+
   return ok;
 }
 
@@ -198,6 +202,9 @@ Parameter::update(double newValue)
   for (int i = 0; i < numObjects; i++)
     ok += theObjects[i]->updateParameter(parameterID[i], theInfo);
   
+  // any matrices cached for linear elements may now be stale
+  Element::changeLinearStamp();
+
   return ok;
 }
 
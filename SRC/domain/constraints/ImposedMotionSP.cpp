@@ -67,6 +67,13 @@ ImposedMotionSP::~ImposedMotionSP()
 
 
 
+int
+ImposedMotionSP::getGroundMotionTag(void) const
+{
+  return groundMotionTag;
+}
+
+
 double
 ImposedMotionSP::getValue(void)
 {
@@ -118,8 +125,23 @@ ImposedMotionSP::applyConstraint(double time)
     return -1;
   
   // now get the response from the ground motion
-  theGroundMotionResponse = theGroundMotion->getDispVelAccel(time);
-  
+  return this->applyConstraint(time, theGroundMotion->getDispVelAccel(time));
+}
+
+
+// int applyConstraint(double time, const Vector &dispVelAccel);
+//	Method to apply a ground motion response already evaluated at time,
+//	e.g. by a MultiSupportPattern sharing it among many supports.
+
+int
+ImposedMotionSP::applyConstraint(double time, const Vector &dispVelAccel)
+{
+  // on first call the node and motion still need to be found
+  if (theNodeResponse == 0)
+    return this->applyConstraint(time);
+
+  theGroundMotionResponse = dispVelAccel;
+
   //
   // now set the responses at the node
   //
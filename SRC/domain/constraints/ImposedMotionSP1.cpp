@@ -100,6 +100,30 @@ ImposedMotionSP1::applyConstraint(double time)
 }
 
 
+// int applyConstraint(double time, const Vector &dispVelAccel);
+//	Method to use a ground motion response already evaluated at time,
+//	e.g. by a MultiSupportPattern sharing it among many supports.
+
+int
+ImposedMotionSP1::applyConstraint(double time, const Vector &dispVelAccel)
+{
+  // on first call the node and motion still need to be found
+  if (theGroundMotion == 0 || theNode == 0)
+    return this->applyConstraint(time);
+
+  theGroundMotionResponse = dispVelAccel;
+
+  return 0;
+}
+
+
+int
+ImposedMotionSP1::getGroundMotionTag(void) const
+{
+  return groundMotionTag;
+}
+
+
 bool
 ImposedMotionSP1::isHomogeneous(void) const
 {
@@ -51,6 +51,8 @@ class ImposedMotionSP1 : public SP_Constraint
     ~ImposedMotionSP1();
 
     int applyConstraint(double loadFactor);    
+    int applyConstraint(double time, const Vector &dispVelAccel);
+    int getGroundMotionTag(void) const;
     double getValue(void);
     bool isHomogeneous(void) const;
     
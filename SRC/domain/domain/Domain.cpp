@@ -34,6 +34,9 @@
 
 #include <stdlib.h>
 #include <math.h>
+#include <chrono>
+#include <vector>
+#include <algorithm>
 
 #include <OPS_Globals.h>
 #include <Domain.h>
@@ -79,6 +82,9 @@
 #include <Analysis.h>
 #include <FE_Datastore.h>
 #include <FEM_ObjectBroker.h>
+#include <PhaseProfiler.h>
+#include <ClassProfiler.h>
+#include <MemoryReport.h>
 
 //
 // global variables
@@ -90,6 +96,8 @@ bool          ops_InitialStateAnalysis = false;
 
 Domain::Domain()
 :theRecorders(0), numRecorders(0),
+ maxRecorderOverhead(0.0), firstRecordTime(-1.0), windowStartTime(-1.0), windowRecordTime(0.0),
+ numWindowRecords(0), lowPriorityDecimation(1), warnedNoLowPriority(false),
  currentTime(0.0), committedTime(0.0), dT(0.0), currentGeoTag(0),
  hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1),
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
@@ -145,6 +153,8 @@ Domain::Domain()
 Domain::Domain(int numNodes, int numElements, int numSPs, int numMPs,
 	       int numLoadPatterns)
 :theRecorders(0), numRecorders(0),
+ maxRecorderOverhead(0.0), firstRecordTime(-1.0), windowStartTime(-1.0), windowRecordTime(0.0),
+ numWindowRecords(0), lowPriorityDecimation(1), warnedNoLowPriority(false),
  currentTime(0.0), committedTime(0.0), dT(0.0), currentGeoTag(0),
  hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1),
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
@@ -200,6 +210,8 @@ Domain::Domain(TaggedObjectStorage &theNodesStorage,
 	       TaggedObjectStorage &theSPsStorage,
 	       TaggedObjectStorage &theLoadPatternsStorage)
 :theRecorders(0), numRecorders(0),
+ maxRecorderOverhead(0.0), firstRecordTime(-1.0), windowStartTime(-1.0), windowRecordTime(0.0),
+ numWindowRecords(0), lowPriorityDecimation(1), warnedNoLowPriority(false),
  currentTime(0.0), committedTime(0.0), dT(0.0), currentGeoTag(0),
  hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1),
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
@@ -263,6 +275,8 @@ Domain::Domain(TaggedObjectStorage &theNodesStorage,
 
 Domain::Domain(TaggedObjectStorage &theStorage)
 :theRecorders(0), numRecorders(0),
+ maxRecorderOverhead(0.0), firstRecordTime(-1.0), windowStartTime(-1.0), windowRecordTime(0.0),
+ numWindowRecords(0), lowPriorityDecimation(1), warnedNoLowPriority(false),
  currentTime(0.0), committedTime(0.0), dT(0.0), currentGeoTag(0),
  hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1),
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
@@ -532,16 +546,7 @@ Domain::addSP_Constraint(SP_Constraint *spConstraint)
     // #endif
 
     // check if an existing SP_COnstraint exists for that dof at the node
-    bool found = false;
-    SP_ConstraintIter &theExistingSPs = this->getSPs();
-    SP_Constraint *theExistingSP = 0;
-    while ((found == false) && ((theExistingSP = theExistingSPs()) != 0)) {
-      int spNodeTag = theExistingSP->getNodeTag();
-      int spDof = theExistingSP->getDOF_Number();
-      if (nodeTag == spNodeTag && spDof == dof) {
-	found = true;
-      }
-    }
+    bool found = (theSP_Dofs.find(std::make_pair(nodeTag, dof)) != theSP_Dofs.end());
     
     if (found == true) {
 	opserr << "Domain::addSP_Constraint - cannot add as node already constrained in that dof by existing SP_Constraint\n";
@@ -567,6 +572,8 @@ Domain::addSP_Constraint(SP_Constraint *spConstraint)
       return false;
   } 
 
+  theSP_Dofs.insert(std::make_pair(nodeTag, dof));
+
   spConstraint->setDomain(this);
   this->domainChange();  
 
@@ -939,6 +946,7 @@ Domain::clearAll(void) {
   theElements->clearAll();
   theNodes->clearAll();
   theSPs->clearAll();
+  theSP_Dofs.clear();
   thePCs->clearAll();
   theMPs->clearAll();
   theLoadPatterns->clearAll();
@@ -957,6 +965,15 @@ Domain::clearAll(void) {
     theRecorders = 0;
   }
 
+  // and the recorder overhead budget, a new model starts without one
+  maxRecorderOverhead = 0.0;
+  firstRecordTime = -1.0;
+  windowStartTime = -1.0;
+  windowRecordTime = 0.0;
+  numWindowRecords = 0;
+  lowPriorityDecimation = 1;
+  warnedNoLowPriority = false;
+
   for (i=0; i<numRegions; i++)
     delete theRegions[i];
   numRegions = 0;
@@ -1118,6 +1135,7 @@ Domain::removeSP_Constraint(int tag)
     // and return the result of the cast    
     SP_Constraint *result = (SP_Constraint *)mc;
     // result->setDomain(0);
+    theSP_Dofs.erase(std::make_pair(result->getNodeTag(), result->getDOF_Number()));
 
     // should check that theLoad and result are the same    
     return result;
@@ -1863,12 +1881,8 @@ Domain::setRayleighDampingFactors(double alphaM, double betaK, double betaK0, do
 int
 Domain::record(bool fromAnalysis)
 {
-  int res = 0;
-
   // invoke record on all recorders
-  for (int i=0; i<numRecorders; i++)
-    if (theRecorders[i] != 0)
-      res += theRecorders[i]->record(commitTag, currentTime);
+  int res = this->invokeRecorders();
   
   // update the commitTag
   commitTag++;
@@ -1888,10 +1902,14 @@ Domain::commit(void)
       nodePtr->commitState();
     }
 
+    // elements whose trial state is the committed state are skipped
     Element *elePtr;
     ElementIter &theElemIter = this->getElements();    
     while ((elePtr = theElemIter()) != 0) {
-      elePtr->commitState();
+      if (elePtr->hasTrialStateChanged() == true) {
+	ClassTimer theTimer(CLASS_PROFILE_COMMIT, elePtr);
+	elePtr->commitState();
+      }
     }
 
     // set the new committed time in the domain
@@ -1899,15 +1917,226 @@ Domain::commit(void)
     dT = 0.0;
 
     // invoke record on all recorders
-    for (int i=0; i<numRecorders; i++)
-      if (theRecorders[i] != 0)
-	theRecorders[i]->record(commitTag, currentTime);
+    this->invokeRecorders();
 
     // update the commitTag
     commitTag++;
     return 0;
 }
 
+static double
+recorderClock(void)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int
+Domain::invokeRecorders(void)
+{
+  if (numRecorders == 0)
+    return 0;
+
+  PhaseTimer theTimer(PROFILE_RECORD);
+
+  if (firstRecordTime < 0.0)
+    firstRecordTime = recorderClock();
+
+  int res = 0;
+  if (maxRecorderOverhead <= 0.0) {
+    for (int i=0; i<numRecorders; i++)
+      if (theRecorders[i] != 0)
+	res += theRecorders[i]->recordTimed(commitTag, currentTime);
+    return res;
+  }
+
+  double start = recorderClock();
+  if (windowStartTime < 0.0)
+    windowStartTime = start;
+
+  for (int i=0; i<numRecorders; i++)
+    if (theRecorders[i] != 0)
+      res += theRecorders[i]->recordTimed(commitTag, currentTime);
+
+  double end = recorderClock();
+  windowRecordTime += end - start;
+  numWindowRecords++;
+
+  // at the end of a window compare the time recording to the time elapsed,
+  // a window covering at least 10 records of the low priority recorders
+  if (numWindowRecords < 10*lowPriorityDecimation || end <= windowStartTime)
+    return res;
+
+  double overhead = windowRecordTime/(end - windowStartTime);
+  int decimation = lowPriorityDecimation;
+  if (overhead > maxRecorderOverhead && decimation < 1024)
+    decimation *= 2;
+  else if (overhead < 0.5*maxRecorderOverhead && decimation > 1)
+    decimation /= 2;
+
+  windowStartTime = end;
+  windowRecordTime = 0.0;
+  numWindowRecords = 0;
+
+  if (decimation == lowPriorityDecimation)
+    return res;
+
+  int numLowPriority = 0;
+  for (int i=0; i<numRecorders; i++)
+    if (theRecorders[i] != 0 && theRecorders[i]->isLowPriority() == true) {
+      theRecorders[i]->setDecimation(decimation);
+      numLowPriority++;
+    }
+
+  if (numLowPriority == 0) {
+    if (warnedNoLowPriority == false)
+      opserr << "WARNING Domain - recorders take " << overhead << " of the analysis time, no low priority recorders to decimate\n";
+    warnedNoLowPriority = true;
+    return res;
+  }
+
+  lowPriorityDecimation = decimation;
+
+  return res;
+}
+
+int
+Domain::setRecorderMaxOverhead(double maxOverhead)
+{
+  if (maxOverhead < 0.0)
+    maxOverhead = 0.0;
+
+  maxRecorderOverhead = maxOverhead;
+  windowStartTime = -1.0;
+  windowRecordTime = 0.0;
+  numWindowRecords = 0;
+  warnedNoLowPriority = false;
+
+  // no budget, so no decimation
+  if (maxOverhead == 0.0) {
+    lowPriorityDecimation = 1;
+    for (int i=0; i<numRecorders; i++)
+      if (theRecorders[i] != 0)
+	theRecorders[i]->setDecimation(1);
+  }
+
+  return 0;
+}
+
+int
+Domain::setRecorderLowPriority(int tag, bool onOff)
+{
+  for (int i=0; i<numRecorders; i++) {
+    if (theRecorders[i] != 0 && theRecorders[i]->getTag() == tag) {
+      theRecorders[i]->setLowPriority(onOff);
+      theRecorders[i]->setDecimation(onOff == true ? lowPriorityDecimation : 1);
+      return 0;
+    }
+  }
+
+  opserr << "WARNING Domain::setRecorderLowPriority() - no recorder with tag " << tag << endln;
+  return -1;
+}
+
+void
+Domain::resetRecorderCosts(void)
+{
+  for (int i=0; i<numRecorders; i++)
+    if (theRecorders[i] != 0)
+      theRecorders[i]->resetCost();
+
+  firstRecordTime = -1.0;
+}
+
+int
+Domain::getRecorderCosts(Vector &data)
+{
+  // tag, calls, skipped, time, bytes, flush time for each recorder
+  int numActive = 0;
+  for (int i=0; i<numRecorders; i++)
+    if (theRecorders[i] != 0)
+      numActive++;
+
+  data.resize(6*numActive);
+  int loc = 0;
+  for (int i=0; i<numRecorders; i++) {
+    Recorder *theRecorder = theRecorders[i];
+    if (theRecorder == 0)
+      continue;
+    OPS_Stream *theStream = theRecorder->getOutputStream();
+    data(loc++) = theRecorder->getTag();
+    data(loc++) = theRecorder->getNumCalls();
+    data(loc++) = theRecorder->getNumSkipped();
+    data(loc++) = theRecorder->getRecordTime();
+    data(loc++) = (theStream != 0) ? (double)theStream->getNumBytes() : 0.0;
+    data(loc++) = (theStream != 0) ? theStream->getFlushTime() : 0.0;
+  }
+
+  return numActive;
+}
+
+static bool
+moreRecordTime(Recorder *a, Recorder *b)
+{
+  return a->getRecordTime() > b->getRecordTime();
+}
+
+void
+Domain::printRecorderCosts(OPS_Stream &s, int numMax)
+{
+  std::vector<Recorder *> active;
+  double totalTime = 0.0;
+  for (int i=0; i<numRecorders; i++)
+    if (theRecorders[i] != 0 && theRecorders[i]->getNumCalls() != 0) {
+      active.push_back(theRecorders[i]);
+      totalTime += theRecorders[i]->getRecordTime();
+    }
+
+  if (active.empty())
+    return;
+
+  double elapsed = (firstRecordTime < 0.0) ? 0.0 : recorderClock() - firstRecordTime;
+  s << "Recorder costs: " << (int)active.size() << " recorders, " << totalTime << " sec recording";
+  if (elapsed > 0.0)
+    s << " (" << 100.0*totalTime/elapsed << "% of " << elapsed << " sec)";
+  s << endln;
+
+  std::stable_sort(active.begin(), active.end(), moreRecordTime);
+  int numPrint = (int)active.size();
+  if (numMax > 0 && numMax < numPrint)
+    numPrint = numMax;
+
+  for (int i=0; i<numPrint; i++) {
+    Recorder *theRecorder = active[i];
+    OPS_Stream *theStream = theRecorder->getOutputStream();
+    s << "  recorder " << theRecorder->getTag() << ": calls " << theRecorder->getNumCalls();
+    if (theRecorder->getNumSkipped() != 0)
+      s << " skipped " << theRecorder->getNumSkipped();
+    s << " time " << theRecorder->getRecordTime();
+    if (theStream != 0)
+      s << " bytes " << (double)theStream->getNumBytes() << " flush " << theStream->getFlushTime();
+    if (theRecorder->isLowPriority() == true)
+      s << " (low priority)";
+    s << endln;
+  }
+
+  if (numPrint < (int)active.size())
+    s << "  ... " << (int)active.size() - numPrint << " more\n";
+}
+
+void
+Domain::reportMemory(MemoryReport &theReport)
+{
+  Node *nodePtr;
+  NodeIter &theNodeIter = this->getNodes();
+  while ((nodePtr = theNodeIter()) != 0)
+    nodePtr->reportMemory(theReport);
+
+  Element *elePtr;
+  ElementIter &theEleIter = this->getElements();
+  while ((elePtr = theEleIter()) != 0)
+    elePtr->reportMemory(theReport);
+}
+
 int
 Domain::revertToLastCommit(void)
 {
@@ -1923,6 +2152,7 @@ Domain::revertToLastCommit(void)
     Element *elePtr;
     ElementIter &theElemIter = this->getElements();    
     while ((elePtr = theElemIter()) != 0) {
+      if (elePtr->hasTrialStateChanged() == true)
 	elePtr->revertToLastCommit();
     }
 
@@ -1987,6 +2217,7 @@ Domain::update(void)
 
   while ((theEle = theEles()) != 0) {
     ops_TheActiveElement = theEle;
+    ClassTimer theTimer(CLASS_PROFILE_UPDATE, theEle);
     ok += theEle->update();
   }
 
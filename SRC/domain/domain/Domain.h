@@ -38,6 +38,8 @@
 
 #include <OPS_Stream.h>
 #include <Vector.h>
+#include <set>
+#include <utility>
 
 class Element;
 class Node;
@@ -67,6 +69,7 @@ class SingleDomParamIter;
 
 class MeshRegion;
 class Recorder;
+class MemoryReport;
 class Graph;
 class NodeGraph;
 class ElementGraph;
@@ -213,6 +216,19 @@ class Domain
     virtual int  removeRecorder(int tag);
     virtual int  record(bool fromAnalysis=true);
 
+    // recorder cost accounting; when the recorders take more than
+    // maxOverhead of the time between records the low priority ones
+    // are decimated
+    int  setRecorderMaxOverhead(double maxOverhead);
+    int  setRecorderLowPriority(int tag, bool onOff = true);
+    void resetRecorderCosts(void);
+    int  getRecorderCosts(Vector &data);
+    void printRecorderCosts(OPS_Stream &s, int numMax = 0);
+
+    // adds the heap used by the nodes and the elements, the elements
+    // adding that of their sections and materials
+    void reportMemory(MemoryReport &theReport);
+
     virtual int  addRegion(MeshRegion &theRegion);    	
     virtual MeshRegion *getRegion(int region);    	
     virtual void getRegionTags(ID& rtags) const;
@@ -237,9 +253,19 @@ class Domain
     virtual int buildEleGraph(Graph *theEleGraph);
     virtual int buildNodeGraph(Graph *theNodeGraph);
 
+    int invokeRecorders(void);
+
     Recorder **theRecorders;
     int numRecorders;    
 
+    double maxRecorderOverhead;  // fraction of time, 0.0 if no budget
+    double firstRecordTime;      // seconds, -1.0 if nothing recorded
+    double windowStartTime;      // the overhead is measured in windows
+    double windowRecordTime;
+    int numWindowRecords;
+    int lowPriorityDecimation;
+    bool warnedNoLowPriority;
+
   private:
     double currentTime;               // current pseudo time
     double committedTime;             // the committed pseudo time
@@ -264,6 +290,8 @@ class Domain
     TaggedObjectStorage  *theLoadPatterns;        
     TaggedObjectStorage  *theParameters;        
 
+    std::set<std::pair<int,int> > theSP_Dofs; // node tag and dof of the SP_Constraints
+
     SingleDomEleIter      *theEleIter;
     SingleDomNodIter  	  *theNodIter;
     SingleDomSP_Iter      *theSP_Iter;
@@ -58,9 +58,11 @@
 
 #include <OPS_Globals.h>
 #include <elementAPI.h>
+#include <MemoryReport.h>
 
 Matrix **Node::theMatrices = 0;
 int Node::numMatrices = 0;
+int Node::inertiaStamp = 0;
 
 int OPS_Node()
 {
@@ -1298,6 +1300,8 @@ Node::setMass(const Matrix &newMass)
 	return -1;
     }	
 
+    inertiaStamp++;
+
     // create a matrix if no mass yet set
     if (mass == 0) {
 	mass = new Matrix(newMass);
@@ -1679,6 +1683,7 @@ Node::recvSelf(int cTag, Channel &theChannel,
 	opserr << "Node::recvSelf() - failed to receive Mass data\n";
 	return -6;
       }
+      inertiaStamp++;
     }            
     
     if (data(12) == 0) {
@@ -1747,7 +1752,28 @@ Node::recvSelf(int cTag, Channel &theChannel,
   return 0;
 }
 
+void
+Node::reportMemory(MemoryReport &theReport)
+{
+  size_t bytes = sizeof(Node);
+
+  // disp, vel and accel hold the data of the Vectors made from them
+  if (disp != 0)
+    bytes += 4*numberDOF*sizeof(double) + 4*sizeof(Vector);
+  if (vel != 0)
+    bytes += 2*numberDOF*sizeof(double) + 2*sizeof(Vector);
+  if (accel != 0)
+    bytes += 2*numberDOF*sizeof(double) + 2*sizeof(Vector);
+
+  bytes += MemoryReport::bytes(Crd) + MemoryReport::bytes(unbalLoad);
+  bytes += MemoryReport::bytes(R) + MemoryReport::bytes(mass);
+  bytes += MemoryReport::bytes(unbalLoadWithInertia) + MemoryReport::bytes(theEigenvectors);
+  bytes += MemoryReport::bytes(dispSensitivity) + MemoryReport::bytes(velSensitivity);
+  bytes += MemoryReport::bytes(accSensitivity) + MemoryReport::bytes(reaction);
+  bytes += MemoryReport::bytes(displayLocation);
 
+  theReport.add(*this, bytes);
+}
 
 void
 Node::Print(OPS_Stream &s, int flag)
@@ -2013,6 +2039,9 @@ Node::setParameter(const char **argv, int argc, Parameter &param)
 int
 Node::updateParameter(int pparameterID, Information &info)
 {
+  if (pparameterID >= 1 && pparameterID <= 8)
+    inertiaStamp++;
+
   if (pparameterID >= 1 && pparameterID <= 3)
     (*mass)(pparameterID-1,pparameterID-1) = info.theDouble;
 
@@ -2247,6 +2276,8 @@ Node::getResponse(NodeResponseType responseType)
 void
 Node::setCrds(double Crd1)
 {
+  inertiaStamp++;
+
   if (Crd != 0 && Crd->Size() >= 1)
     (*Crd)(0) = Crd1;
 
@@ -2262,6 +2293,8 @@ Node::setCrds(double Crd1)
 void
 Node::setCrds(double Crd1, double Crd2)
 {
+  inertiaStamp++;
+
   if (Crd != 0 && Crd->Size() >= 2) {
     (*Crd)(0) = Crd1;
     (*Crd)(1) = Crd2;
@@ -2279,6 +2312,8 @@ Node::setCrds(double Crd1, double Crd2)
 void
 Node::setCrds(double Crd1, double Crd2, double Crd3)
 {
+  inertiaStamp++;
+
   if (Crd != 0 && Crd->Size() >= 3) {
     (*Crd)(0) = Crd1;
     (*Crd)(1) = Crd2;
@@ -2297,6 +2332,8 @@ Node::setCrds(double Crd1, double Crd2, double Crd3)
 void
 Node::setCrds(const Vector &newCrds) 
 {
+  inertiaStamp++;
+
   if (Crd != 0 && Crd->Size() == newCrds.Size()) {
     (*Crd) = newCrds;
 
@@ -46,6 +46,7 @@ class Vector;
 class Matrix;
 class Channel;
 class Renderer;
+class MemoryReport;
 
 class DOF_Group;
 class NodalThermalAction; //L.Jiang [ SIF ]
@@ -129,6 +130,7 @@ class Node : public DomainComponent
 			 FEM_ObjectBroker &theBroker);
     virtual void Print(OPS_Stream &s, int flag = 0);
     virtual int displaySelf(Renderer &theRenderer, int displayMode, float fact);
+    void reportMemory(MemoryReport &theReport);
 
     // AddingSensitivity:BEGIN /////////////////////////////////////////
     int addInertiaLoadSensitivityToUnbalance(const Vector &accel, 
@@ -165,6 +167,10 @@ class Node : public DomainComponent
     virtual void setCrds(double Crd1, double Crd2, double Crd3);
     virtual void setCrds(const Vector &);
 
+    // changes each time the mass or coordinates of any node are changed,
+    // for those caching the inertia terms of the nodes
+    static int getInertiaStamp(void) {return inertiaStamp;};
+
   protected:
 
   private:
@@ -208,6 +214,7 @@ class Node : public DomainComponent
     static int numMatrices;
     static Matrix **theVectors;
     static int numVectors;
+    static int inertiaStamp;
     int index;
 
     Vector *reaction;
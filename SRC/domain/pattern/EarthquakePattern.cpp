@@ -44,7 +44,8 @@
 #include <stdlib.h>
 
 EarthquakePattern::EarthquakePattern(int tag, int _classTag)
-  :LoadPattern(tag, _classTag), theMotions(0), numMotions(0), uDotG(0), uDotDotG(0), currentTime(0.0), parameterID(0)
+  :LoadPattern(tag, _classTag), theMotions(0), numMotions(0), uDotG(0), uDotDotG(0), currentTime(0.0),
+   domainStamp(-1), inertiaStamp(-1), numMassNodes(0), theMassNodes(0), theNodalMR(0), parameterID(0)
 {
 
 }
@@ -65,6 +66,15 @@ EarthquakePattern::~EarthquakePattern()
 
   if (uDotDotG != 0)
     delete uDotDotG;
+
+  if (theNodalMR != 0) {
+    for (int i=0; i<numMassNodes*numMotions; i++)
+      delete theNodalMR[i];
+    delete [] theNodalMR;
+  }
+
+  if (theMassNodes != 0)
+    delete [] theMassNodes;
 }
 
 
@@ -91,17 +101,84 @@ EarthquakePattern::applyLoad(double time)
     (*uDotDotG)(i) = theMotions[i]->getAccel(currentTime);
   }
 
-  NodeIter &theNodes = theDomain->getNodes();
-  Node *theNode;
-  while ((theNode = theNodes()) != 0) 
-    theNode->addInertiaLoadToUnbalance(*uDotDotG, 1.0);
-  
+  // the nodal M*R only change with the domain and the nodal mass and
+  // coordinates (setMass, updateParameter), form them if these have
+  int stamp = theDomain->hasDomainChanged();
+  if (stamp != domainStamp || Node::getInertiaStamp() != inertiaStamp) {
+    this->formNodalMR(theDomain);
+    domainStamp = stamp;
+    inertiaStamp = Node::getInertiaStamp();
+  }
+
+  // add -M*R*accelG at the nodes with mass
+  for (int i=0; i<numMassNodes; i++) {
+    Node *theNode = theMassNodes[i];
+    for (int j=0; j<numMotions; j++) {
+      double accelG = (*uDotDotG)(j);
+      if (accelG != 0.0)
+	theNode->addUnbalancedLoad(*theNodalMR[i*numMotions+j], -accelG);
+    }
+  }
 
   ElementIter &theElements = theDomain->getElements();
   Element *theElement;
   while ((theElement = theElements()) != 0) 
     theElement->addInertiaLoadToUnbalance(*uDotDotG);
 }
+
+int
+EarthquakePattern::formNodalMR(Domain *theDomain)
+{
+  // remove the old
+  if (theNodalMR != 0) {
+    for (int i=0; i<numMassNodes*numMotions; i++)
+      delete theNodalMR[i];
+    delete [] theNodalMR;
+  }
+  if (theMassNodes != 0)
+    delete [] theMassNodes;
+
+  numMassNodes = 0;
+  theMassNodes = 0;
+  theNodalMR = 0;
+
+  int numNodes = theDomain->getNumNodes();
+  if (numNodes == 0 || numMotions == 0)
+    return 0;
+
+  theMassNodes = new Node *[numNodes];
+  theNodalMR = new Vector *[numNodes*numMotions];
+
+  // form M*R one column at a time, only keeping nodes it is nonzero for
+  Vector unitAccel(numMotions);
+  NodeIter &theNodes = theDomain->getNodes();
+  Node *theNode;
+  while ((theNode = theNodes()) != 0) {
+    const Matrix &mass = theNode->getMass();
+    int numDOF = theNode->getNumberDOF();
+    bool hasMR = false;
+
+    for (int j=0; j<numMotions; j++) {
+      unitAccel.Zero();
+      unitAccel(j) = 1.0;
+      Vector *theMR = new Vector(numDOF);
+      theMR->addMatrixVector(0.0, mass, theNode->getRV(unitAccel), 1.0);
+      theNodalMR[numMassNodes*numMotions+j] = theMR;
+      if (theMR->Norm() != 0.0)
+	hasMR = true;
+    }
+
+    if (hasMR == true) {
+      theMassNodes[numMassNodes] = theNode;
+      numMassNodes++;
+    } else {
+      for (int j=0; j<numMotions; j++)
+	delete theNodalMR[numMassNodes*numMotions+j];
+    }
+  }
+
+  return 0;
+}
     
 void 
 EarthquakePattern::applyLoadSensitivity(double time)
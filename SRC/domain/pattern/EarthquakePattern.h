@@ -38,6 +38,8 @@
 
 class GroundMotion;
 class Vector;
+class Node;
+class Domain;
 
 class EarthquakePattern : public LoadPattern
 {
@@ -72,9 +74,19 @@ class EarthquakePattern : public LoadPattern
     int numMotions;
 
   private:
+    int formNodalMR(Domain *theDomain);
+
     Vector *uDotG, *uDotDotG;
     double currentTime;
 
+    // the nodal M*R columns, formed again when the domain or the mass or
+    // coordinates of a node have changed
+    int domainStamp;
+    int inertiaStamp;
+    int numMassNodes;
+    Node **theMassNodes;
+    Vector **theNodalMR;     // numMassNodes*numMotions columns
+
 // AddingSensitivity:BEGIN //////////////////////////////////////////
     int parameterID;
 // AddingSensitivity:END ///////////////////////////////////////////
@@ -35,6 +35,9 @@
 #include <Domain.h>
 #include <SP_Constraint.h>
 #include <SP_ConstraintIter.h>
+#include <ImposedMotionSP.h>
+#include <ImposedMotionSP1.h>
+#include <classTags.h>
 #include <stdlib.h>
 #include <Channel.h>
 #include <ErrorHandler.h>
@@ -99,10 +102,40 @@ MultiSupportPattern::~MultiSupportPattern()
 void 
 MultiSupportPattern::applyLoad(double time)
 {
+  // evaluate each ground motion once, all the supports it drives share it
+  if (numMotions > 0 && theResponses.noRows() != numMotions)
+    theResponses.resize(numMotions, 3);
+
+  for (int i=0; i<numMotions; i++) {
+    const Vector &dispVelAccel = theMotions[i]->getDispVelAccel(time);
+    for (int j=0; j<3; j++)
+      theResponses(i,j) = dispVelAccel(j);
+  }
+
+  static Vector dispVelAccel(3);
+
   SP_Constraint *sp;
   SP_ConstraintIter &theIter = this->getSPs();
   while ((sp = theIter()) != 0) {
-    sp->applyConstraint(time);
+    int spClassTag = sp->getClassTag();
+    int loc = -1;
+    if (spClassTag == CNSTRNT_TAG_ImposedMotionSP)
+      loc = theMotionTags.getLocation(((ImposedMotionSP *)sp)->getGroundMotionTag());
+    else if (spClassTag == CNSTRNT_TAG_ImposedMotionSP1)
+      loc = theMotionTags.getLocation(((ImposedMotionSP1 *)sp)->getGroundMotionTag());
+
+    if (loc < 0) {
+      sp->applyConstraint(time);
+      continue;
+    }
+
+    for (int j=0; j<3; j++)
+      dispVelAccel(j) = theResponses(loc,j);
+
+    if (spClassTag == CNSTRNT_TAG_ImposedMotionSP)
+      ((ImposedMotionSP *)sp)->applyConstraint(time, dispVelAccel);
+    else
+      ((ImposedMotionSP1 *)sp)->applyConstraint(time, dispVelAccel);
   }
 }
     
@@ -33,6 +33,7 @@
 
 #include <LoadPattern.h>
 #include <ID.h>
+#include <Matrix.h>
 
 class GroundMotion;
 class Vector;
@@ -68,6 +69,8 @@ class MultiSupportPattern : public LoadPattern
     ID theMotionTags;
     int numMotions;
     int dbMotions;
+
+    Matrix theResponses;   // disp, vel & accel of each motion at current time
 };
 
 #endif
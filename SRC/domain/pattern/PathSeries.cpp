@@ -43,8 +43,10 @@ using std::ifstream;
 using std::ios;
 
 #include <PathTimeSeries.h>
+#include <TimeSeriesFile.h>
 #include <elementAPI.h>
 #include <string>
+#include <string.h>
 
 void* OPS_PathSeries()
 {
@@ -223,7 +225,8 @@ void* OPS_PathSeries()
 
 PathSeries::PathSeries()	
   :TimeSeries(TSERIES_TAG_PathSeries),
-   thePath(0), pathTimeIncr(0.0), cFactor(0.0), otherDbTag(0), lastSendCommitTag(-1)
+   thePath(0), pathTimeIncr(0.0), cFactor(0.0), otherDbTag(0), lastSendCommitTag(-1),
+   theMapping(0), mappedFile(0)
 {
   // does nothing
 }
@@ -237,7 +240,8 @@ PathSeries::PathSeries(int tag,
                double tStart)
   :TimeSeries(tag, TSERIES_TAG_PathSeries),
    thePath(0), pathTimeIncr(theTimeIncr), cFactor(theFactor),
-   otherDbTag(0), lastSendCommitTag(-1), useLast(last), startTime(tStart)
+   otherDbTag(0), lastSendCommitTag(-1), useLast(last), startTime(tStart),
+   theMapping(0), mappedFile(0)
 {
   // create a copy of the vector containg path points
   if (prependZero == false) {
@@ -267,8 +271,39 @@ PathSeries::PathSeries(int tag,
                double tStart)
   :TimeSeries(tag, TSERIES_TAG_PathSeries),
    thePath(0), pathTimeIncr(theTimeIncr), cFactor(theFactor),
-   otherDbTag(0), lastSendCommitTag(-1), useLast(last), startTime(tStart)
+   otherDbTag(0), lastSendCommitTag(-1), useLast(last), startTime(tStart),
+   theMapping(0), mappedFile(0)
 {
+  // a binary file is mapped and used in place
+  if (TimeSeriesFile::isBinary(fileName)) {
+    int numRows, numCols;
+    double dt;
+    const double *data = TimeSeriesFile::open(fileName, numRows, numCols, dt);
+    if (data == 0)
+      return;
+
+    if (numCols != 1) {
+      opserr << "WARNING - PathSeries::PathSeries() - binary file " << fileName;
+      opserr << " holds " << numCols << " columns, PathSeries needs 1\n";
+      TimeSeriesFile::release(data);
+      return;
+    }
+
+    if (prependZero == true) {
+      thePath = new Vector(1 + numRows);
+      for (int i=0; i<numRows; i++)
+	(*thePath)(i+1) = data[i];
+      TimeSeriesFile::release(data);
+    } else {
+      // the mapping is read only, the Vector is never written to
+      thePath = new Vector((double *)data, numRows);
+      theMapping = data;
+      mappedFile = new char[strlen(fileName)+1];
+      strcpy(mappedFile, fileName);
+    }
+    return;
+  }
+
   // determine the number of data points .. open file and count num entries
   int numDataPoints = 0;
   double dataPoint;
@@ -334,10 +369,19 @@ PathSeries::~PathSeries()
 {
   if (thePath != 0)
     delete thePath;
+  if (theMapping != 0)
+    TimeSeriesFile::release(theMapping);
+  if (mappedFile != 0)
+    delete [] mappedFile;
 }
 
 TimeSeries *
 PathSeries::getCopy(void) {
+  // share the mapping
+  if (theMapping != 0)
+    return new PathSeries(this->getTag(), mappedFile, pathTimeIncr, cFactor,
+			  useLast, false, startTime);
+
   return new PathSeries(this->getTag(), *thePath, pathTimeIncr, cFactor,
                         useLast, false, startTime);
 }
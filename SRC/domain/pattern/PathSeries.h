@@ -87,6 +87,8 @@ class PathSeries : public TimeSeries
     int lastSendCommitTag;
     bool useLast;
     double startTime;
+    const double *theMapping; // data mapped from a binary file, 0 if none
+    char *mappedFile;         // name of the mapped file
 };
 
 #endif
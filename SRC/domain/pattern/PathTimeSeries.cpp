@@ -36,9 +36,11 @@
 
 
 #include <PathTimeSeries.h>
+#include <TimeSeriesFile.h>
 #include <Vector.h>
 #include <Channel.h>
 #include <math.h>
+#include <string.h>
 
 #include <fstream>
 using std::ifstream;
@@ -49,7 +51,8 @@ using std::ios;
 PathTimeSeries::PathTimeSeries()	
   :TimeSeries(TSERIES_TAG_PathTimeSeries),
    thePath(0), time(0), currentTimeLoc(0), cFactor(0.0),
-   dbTag1(0), dbTag2(0), lastSendCommitTag(-1)
+   dbTag1(0), dbTag2(0), lastSendCommitTag(-1),
+   mappedPath(0), mappedTime(0), mappedPathFile(0), mappedTimeFile(0)
 {
   // does nothing
 }
@@ -62,7 +65,8 @@ PathTimeSeries::PathTimeSeries(int tag,
   :TimeSeries(tag, TSERIES_TAG_PathTimeSeries),
    thePath(0), time(0), currentTimeLoc(0), cFactor(theFactor),
    dbTag1(0), dbTag2(0), lastSendCommitTag(-1), lastChannel(0),
-   useLast(last)
+   useLast(last),
+   mappedPath(0), mappedTime(0), mappedPathFile(0), mappedTimeFile(0)
 {
   // check vectors are of same size
   if (theLoadPath.Size() != theTimePath.Size()) {
@@ -97,8 +101,37 @@ PathTimeSeries::PathTimeSeries(int tag,
   :TimeSeries(tag, TSERIES_TAG_PathTimeSeries),
    thePath(0), time(0), currentTimeLoc(0), cFactor(theFactor),
    dbTag1(0), dbTag2(0), lastSendCommitTag(-1), lastChannel(0),
-   useLast(last)
+   useLast(last),
+   mappedPath(0), mappedTime(0), mappedPathFile(0), mappedTimeFile(0)
 {
+  // binary files are mapped and used in place
+  if (TimeSeriesFile::isBinary(filePathName) && TimeSeriesFile::isBinary(fileTimeName)) {
+    int numPath, numTime, numCols1, numCols2;
+    double dt;
+    mappedPath = TimeSeriesFile::open(filePathName, numPath, numCols1, dt);
+    mappedTime = TimeSeriesFile::open(fileTimeName, numTime, numCols2, dt);
+    if (mappedPath == 0 || mappedTime == 0 || numPath != numTime) {
+      if (mappedPath != 0 && mappedTime != 0) {
+	opserr << "WARNING PathTimeSeries::PathTimeSeries() - files containing data ";
+	opserr << "points for path and time do not contain same number of points\n";
+      }
+      TimeSeriesFile::release(mappedPath);
+      TimeSeriesFile::release(mappedTime);
+      mappedPath = 0;
+      mappedTime = 0;
+      return;
+    }
+
+    // the mappings are read only, the Vectors are never written to
+    thePath = new Vector((double *)mappedPath, numPath);
+    time = new Vector((double *)mappedTime, numTime);
+    mappedPathFile = new char[strlen(filePathName)+1];
+    strcpy(mappedPathFile, filePathName);
+    mappedTimeFile = new char[strlen(fileTimeName)+1];
+    strcpy(mappedTimeFile, fileTimeName);
+    return;
+  }
+
   // determine the number of data points
   int numDataPoints1 =0;
   int numDataPoints2 =0;
@@ -204,8 +237,33 @@ PathTimeSeries::PathTimeSeries(int tag,
 			       bool last)
   :TimeSeries(tag, TSERIES_TAG_PathTimeSeries),
    thePath(0), time(0), currentTimeLoc(0), cFactor(theFactor),
-   dbTag1(0), dbTag2(0), lastChannel(0), useLast(last)
+   dbTag1(0), dbTag2(0), lastChannel(0), useLast(last),
+   mappedPath(0), mappedTime(0), mappedPathFile(0), mappedTimeFile(0)
 {
+  // a binary file holding time and path columns is mapped and used in place
+  if (TimeSeriesFile::isBinary(fileName)) {
+    int numRows, numCols;
+    double dt;
+    mappedTime = TimeSeriesFile::open(fileName, numRows, numCols, dt);
+    if (mappedTime == 0)
+      return;
+
+    if (numCols != 2) {
+      opserr << "WARNING - PathTimeSeries::PathTimeSeries() - binary file " << fileName;
+      opserr << " holds " << numCols << " columns, time and path needed\n";
+      TimeSeriesFile::release(mappedTime);
+      mappedTime = 0;
+      return;
+    }
+
+    // the mapping is read only, the Vectors are never written to
+    time = new Vector((double *)mappedTime, numRows);
+    thePath = new Vector((double *)mappedTime + numRows, numRows);
+    mappedTimeFile = new char[strlen(fileName)+1];
+    strcpy(mappedTimeFile, fileName);
+    return;
+  }
+
   // determine the number of data points
   int numDataPoints = 0;
   double dataPoint;
@@ -286,11 +344,23 @@ PathTimeSeries::~PathTimeSeries()
     delete thePath;
   if (time != 0)
     delete time;
+  TimeSeriesFile::release(mappedPath);
+  TimeSeriesFile::release(mappedTime);
+  if (mappedPathFile != 0)
+    delete [] mappedPathFile;
+  if (mappedTimeFile != 0)
+    delete [] mappedTimeFile;
 }
 
 TimeSeries *
 PathTimeSeries::getCopy(void) 
 {
+  // share the mappings
+  if (mappedPathFile != 0)
+    return new PathTimeSeries(this->getTag(), mappedPathFile, mappedTimeFile, cFactor, useLast);
+  else if (mappedTimeFile != 0)
+    return new PathTimeSeries(this->getTag(), mappedTimeFile, cFactor, useLast);
+
   return new PathTimeSeries(this->getTag(), *thePath, *time, cFactor, useLast);
 }
 
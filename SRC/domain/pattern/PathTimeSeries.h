@@ -94,6 +94,8 @@ class PathTimeSeries : public TimeSeries
     int lastSendCommitTag;
     Channel *lastChannel;
     bool useLast;
+    const double *mappedPath, *mappedTime; // data mapped from binary files, 0 if none
+    char *mappedPathFile, *mappedTimeFile; // names of the mapped files
 };
 
 #endif
@@ -0,0 +1,377 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Purpose: This file contains the implementation of TimeSeriesFile.
+
+#include <TimeSeriesFile.h>
+#include <OPS_Globals.h>
+
+#include <string.h>
+#include <stdlib.h>
+#include <list>
+#include <string>
+#include <vector>
+#include <fstream>
+using std::ifstream;
+using std::ofstream;
+using std::ios;
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+static const char TSB_MAGIC[8] = {'O','P','S','T','S','B','1','\0'};
+
+struct TimeSeriesFileHeader {
+  char magic[8];
+  int numRows;
+  int numCols;
+  double dt;
+  double check;
+};
+
+struct TimeSeriesFileMapping {
+  std::string fileName;
+  void *base;
+  size_t length;
+  int refCount;
+  int numRows;             // as read from the mapped header
+  int numCols;
+  double dt;
+#ifdef _WIN32
+  HANDLE theFile;
+  HANDLE theMapping;
+  FILETIME modified;
+#else
+  ino_t inode;
+  time_t modified;
+#endif
+};
+
+// a file rewritten while mapped is mapped again, the old mapping is kept
+// until all using it have released it
+static std::list<TimeSeriesFileMapping> theMappings;
+
+
+static bool
+sameFile(const TimeSeriesFileMapping &a, const TimeSeriesFileMapping &b)
+{
+  if (a.fileName != b.fileName || a.length != b.length)
+    return false;
+#ifdef _WIN32
+  return (CompareFileTime(&a.modified, &b.modified) == 0);
+#else
+  return (a.inode == b.inode && a.modified == b.modified);
+#endif
+}
+
+
+static int
+readHeader(const char *fileName, TimeSeriesFileHeader &header)
+{
+  ifstream theFile(fileName, ios::in | ios::binary);
+  if (theFile.bad() || !theFile.is_open())
+    return -1;
+
+  theFile.read((char *)&header, sizeof(TimeSeriesFileHeader));
+  if (!theFile || memcmp(header.magic, TSB_MAGIC, 8) != 0)
+    return -1;
+
+  return 0;
+}
+
+
+bool
+TimeSeriesFile::isBinary(const char *fileName)
+{
+  TimeSeriesFileHeader header;
+  return (readHeader(fileName, header) == 0);
+}
+
+
+const double *
+TimeSeriesFile::open(const char *fileName, int &numRows, int &numCols, double &dt)
+{
+  TimeSeriesFileMapping theMapping;
+  theMapping.fileName = fileName;
+  theMapping.refCount = 1;
+
+#ifdef _WIN32
+  theMapping.theFile = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, NULL,
+				   OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (theMapping.theFile == INVALID_HANDLE_VALUE) {
+    opserr << "WARNING TimeSeriesFile::open() - could not open file " << fileName << endln;
+    return 0;
+  }
+
+  LARGE_INTEGER fileSize;
+  if (GetFileSizeEx(theMapping.theFile, &fileSize) == 0 ||
+      GetFileTime(theMapping.theFile, NULL, NULL, &theMapping.modified) == 0) {
+    opserr << "WARNING TimeSeriesFile::open() - could not open file " << fileName << endln;
+    CloseHandle(theMapping.theFile);
+    return 0;
+  }
+  theMapping.length = (size_t)fileSize.QuadPart;
+#else
+  int fd = ::open(fileName, O_RDONLY);
+  if (fd < 0) {
+    opserr << "WARNING TimeSeriesFile::open() - could not open file " << fileName << endln;
+    return 0;
+  }
+
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) != 0) {
+    opserr << "WARNING TimeSeriesFile::open() - could not open file " << fileName << endln;
+    close(fd);
+    return 0;
+  }
+  theMapping.length = (size_t)fileStat.st_size;
+  theMapping.inode = fileStat.st_ino;
+  theMapping.modified = fileStat.st_mtime;
+#endif
+
+  // if already mapped and not changed since share it
+  std::list<TimeSeriesFileMapping>::iterator it;
+  for (it = theMappings.begin(); it != theMappings.end(); it++) {
+    if (sameFile(*it, theMapping))
+      break;
+  }
+
+  if (it != theMappings.end()) {
+#ifdef _WIN32
+    CloseHandle(theMapping.theFile);
+#else
+    close(fd);
+#endif
+    it->refCount++;
+    numRows = it->numRows;
+    numCols = it->numCols;
+    dt = it->dt;
+    return (const double *)((char *)it->base + sizeof(TimeSeriesFileHeader));
+  }
+
+  if (theMapping.length < sizeof(TimeSeriesFileHeader)) {
+    opserr << "WARNING TimeSeriesFile::open() - " << fileName;
+    opserr << " is not a binary time series file\n";
+#ifdef _WIN32
+    CloseHandle(theMapping.theFile);
+#else
+    close(fd);
+#endif
+    return 0;
+  }
+
+#ifdef _WIN32
+  theMapping.theMapping = CreateFileMapping(theMapping.theFile, NULL, PAGE_READONLY, 0, 0, NULL);
+  theMapping.base = 0;
+  if (theMapping.theMapping != NULL)
+    theMapping.base = MapViewOfFile(theMapping.theMapping, FILE_MAP_READ, 0, 0, 0);
+  if (theMapping.base == 0) {
+    opserr << "WARNING TimeSeriesFile::open() - could not map file " << fileName << endln;
+    if (theMapping.theMapping != NULL)
+      CloseHandle(theMapping.theMapping);
+    CloseHandle(theMapping.theFile);
+    return 0;
+  }
+#else
+  theMapping.base = mmap(0, theMapping.length, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (theMapping.base == MAP_FAILED) {
+    opserr << "WARNING TimeSeriesFile::open() - could not map file " << fileName << endln;
+    return 0;
+  }
+#endif
+
+  // the sizes are those of the header mapped, not read separately, so
+  // they always match the data mapped
+  TimeSeriesFileHeader header;
+  memcpy(&header, theMapping.base, sizeof(TimeSeriesFileHeader));
+
+  const char *error = 0;
+  if (memcmp(header.magic, TSB_MAGIC, 8) != 0)
+    error = " is not a binary time series file\n";
+  else if (header.check != 1.0)
+    error = " was written on a machine of different byte order\n";
+  else if (header.numRows <= 0 || header.numCols <= 0)
+    error = " holds no data\n";
+  else if (theMapping.length < sizeof(TimeSeriesFileHeader) +
+	   sizeof(double)*(size_t)header.numRows*(size_t)header.numCols)
+    error = " is truncated\n";
+
+  if (error != 0) {
+    opserr << "WARNING TimeSeriesFile::open() - " << fileName << error;
+#ifdef _WIN32
+    UnmapViewOfFile(theMapping.base);
+    CloseHandle(theMapping.theMapping);
+    CloseHandle(theMapping.theFile);
+#else
+    munmap(theMapping.base, theMapping.length);
+#endif
+    return 0;
+  }
+
+  theMapping.numRows = numRows = header.numRows;
+  theMapping.numCols = numCols = header.numCols;
+  theMapping.dt = dt = header.dt;
+
+  theMappings.push_back(theMapping);
+
+  return (const double *)((char *)theMapping.base + sizeof(TimeSeriesFileHeader));
+}
+
+
+void
+TimeSeriesFile::release(const double *data)
+{
+  if (data == 0)
+    return;
+
+  std::list<TimeSeriesFileMapping>::iterator it;
+  for (it = theMappings.begin(); it != theMappings.end(); it++) {
+    char *base = (char *)it->base;
+    if ((const char *)data >= base && (const char *)data < base + it->length) {
+      it->refCount--;
+      if (it->refCount == 0) {
+#ifdef _WIN32
+	UnmapViewOfFile(it->base);
+	CloseHandle(it->theMapping);
+	CloseHandle(it->theFile);
+#else
+	munmap(it->base, it->length);
+#endif
+	theMappings.erase(it);
+      }
+      return;
+    }
+  }
+}
+
+
+int
+TimeSeriesFile::textToBinary(const char *inputFilename, const char *outputFilename, int numCols)
+{
+  ifstream input(inputFilename, ios::in);
+  if (input.bad() || !input.is_open()) {
+    opserr << "WARNING TimeSeriesFile::textToBinary() - could not open file ";
+    opserr << inputFilename << endln;
+    return -1;
+  }
+
+  if (numCols < 1)
+    numCols = 1;
+
+  double dt = 0.0;
+  int nPts = -1;
+
+  //
+  // a PEER AT2 file has 4 header lines, the last giving NPTS and DT either as
+  // "NPTS= 5000, DT= .0050 SEC" or as "5000 0.0050 NPTS, DT"
+  //
+
+  std::string line;
+  std::vector<std::string> firstLines;
+  for (int i=0; i<4 && std::getline(input, line); i++)
+    firstLines.push_back(line);
+
+  if (firstLines.size() == 4 && strstr(firstLines[3].c_str(), "NPTS") != 0) {
+    const char *c = firstLines[3].c_str();
+    const char *npts = strstr(c, "NPTS=");
+    if (npts != 0) {
+      nPts = atoi(npts+5);
+      const char *dtLoc = strstr(c, "DT=");
+      if (dtLoc != 0)
+	dt = strtod(dtLoc+3, 0);
+    } else {
+      char *next;
+      nPts = (int)strtol(c, &next, 10);
+      dt = strtod(next, 0);
+    }
+    numCols = 1;
+    firstLines.clear();
+  }
+
+  // read the numbers, any lines already read first
+  std::vector<double> values;
+  if (nPts > 0)
+    values.reserve(nPts);
+
+  for (size_t i=0; i<firstLines.size(); i++) {
+    const char *c = firstLines[i].c_str();
+    char *next;
+    double d = strtod(c, &next);
+    while (next != c) {
+      values.push_back(d);
+      c = next;
+      d = strtod(c, &next);
+    }
+  }
+
+  double d;
+  while (input >> d)
+    values.push_back(d);
+  input.close();
+
+  int numRows = (int)(values.size()/numCols);
+  if (nPts > 0 && nPts < numRows)
+    numRows = nPts;
+
+  if (numRows == 0) {
+    opserr << "WARNING TimeSeriesFile::textToBinary() - no data in file ";
+    opserr << inputFilename << endln;
+    return -1;
+  }
+
+  if (numRows*numCols != (int)values.size() && nPts <= 0) {
+    opserr << "WARNING TimeSeriesFile::textToBinary() - number of values in ";
+    opserr << inputFilename << " not a multiple of " << numCols << endln;
+  }
+
+  ofstream output(outputFilename, ios::out | ios::binary);
+  if (output.bad() || !output.is_open()) {
+    opserr << "WARNING TimeSeriesFile::textToBinary() - could not open file ";
+    opserr << outputFilename << endln;
+    return -1;
+  }
+
+  TimeSeriesFileHeader header;
+  memcpy(header.magic, TSB_MAGIC, 8);
+  header.numRows = numRows;
+  header.numCols = numCols;
+  header.dt = dt;
+  header.check = 1.0;
+  output.write((char *)&header, sizeof(TimeSeriesFileHeader));
+
+  // text rows become binary columns
+  std::vector<double> column(numRows);
+  for (int j=0; j<numCols; j++) {
+    for (int i=0; i<numRows; i++)
+      column[i] = values[i*numCols+j];
+    output.write((char *)&column[0], sizeof(double)*numRows);
+  }
+
+  output.close();
+
+  return 0;
+}
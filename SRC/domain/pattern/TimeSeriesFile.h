@@ -0,0 +1,64 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef TimeSeriesFile_h
+#define TimeSeriesFile_h
+
+// Description: This file contains the class definition for TimeSeriesFile.
+// TimeSeriesFile provides the binary time series file format read by
+// PathSeries and PathTimeSeries. The file is a 32 byte header:
+//
+//    char   magic[8]   "OPSTSB1"
+//    int    numRows    number of points
+//    int    numCols    1 (values) or 2 (time, values)
+//    double dt         time step if known, 0.0 otherwise
+//    double check      1.0, used to detect a file of the wrong byte order
+//
+// followed by the data stored column by column as native doubles. The
+// file is memory mapped read only on open, so a series can use a column
+// directly as the data of a Vector. Files are shared by name, opening a
+// file that is already open returns the same mapping and the sizes read
+// from its header when mapped. A file replaced or rewritten since (a new
+// inode, size or modification time) is mapped again; the series using
+// the old mapping keep it. Truncating a file in place while it is mapped
+// is not supported.
+
+class TimeSeriesFile
+{
+  public:
+    // returns true if the file starts with the binary header
+    static bool isBinary(const char *fileName);
+
+    // maps the file, returns a pointer to the first column or 0 on error
+    static const double *open(const char *fileName,
+			      int &numRows, int &numCols, double &dt);
+
+    // releases a pointer returned by open(), unmapping on last release
+    static void release(const double *data);
+
+    // writes the binary format from a text file; a PEER AT2 file is
+    // detected from its header, otherwise the file holds numCols
+    // values per row
+    static int textToBinary(const char *inputFilename,
+			    const char *outputFilename,
+			    int numCols = 1);
+};
+
+#endif
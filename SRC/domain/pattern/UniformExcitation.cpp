@@ -46,6 +46,8 @@
 
 void* OPS_TimeSeriesIntegrator();
 
+UniformExcitation *UniformExcitation::theRPattern = 0;
+
 void* OPS_UniformExcitationPattern()
 {
     if (OPS_GetNumRemainingInputArgs() < 2) {
@@ -190,7 +192,7 @@ void* OPS_UniformExcitationPattern()
 
 UniformExcitation::UniformExcitation()
 :EarthquakePattern(0, PATTERN_TAG_UniformExcitation), 
- theMotion(0), theDof(0), vel0(0.0), fact(0.0)
+ theMotion(0), theDof(0), vel0(0.0), fact(0.0), rStamp(-1), crdStamp(-1)
 {
 
 }
@@ -199,7 +201,8 @@ UniformExcitation::UniformExcitation()
 UniformExcitation::UniformExcitation(GroundMotion &_theMotion, 
 				     int dof, int tag, double velZero, double theFactor)
 :EarthquakePattern(tag, PATTERN_TAG_UniformExcitation), 
- theMotion(&_theMotion), theDof(dof), vel0(velZero), fact(theFactor)
+ theMotion(&_theMotion), theDof(dof), vel0(velZero), fact(theFactor),
+ rStamp(-1), crdStamp(-1)
 {
   // add the motion to the list of ground motions
   this->addMotion(*theMotion);
@@ -208,7 +211,8 @@ UniformExcitation::UniformExcitation(GroundMotion &_theMotion,
 
 UniformExcitation::~UniformExcitation()
 {
-
+  if (theRPattern == this)
+    theRPattern = 0;
 }
 
 
@@ -286,54 +290,63 @@ UniformExcitation::applyLoad(double time)
     if (theDomain == 0)
         return;
     
-    NodeIter &theNodes = theDomain->getNodes();
-    Node *theNode;
-    while ((theNode = theNodes()) != 0) {
-        theNode->setNumColR(1);
-        const Vector &crds=theNode->getCrds();
-        int ndm = crds.Size();
+    // R is constant, it need only be set again if the domain or the
+    // nodal coordinates have changed or another pattern has set it since
+    int stamp = theDomain->hasDomainChanged();
+    if (stamp != rStamp || Node::getInertiaStamp() != crdStamp || theRPattern != this) {
+        NodeIter &theNodes = theDomain->getNodes();
+        Node *theNode;
+        while ((theNode = theNodes()) != 0) {
+            theNode->setNumColR(1);
+            const Vector &crds=theNode->getCrds();
+            int ndm = crds.Size();
         
-        if (ndm == 1) {
-            theNode->setR(theDof, 0, fact);
-        }
-        else if (ndm == 2) {
-            if (theDof < 2) {
+            if (ndm == 1) {
                 theNode->setR(theDof, 0, fact);
             }
-            else if (theDof == 2) {
-                double xCrd = crds(0);
-                double yCrd = crds(1);
-                theNode->setR(0, 0, -fact*yCrd);
-                theNode->setR(1, 0, fact*xCrd);
-                theNode->setR(2, 0, fact);
+            else if (ndm == 2) {
+                if (theDof < 2) {
+                    theNode->setR(theDof, 0, fact);
+                }
+                else if (theDof == 2) {
+                    double xCrd = crds(0);
+                    double yCrd = crds(1);
+                    theNode->setR(0, 0, -fact*yCrd);
+                    theNode->setR(1, 0, fact*xCrd);
+                    theNode->setR(2, 0, fact);
+                }
             }
-        }
-        else if (ndm == 3) {
-            if (theDof < 3) {
-                theNode->setR(theDof, 0, fact);
-            }
-            else if (theDof == 3) {
-                double yCrd = crds(1);
-                double zCrd = crds(2);
-                theNode->setR(1, 0, -fact*zCrd);
-                theNode->setR(2, 0, fact*yCrd);
-                theNode->setR(3, 0, fact);
-            }
-            else if (theDof == 4) {
-                double xCrd = crds(0);
-                double zCrd = crds(2);
-                theNode->setR(0, 0, fact*zCrd);
-                theNode->setR(2, 0, -fact*xCrd);
-                theNode->setR(4, 0, fact);
-            }
-            else if (theDof == 5) {
-                double xCrd = crds(0);
-                double yCrd = crds(1);
-                theNode->setR(0, 0, -fact*yCrd);
-                theNode->setR(1, 0, fact*xCrd);
-                theNode->setR(5, 0, fact);
+            else if (ndm == 3) {
+                if (theDof < 3) {
+                    theNode->setR(theDof, 0, fact);
+                }
+                else if (theDof == 3) {
+                    double yCrd = crds(1);
+                    double zCrd = crds(2);
+                    theNode->setR(1, 0, -fact*zCrd);
+                    theNode->setR(2, 0, fact*yCrd);
+                    theNode->setR(3, 0, fact);
+                }
+                else if (theDof == 4) {
+                    double xCrd = crds(0);
+                    double zCrd = crds(2);
+                    theNode->setR(0, 0, fact*zCrd);
+                    theNode->setR(2, 0, -fact*xCrd);
+                    theNode->setR(4, 0, fact);
+                }
+                else if (theDof == 5) {
+                    double xCrd = crds(0);
+                    double yCrd = crds(1);
+                    theNode->setR(0, 0, -fact*yCrd);
+                    theNode->setR(1, 0, fact*xCrd);
+                    theNode->setR(5, 0, fact);
+                }
             }
         }
+
+        rStamp = stamp;
+        crdStamp = Node::getInertiaStamp();
+        theRPattern = this;
     }
     
     this->EarthquakePattern::applyLoad(time);
@@ -357,6 +370,7 @@ UniformExcitation::applyLoadSensitivity(double time)
       theNode->setR(theDof, 0, 1.0);
     }
 //  }
+    theRPattern = 0;
 
   this->EarthquakePattern::applyLoadSensitivity(time);
 
@@ -70,6 +70,10 @@ class UniformExcitation : public EarthquakePattern
     int theDof;      // the dof corrseponding to the ground motion
     double vel0;     // the initial velocity, should be neg of ug dot(0)
     double fact;
+
+    int rStamp;      // domain stamp when R was last set at the nodes
+    int crdStamp;    // and the nodal stamp, R depends on the coordinates
+    static UniformExcitation *theRPattern; // pattern that last set R
 };
 
 #endif
@@ -0,0 +1,260 @@
+/*
+ *  DRMInputStream.cpp
+ *
+ *  Reads the boundary motion files of the DRM input handlers.
+ *
+ */
+
+#include "DRMInputStream.h"
+#include <OPS_Globals.h>
+#include <string.h>
+
+static const char DRM_MAGIC[8] = {'O','P','S','D','R','M','B','1'};
+static const int DRM_HEADER_SIZE = 32;
+
+DRMInputStream::DRMInputStream()
+  :binary(false), numNodes(0), numFileSteps(0), firstNode(0), lastNode(0),
+   currentStep(0), staging(0), stagingSize(0), stagingStep(0), stagingSteps(0),
+   theThread(0)
+{
+
+}
+
+DRMInputStream::~DRMInputStream()
+{
+  this->wait();
+
+  if (staging != 0)
+    delete [] staging;
+
+  theFile.close();
+}
+
+int
+DRMInputStream::open(const char *fileName, int nodes)
+{
+  theFile.open(fileName, std::ios::in | std::ios::binary);
+  if (theFile.bad() || !theFile.is_open()) {
+    opserr << "DRMInputStream::open() - could not open file " << fileName << endln;
+    return -1;
+  }
+
+  numNodes = nodes;
+  firstNode = 0;
+  lastNode = nodes;
+  currentStep = 0;
+
+  // check for the binary header
+  char header[DRM_HEADER_SIZE];
+  theFile.read(header, DRM_HEADER_SIZE);
+  if (theFile && memcmp(header, DRM_MAGIC, 8) == 0) {
+    binary = true;
+    int fileNodes;
+    memcpy(&fileNodes, &header[8], sizeof(int));
+    memcpy(&numFileSteps, &header[12], sizeof(int));
+    if (fileNodes != numNodes) {
+      opserr << "DRMInputStream::open() - file " << fileName << " holds " << fileNodes;
+      opserr << " nodes per step, expected " << numNodes << endln;
+      return -1;
+    }
+  } else {
+    // text, start again
+    binary = false;
+    theFile.close();
+    theFile.open(fileName, std::ios::in);
+  }
+
+  return 0;
+}
+
+void
+DRMInputStream::setNodeRange(int first, int last)
+{
+  if (first < 0)
+    first = 0;
+  if (last > numNodes)
+    last = numNodes;
+  if (last < first)
+    last = first;
+
+  firstNode = first;
+  lastNode = last;
+}
+
+void
+DRMInputStream::fill(double *data, int step, int numSteps, int stride)
+{
+  int numStep = 3*numNodes;
+
+  if (binary == false) {
+
+    // a text file holds every node of each step in sequence
+    double dataIn;
+    for (int i=0; i<numSteps; i++) {
+      double *stepData = data + i*stride;
+      for (int j=0; j<numStep; j++) {
+	dataIn = 0.0;
+	theFile >> dataIn;
+	if (j >= 3*firstNode && j < 3*lastNode)
+	  stepData[j] = dataIn;
+      }
+    }
+    return;
+  }
+
+  int numRange = 3*(lastNode-firstNode);
+  if (numRange == 0)
+    return;
+
+  theFile.clear();
+
+  // whole steps stored one after the other can be read at once
+  if (numRange == numStep && stride == numStep && step < numFileSteps) {
+    int numRead = numSteps;
+    if (step + numRead > numFileSteps)
+      numRead = numFileSteps - step;
+    theFile.seekg(DRM_HEADER_SIZE + (std::streamoff)step*numStep*sizeof(double));
+    theFile.read((char *)data, (std::streamsize)numRead*numStep*sizeof(double));
+    for (int i=numRead*numStep; i<numSteps*numStep; i++)
+      data[i] = 0.0;
+    return;
+  }
+
+  for (int i=0; i<numSteps; i++) {
+    double *stepData = data + i*stride + 3*firstNode;
+    if (step+i < numFileSteps) {
+      theFile.seekg(DRM_HEADER_SIZE +
+		    ((std::streamoff)(step+i)*numStep + 3*firstNode)*sizeof(double));
+      theFile.read((char *)stepData, (std::streamsize)numRange*sizeof(double));
+    } else {
+      for (int j=0; j<numRange; j++)
+	stepData[j] = 0.0;
+    }
+  }
+}
+
+void
+DRMInputStream::wait(void)
+{
+  if (theThread != 0) {
+    theThread->join();
+    delete theThread;
+    theThread = 0;
+  }
+}
+
+int
+DRMInputStream::read(double *data, int numSteps, int stride)
+{
+  this->wait();
+
+  int numStep = 3*numNodes;
+  int first = 3*firstNode;
+  int numRange = 3*(lastNode-firstNode);
+
+  // take what has been prefetched
+  int numCopied = 0;
+  if (stagingSteps > 0 && stagingStep == currentStep) {
+    numCopied = (numSteps < stagingSteps) ? numSteps : stagingSteps;
+    for (int i=0; i<numCopied; i++)
+      memcpy(data + i*stride + first, staging + i*numStep + first,
+	     numRange*sizeof(double));
+
+    // a text file has been read past what is used, keep the rest
+    if (numCopied < stagingSteps) {
+      memmove(staging, staging + numCopied*numStep,
+	      (stagingSteps-numCopied)*numStep*sizeof(double));
+      stagingStep += numCopied;
+      stagingSteps -= numCopied;
+    } else
+      stagingSteps = 0;
+  }
+
+  // and read the rest
+  if (numCopied < numSteps)
+    this->fill(data + numCopied*stride, currentStep + numCopied,
+	       numSteps - numCopied, stride);
+
+  currentStep += numSteps;
+
+  return 0;
+}
+
+void
+DRMInputStream::prefetch(int numSteps)
+{
+  this->wait();
+
+  if (numSteps <= 0 || stagingSteps != 0)
+    return;
+
+  if (binary == true && currentStep >= numFileSteps)
+    return;
+
+  int size = numSteps*3*numNodes;
+  if (size > stagingSize) {
+    if (staging != 0)
+      delete [] staging;
+    staging = new double[size];
+    stagingSize = size;
+  }
+
+  stagingStep = currentStep;
+  stagingSteps = numSteps;
+  theThread = new std::thread(&DRMInputStream::fill, this, staging, currentStep,
+			      numSteps, 3*numNodes);
+}
+
+int
+drmTextToBinary(const char *inputFilename, const char *outputFilename, int numNodes)
+{
+  std::ifstream input(inputFilename, std::ios::in);
+  if (input.bad() || !input.is_open()) {
+    opserr << "drmTextToBinary() - could not open file " << inputFilename << endln;
+    return -1;
+  }
+
+  std::ofstream output(outputFilename, std::ios::out | std::ios::binary);
+  if (output.bad() || !output.is_open()) {
+    opserr << "drmTextToBinary() - could not open file " << outputFilename << endln;
+    return -1;
+  }
+
+  if (numNodes <= 0) {
+    opserr << "drmTextToBinary() - numNodes must be > 0\n";
+    return -1;
+  }
+
+  char header[DRM_HEADER_SIZE];
+  memset(header, 0, DRM_HEADER_SIZE);
+  memcpy(header, DRM_MAGIC, 8);
+  memcpy(&header[8], &numNodes, sizeof(int));
+  output.write(header, DRM_HEADER_SIZE);
+
+  // copy the data a step at a time
+  int numStep = 3*numNodes;
+  double *data = new double[numStep];
+  int numSteps = 0;
+  bool done = false;
+  while (done == false) {
+    int i;
+    for (i=0; i<numStep && (input >> data[i]); i++)
+      ;
+    if (i == numStep) {
+      output.write((char *)data, numStep*sizeof(double));
+      numSteps++;
+    } else {
+      if (i != 0)
+	opserr << "drmTextToBinary() - incomplete last step ignored\n";
+      done = true;
+    }
+  }
+  delete [] data;
+
+  // and finally the number of steps in the header
+  output.seekp(12);
+  output.write((char *)&numSteps, sizeof(int));
+  output.close();
+
+  return 0;
+}
@@ -0,0 +1,75 @@
+/*
+ *  DRMInputStream.h
+ *
+ *  Reads the boundary motion files of the DRM input handlers.
+ *
+ */
+
+/*
+ * @Description: A DRMInputStream supplies the motions stored in one DRM
+ * input file, step after step, each step holding 3 values for each node
+ * of the file. Two file formats are read:
+ *
+ *  - text: the values separated by white space, read sequentially.
+ *
+ *  - binary: a 32 byte header ("OPSDRMB1", int numNodes, int numSteps,
+ *    16 reserved bytes) followed by the steps one after the other as
+ *    native doubles. Only a range of nodes need be read from each step
+ *    (setNodeRange), so a partition reads only the nodes it needs.
+ *
+ * prefetch() starts a background thread reading the next steps into a
+ * staging buffer while the analysis proceeds; the following read()
+ * takes its data from there. Memory is bounded by the number of steps
+ * prefetched.
+ */
+
+#ifndef DRMInputStream_h
+#define DRMInputStream_h
+
+#include <fstream>
+#include <thread>
+
+// write a text file holding numNodes nodes per step in the binary format
+int drmTextToBinary(const char *inputFilename, const char *outputFilename, int numNodes);
+
+class DRMInputStream
+{
+ public:
+  DRMInputStream();
+  ~DRMInputStream();
+
+  int open(const char *fileName, int numNodes);
+  bool isBinary(void) {return binary;};
+  int getNumNodes(void) {return numNodes;};
+
+  // set the nodes, [firstNode,lastNode), read from each step of a binary file
+  void setNodeRange(int firstNode, int lastNode);
+
+  // read the next numSteps steps, step i placed at data + i*stride; values
+  // of nodes outside the node range are left untouched, values past the end
+  // of the file are set to 0.0
+  int read(double *data, int numSteps, int stride);
+
+  // start reading the next numSteps steps in the background
+  void prefetch(int numSteps);
+
+ private:
+  void fill(double *data, int step, int numSteps, int stride);
+  void wait(void);
+
+  std::ifstream theFile;
+  bool binary;
+  int numNodes;
+  int numFileSteps;
+  int firstNode, lastNode;
+
+  int currentStep;        // next step to be returned by read()
+
+  double *staging;        // prefetched steps
+  int stagingSize;
+  int stagingStep;        // first step held in staging
+  int stagingSteps;       // number of steps held in staging
+  std::thread *theThread; // thread filling staging, 0 if none
+};
+
+#endif
@@ -112,36 +112,32 @@ PlaneDRMInputHandler::PlaneDRMInputHandler(int tag, char** in_files, int files,
     exit(-1);
   }
 	
-  // Open File streams
-  
-  this->ifile1.open(filePtrs[0]);
-  this->ifile2.open(filePtrs[1]);
-  this->ifile3.open(filePtrs[2]);
-  this->ifile4.open(filePtrs[3]);
-  this->ifile5a.open(filePtrs[4]);
-  this->ifile5b.open(filePtrs[5]);
-
-  if (ifile1.bad() ) {
+  // Open File streams, text or binary
+
+  nd1 = _nd1;
+  nd2 = _nd2;
+
+  if (ifile1.open(filePtrs[0], fileData[0]) != 0) {
     opserr << " Bad file 1 " << endln;
     exit(-1);
   }
-  if (ifile2.bad() ) {
+  if (ifile2.open(filePtrs[1], fileData[3]) != 0) {
     opserr << " Bad file 2 " << endln;
     exit(-1);
   }
-  if (ifile3.bad() ) {
+  if (ifile3.open(filePtrs[2], fileData[6]) != 0) {
     opserr << " Bad file 3 " << endln;
     exit(-1);
   }
-  if (ifile4.bad() ) {
+  if (ifile4.open(filePtrs[3], fileData[9]) != 0) {
     opserr << " Bad file 4 " << endln;
     exit(-1);
   }
-  if (ifile5a.bad() ) {
+  if (ifile5a.open(filePtrs[4], nd1) != 0) {
     opserr << " Bad file 5a " << endln;
     exit(-1);
   }
-  if (ifile5b.bad() ) {
+  if (ifile5b.open(filePtrs[5], nd2) != 0) {
     opserr << " Bad file 5b " << endln;
     exit(-1);
   }
@@ -167,8 +163,8 @@ PlaneDRMInputHandler::PlaneDRMInputHandler(int tag, char** in_files, int files,
   Vtp1.Zero();
   Vtp2.Zero();
 
-  nd1 = _nd1;
-  nd2 = _nd2;
+  // only read the part of binary files needed by the nodes in this domain
+  setNodeRanges();
 
   populateBuffers();
 }
@@ -196,53 +192,32 @@ void PlaneDRMInputHandler::populateBuffers()
   if (this->initial) {
     
     int temp = this->fileData[0];
-    double dataIn;
     for (int i=0; i<3*temp; i++) {
       f1buffer[i] = 0.0;
     }
-    for (int i=3*temp; i<3*(cacheValue + 4)*temp; i++) {
-      ifile1 >> dataIn;
-      f1buffer[i] = dataIn;
-    }
+    ifile1.read(&f1buffer[3*temp], cacheValue + 3, 3*temp);
     temp = this->fileData[3];
     for (int i=0; i<3*temp; i++) {
       f2buffer[i] = 0.0;
     }
-    for (int i=3*temp; i<3*(cacheValue + 4)*temp; i++) {
-      ifile2 >> dataIn;
-      f2buffer[i] = dataIn;
-    }
+    ifile2.read(&f2buffer[3*temp], cacheValue + 3, 3*temp);
     temp = this->fileData[6];
     for (int i=0; i<3*temp; i++) {
       f3buffer[i] = 0.0;
     }
-    for (int i=3*temp; i<3*(cacheValue + 4)*temp; i++) {
-      ifile3 >> dataIn;
-      f3buffer[i] = dataIn;
-    }
+    ifile3.read(&f3buffer[3*temp], cacheValue + 3, 3*temp);
     temp = this->fileData[9];
     for (int i=0; i<3*temp; i++) {
       f4buffer[i] = 0.0;
     }
-    for (int i=3*temp; i<3*(cacheValue + 4)*temp; i++) {
-      ifile4 >> dataIn;
-      f4buffer[i] = dataIn;
-    }
+    ifile4.read(&f4buffer[3*temp], cacheValue + 3, 3*temp);
     temp = this->fileData[12];
     for (int i=0; i<3*temp; i++) {
       f5buffer[i] = 0.0;
     }
-    int index = 3*temp;
-    for (int k=1; k<(cacheValue +4); k++) {
-      for (int i=0; i<3*nd1; i++) {
-	ifile5a >> dataIn;
-	f5buffer[index++] = dataIn;
-      }
-      for (int i=0; i<3*nd2; i++) {
-	ifile5b >> dataIn;
-	f5buffer[index++] = dataIn;
-      }
-    } 
+    // steps of face 5 are split over two files
+    ifile5a.read(&f5buffer[3*temp], cacheValue + 3, 3*temp);
+    ifile5b.read(&f5buffer[3*temp + 3*nd1], cacheValue + 3, 3*temp);
     initial = false;
     globalCounter += cacheValue + 1;
     
@@ -269,64 +244,36 @@ void PlaneDRMInputHandler::populateBuffers()
       f1buffer[i+3*temp] = f1buffer[i+3*(cacheValue+2)*temp];			
       f1buffer[i+6*temp] = f1buffer[i+3*(cacheValue+3)*temp];			
     }
-    double dataIn=0.0;
-    for (int i=9*temp; i<3*(rem + 4)*temp; i++) {
-      ifile1 >> dataIn;
-      f1buffer[i] = dataIn;
-    }
+    ifile1.read(&f1buffer[9*temp], rem + 1, 3*temp);
     temp = this->fileData[3];
     for (int i=0; i<3*temp; i++) {
       f2buffer[i] = f2buffer[i+ 3*(cacheValue+1)*temp];
       f2buffer[i+3*temp] = f2buffer[i+3*(cacheValue+2)*temp];			
       f2buffer[i+6*temp] = f2buffer[i+3*(cacheValue+3)*temp];			
     }
-    dataIn=0.0;
-    for (int i=9*temp; i<3*(rem + 4)*temp; i++) {
-      ifile2 >> dataIn;
-      f2buffer[i] = dataIn;
-    }
+    ifile2.read(&f2buffer[9*temp], rem + 1, 3*temp);
     temp = this->fileData[6];
     for (int i=0; i<3*temp; i++) {
       f3buffer[i] = f3buffer[i+ 3*(cacheValue+1)*temp];
       f3buffer[i+3*temp] = f3buffer[i+3*(cacheValue+2)*temp];			
       f3buffer[i+6*temp] = f3buffer[i+3*(cacheValue+3)*temp];			
     }
-    dataIn=0.0;
-    for (int i=9*temp; i<3*(rem + 4)*temp; i++) {
-      ifile3 >> dataIn;
-      f3buffer[i] = dataIn;
-    }
+    ifile3.read(&f3buffer[9*temp], rem + 1, 3*temp);
     temp = this->fileData[9];
     for (int i=0; i<3*temp; i++) {
       f4buffer[i] = f4buffer[i+ 3*(cacheValue+1)*temp];
       f4buffer[i+3*temp] = f4buffer[i+3*(cacheValue+2)*temp];			
       f4buffer[i+6*temp] = f4buffer[i+3*(cacheValue+3)*temp];			
     }
-    dataIn=0.0;
-    for (int i=9*temp; i<3*(rem + 4)*temp; i++) {
-      ifile4 >> dataIn;
-      f4buffer[i] = dataIn;
-    }
+    ifile4.read(&f4buffer[9*temp], rem + 1, 3*temp);
     temp = this->fileData[12];
     for (int i=0; i<3*temp; i++) {
       f5buffer[i] = f5buffer[i+ 3*(cacheValue+1)*temp];
       f5buffer[i+3*temp] = f5buffer[i+3*(cacheValue+2)*temp];			
       f5buffer[i+6*temp] = f5buffer[i+3*(cacheValue+3)*temp];			
     }
-    dataIn=0.0;
-    int index = 9*temp;
-    //need some change here for two files
-    //for (int i=6*temp; i<3*(rem + 3)*temp; i++) {
-    for (int k=3; k<(cacheValue +4); k++) {
-      for (int i=0; i<3*nd1; i++) {
-	ifile5a >> dataIn;
-	f5buffer[index++] = dataIn;
-      }
-      for (int i=0; i<3*nd2; i++) {
-	ifile5b >> dataIn;
-	f5buffer[index++] = dataIn;
-      }
-    }
+    ifile5a.read(&f5buffer[9*temp], cacheValue + 1, 3*temp);
+    ifile5b.read(&f5buffer[9*temp + 3*nd1], cacheValue + 1, 3*temp);
     globalCounter += cacheValue+1;
 
     //update time buff
@@ -337,6 +284,70 @@ void PlaneDRMInputHandler::populateBuffers()
       timeBuf[3+i] = timeBuf[2+i]+this->deltaT;
     
   }
+
+  // start reading the next window while this one is in use
+  int next = numSteps - globalCounter;
+  if (next >= 0) {
+    if (next > cacheValue)
+      next = cacheValue;
+    ifile1.prefetch(next + 1);
+    ifile2.prefetch(next + 1);
+    ifile3.prefetch(next + 1);
+    ifile4.prefetch(next + 1);
+    ifile5a.prefetch(cacheValue + 1);
+    ifile5b.prefetch(cacheValue + 1);
+  }
+}
+
+void PlaneDRMInputHandler::setNodeRanges()
+{
+  // bounds of the nodes in the domain, in a parallel run just those of
+  // this partition
+  double zMin = 0.0, zMax = 0.0, yMin = 0.0, yMax = 0.0;
+  bool first = true;
+  Node *theNode;
+  NodeIter &theNodes = myDomain->getNodes();
+  while ((theNode = theNodes()) != 0) {
+    const Vector &crd = theNode->getCrds();
+    if (crd.Size() < 3)
+      return;
+    if (first == true) {
+      yMin = yMax = crd(1);
+      zMin = zMax = crd(2);
+      first = false;
+    }
+    if (crd(1) < yMin) yMin = crd(1);
+    if (crd(1) > yMax) yMax = crd(1);
+    if (crd(2) < zMin) zMin = crd(2);
+    if (crd(2) > zMax) zMax = crd(2);
+  }
+  if (first == true)
+    return;
+
+  // the nodes of faces 1-4 are stored by rows of constant z, those of face 5
+  // by rows of constant y, both in the cmu crd system; a row more is kept
+  // for the interpolation
+  DRMInputStream *streams[4] = {&ifile1, &ifile2, &ifile3, &ifile4};
+  double dz = eleD[2];
+  for (int f=0; f<4; f++) {
+    int numH = fileData[3*f+1] + 1;
+    int numz = fileData[3*f+2];
+    int row1 = floor((numz*dz - zMax)/dz);
+    int row2 = floor((numz*dz - zMin)/dz) + 1;
+    streams[f]->setNodeRange(row1*numH, (row2+1)*numH);
+  }
+
+  double dy = eleD[1];
+  int numH = fileData[13] + 1;
+  int numy = fileData[14];
+  int row1 = floor((numy*dy - yMax)/dy);
+  int row2 = floor((numy*dy - yMin)/dy) + 1;
+  int node1 = row1*numH;
+  int node2 = (row2+1)*numH;
+
+  // face 5 nodes are split over two files
+  ifile5a.setNodeRange(node1, node2);
+  ifile5b.setNodeRange(node1 - nd1, node2 - nd1);
 }
 
 void PlaneDRMInputHandler::getMotions(Element* eletag, double time, Vector& U, Vector& Ud, Vector& Udd)
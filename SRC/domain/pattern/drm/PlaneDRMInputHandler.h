@@ -19,6 +19,7 @@
 #include "DRMInputHandler.h"
 #include "GeometricBrickDecorator.h"
 #include "Mesh3DSubdomain.h"
+#include "DRMInputStream.h"
 #include <math.h>
 
 class PlaneDRMInputHandler : public DRMInputHandler {
@@ -51,6 +52,7 @@ class PlaneDRMInputHandler : public DRMInputHandler {
   void getf4pointer(Node* node_tag, int local_tag, int index);
   void pointerCopy(int node_from, int node_to);
   void populateTempBuffers(int index, int fileptr, double ksi, double eta);
+  void setNodeRanges(void);
 
   
   private :
@@ -70,12 +72,12 @@ class PlaneDRMInputHandler : public DRMInputHandler {
   
   Domain* myDomain;
 
-  std::ifstream ifile1;
-  std::ifstream ifile2;
-  std::ifstream ifile3;
-  std::ifstream ifile4;
-  std::ifstream ifile5a;
-  std::ifstream ifile5b;
+  DRMInputStream ifile1;
+  DRMInputStream ifile2;
+  DRMInputStream ifile3;
+  DRMInputStream ifile4;
+  DRMInputStream ifile5a;
+  DRMInputStream ifile5b;
   
 
   static Vector Vtm2;
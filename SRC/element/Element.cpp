@@ -50,6 +50,7 @@ Matrix **Element::theMatrices;
 Vector **Element::theVectors1; 
 Vector **Element::theVectors2; 
 int  Element::numMatrices(0);
+int  Element::linearStamp(0);
 
 // Element(int tag, int noExtNodes);
 // 	constructor that takes the element's unique tag and the number
@@ -119,6 +120,9 @@ Element::setRayleighDampingFactors(double alpham, double betak, double betak0, d
   betaK0 = betak0;
   betaKc = betakc;
 
+  // damping of any linear element cached by an FE_Element is now stale
+  Element::changeLinearStamp();
+
   // check that memory has been allocated to store compute/return
   // damping matrix & residual force calculations
   if (index == -1) {
@@ -407,6 +411,32 @@ Element::isSubdomain(void)
     return false;
 }
 
+bool
+Element::isLinear(void)
+{
+    return false;
+}
+
+int
+Element::getLinearStamp(void)
+{
+    return linearStamp;
+}
+
+void
+Element::changeLinearStamp(void)
+{
+    linearStamp++;
+}
+
+bool
+Element::hasTrialStateChanged(void)
+{
+    // assumed to have changed, unless the element compares its trial
+    // state against the committed state
+    return true;
+}
+
 Response*
 Element::setResponse(const char **argv, int argc, OPS_Stream &output)
 {
@@ -474,6 +504,12 @@ Element::getResponse(int responseID, Information &eleInfo)
   }
 }
 
+const Vector *
+Element::getResponseStorage(int responseID)
+{
+  return 0;
+}
+
 int
 Element::getResponseSensitivity(int responseID, int gradIndex,
 				Information &eleInfo)
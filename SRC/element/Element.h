@@ -75,6 +75,16 @@ class Element : public DomainComponent
     virtual const Matrix &getMass(void);
     virtual const Matrix &getGeometricTangentStiff();
 
+    // methods for linear elements; an element returning true has a
+    // constant tangent, damping and mass which FE_Element may cache
+    virtual bool isLinear(void);
+    static int getLinearStamp(void);
+    static void changeLinearStamp(void);
+
+    // method to determine if the trial state differs from the committed
+    // state; the Domain skips commit and revert on elements returning false
+    virtual bool hasTrialStateChanged(void);
+
     // methods for applying loads
     virtual void zeroLoad(void);	
     virtual int addLoad(ElementalLoad *theLoad, double loadFactor);
@@ -94,6 +104,11 @@ class Element : public DomainComponent
     virtual int getResponseSensitivity(int responseID, int gradIndex,
 				       Information &eleInformation);
 
+    // the element storage holding response responseID, kept current by the
+    // state determination so it can be read without calling getResponse();
+    // 0 if the response is computed on request
+    virtual const Vector *getResponseStorage(int responseID);
+
     virtual int displaySelf(Renderer &, int mode, float fact, const char **displayModes=0, int numModes=0);
 
 // AddingSensitivity:BEGIN //////////////////////////////////////////
@@ -126,6 +141,7 @@ class Element : public DomainComponent
     static int numMatrices;
 
   private:
+    static int linearStamp; // changed when cached linear matrices are stale
 };
 
 
@@ -48,6 +48,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <elementAPI.h>
+#include <MemoryReport.h>
 
 void* OPS_Brick()
 {
@@ -231,6 +232,16 @@ int  Brick::getNumDOF( )
   return 24 ;
 }
 
+//linear if all materials are elastic
+bool  Brick::isLinear( )
+{
+  for ( int i = 0; i < 8; i++ )
+    if ( materialPointers[i]->getClassTag() != ND_TAG_ElasticIsotropicThreeDimensional )
+      return false ;
+
+  return true ;
+}
+
 
 //commit state
 int  Brick::commitState( )
@@ -276,6 +287,20 @@ int  Brick::revertToStart( )
   return success ;
 }
 
+//add the heap used by the element and its materials
+void  Brick::reportMemory(MemoryReport &theReport)
+{
+  size_t bytes = sizeof(Brick) + MemoryReport::bytes(connectedExternalNodes);
+  bytes += MemoryReport::bytes(load) + MemoryReport::bytes(Ki);
+  for (int i=0; i<8; i++)
+    bytes += MemoryReport::bytes(initDisp[i]);
+  theReport.add(*this, bytes);
+
+  for (int i=0; i<8; i++)
+    if (materialPointers[i] != 0)
+      materialPointers[i]->reportMemory(theReport);
+}
+
 //print out element data
 void  Brick::Print(OPS_Stream &s, int flag)
 {
@@ -81,6 +81,9 @@ class Brick : public Element {
     //return number of dofs
     int getNumDOF( ) ;
 
+    //linear if all materials are elastic
+    bool isLinear( ) ;
+
     //commit state
     int commitState( ) ;
     
@@ -95,6 +98,7 @@ class Brick : public Element {
 
     //print out element data
     void Print( OPS_Stream &s, int flag ) ;
+    void reportMemory(MemoryReport &theReport);
 	
     //return stiffness matrix 
     const Matrix &getTangentStiff();
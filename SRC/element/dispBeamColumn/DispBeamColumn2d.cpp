@@ -399,6 +399,20 @@ DispBeamColumn2d::commitState()
     return retVal;
 }
 
+bool
+DispBeamColumn2d::hasTrialStateChanged()
+{
+    // a nonlinear transformation keeps its own committed state
+    if (crdTransf->getClassTag() != CRDTR_TAG_LinearCrdTransf2d)
+      return true;
+
+    for (int i = 0; i < numSections; i++)
+      if (theSections[i]->hasTrialStateChanged() == true)
+	return true;
+
+    return false;
+}
+
 int
 DispBeamColumn2d::revertToLastCommit()
 {
@@ -69,6 +69,7 @@ class DispBeamColumn2d : public Element
     // public methods to set the state of the element    
     int commitState(void);
     int revertToLastCommit(void);
+    bool hasTrialStateChanged(void);
     int revertToStart(void);
 
     // public methods to obtain stiffness, mass, damping and residual information    
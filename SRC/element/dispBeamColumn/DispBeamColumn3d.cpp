@@ -320,6 +320,20 @@ DispBeamColumn3d::commitState()
     return retVal;
 }
 
+bool
+DispBeamColumn3d::hasTrialStateChanged()
+{
+    // a nonlinear transformation keeps its own committed state
+    if (crdTransf->getClassTag() != CRDTR_TAG_LinearCrdTransf3d)
+      return true;
+
+    for (int i = 0; i < numSections; i++)
+      if (theSections[i]->hasTrialStateChanged() == true)
+	return true;
+
+    return false;
+}
+
 int
 DispBeamColumn3d::revertToLastCommit()
 {
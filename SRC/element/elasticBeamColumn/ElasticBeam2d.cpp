@@ -276,6 +276,13 @@ ElasticBeam2d::getNumDOF(void)
     return 6;
 }
 
+bool
+ElasticBeam2d::isLinear(void)
+{
+  // matrices are constant only if the geometry is not updated
+  return (theCoordTransf->getClassTag() == CRDTR_TAG_LinearCrdTransf2d);
+}
+
 void
 ElasticBeam2d::setDomain(Domain *theDomain)
 {
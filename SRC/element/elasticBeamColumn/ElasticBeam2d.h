@@ -60,6 +60,7 @@ class ElasticBeam2d : public Element
     Node **getNodePtrs(void);
 
     int getNumDOF(void);
+    bool isLinear(void);
     void setDomain(Domain *theDomain);
     
     int commitState(void);
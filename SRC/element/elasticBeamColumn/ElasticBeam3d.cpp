@@ -284,6 +284,13 @@ ElasticBeam3d::getNumDOF(void)
     return 12;
 }
 
+bool
+ElasticBeam3d::isLinear(void)
+{
+  // matrices are constant only if the geometry is not updated
+  return (theCoordTransf->getClassTag() == CRDTR_TAG_LinearCrdTransf3d);
+}
+
 void
 ElasticBeam3d::setDomain(Domain *theDomain)
 {
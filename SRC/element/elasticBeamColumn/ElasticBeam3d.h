@@ -66,6 +66,7 @@ class ElasticBeam3d : public Element
     Node **getNodePtrs(void);
 
     int getNumDOF(void);
+    bool isLinear(void);
     void setDomain(Domain *theDomain);
     
     int commitState(void);
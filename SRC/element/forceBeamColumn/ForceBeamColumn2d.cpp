@@ -78,6 +78,8 @@ Journal of Structural Engineering, Approved for publication, February 2007.
 #include <CompositeResponse.h>
 #include <ElementalLoad.h>
 #include <ElementIter.h>
+#include <ClassProfiler.h>
+#include <MemoryReport.h>
 
 Matrix ForceBeamColumn2d::theMatrix(6,6);
 Vector ForceBeamColumn2d::theVector(6);
@@ -800,6 +802,8 @@ ForceBeamColumn2d::update()
 
   int numSubdivide = 1;
   bool converged = false;
+  int numLocalIters = 0;   // for the class profiler
+  int numMaxHits = 0;
   static Vector dSe(NEBD);
   static Vector dvToDo(NEBD);
   static Vector dvTrial(NEBD);
@@ -852,6 +856,7 @@ ForceBeamColumn2d::update()
 	  numIters = 10*maxIters; // allow 10 times more iterations for initial tangent
 	
 	for (j=0; j <numIters; j++) {
+	  numLocalIters++;
 	  // initialize f and vr for integration
 	  f.Zero();
 	  vr.Zero();
@@ -1117,10 +1122,16 @@ ForceBeamColumn2d::update()
 	    }
 	  }
 	} // for (j=0; j<numIters; j++)
+
+	if (j == numIters)
+	  numMaxHits++;
       } // if (initialFlag != 2)
     } // for (int l=0; l<2; l++)
   } // while (converged == false)
 
+  if (ClassProfiler::isEnabled() == true)
+    ClassProfiler::addIterations(this, numLocalIters, numMaxHits);
+
 
   // if fail to converge we return an error flag & print an error message
 
@@ -2189,6 +2200,38 @@ void ForceBeamColumn2d::compSectionDisplacements(Vector sectionCoords[], Vector
    return;	       
 }
 
+void
+ForceBeamColumn2d::reportMemory(MemoryReport &theReport)
+{
+  size_t bytes = sizeof(ForceBeamColumn2d) + MemoryReport::bytes(connectedExternalNodes);
+  bytes += MemoryReport::bytes(kv) + MemoryReport::bytes(Se);
+  bytes += MemoryReport::bytes(kvcommit) + MemoryReport::bytes(Secommit);
+  bytes += MemoryReport::bytes(tjcMass) + MemoryReport::bytes(Ki);
+  bytes += numSections*sizeof(SectionForceDeformation *);
+  bytes += sizeEleLoads*(sizeof(ElementalLoad *) + sizeof(double));
+
+  // the section state of the local iterations
+  for (int i=0; i<numSections; i++) {
+    if (fs != 0)
+      bytes += sizeof(Matrix) + MemoryReport::bytes(fs[i]);
+    if (vs != 0)
+      bytes += sizeof(Vector) + MemoryReport::bytes(vs[i]);
+    if (Ssr != 0)
+      bytes += sizeof(Vector) + MemoryReport::bytes(Ssr[i]);
+    if (vscommit != 0)
+      bytes += sizeof(Vector) + MemoryReport::bytes(vscommit[i]);
+  }
+  theReport.add(*this, bytes);
+
+  for (int i=0; i<numSections; i++)
+    if (sections[i] != 0)
+      sections[i]->reportMemory(theReport);
+  if (crdTransf != 0)
+    crdTransf->reportMemory(theReport);
+  if (beamIntegr != 0)
+    beamIntegr->reportMemory(theReport);
+}
+
 void
 ForceBeamColumn2d::Print(OPS_Stream &s, int flag)
 {
@@ -2752,6 +2795,16 @@ ForceBeamColumn2d::getResponse(int responseID, Information &eleInfo)
     return -1;
 }
 
+const Vector *
+ForceBeamColumn2d::getResponseStorage(int responseID)
+{
+  // basic forces are kept in Se by update()
+  if (responseID == 7)
+    return &Se;
+
+  return 0;
+}
+
 int 
 ForceBeamColumn2d::getResponseSensitivity(int responseID, int gradNumber,
 					  Information &eleInfo)
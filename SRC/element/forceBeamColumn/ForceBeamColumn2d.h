@@ -116,9 +116,11 @@ class ForceBeamColumn2d: public Element
   
   friend OPS_Stream &operator<<(OPS_Stream &s, ForceBeamColumn2d &E);        
   void Print(OPS_Stream &s, int flag =0);    
+  void reportMemory(MemoryReport &theReport);
   
   Response *setResponse(const char **argv, int argc, OPS_Stream &s);
   int getResponse(int responseID, Information &eleInformation);
+  const Vector *getResponseStorage(int responseID);
   
   // AddingSensitivity:BEGIN //////////////////////////////////////////
   int setParameter(const char **argv, int argc, Parameter &param);
@@ -81,6 +81,8 @@ using std::ifstream;
 #include <CompositeResponse.h>
 #include <ElementalLoad.h>
 #include <ElementIter.h>
+#include <ClassProfiler.h>
+#include <MemoryReport.h>
 
 #define DefaultLoverGJ 1.0e-10
 
@@ -714,6 +716,8 @@ ForceBeamColumn3d::computeReactionSensitivity(double *dp0dh, int gradNumber)
 
     int numSubdivide = 1;
     bool converged = false;
+    int numLocalIters = 0;   // for the class profiler
+    int numMaxHits = 0;
     static Vector dSe(NEBD);
     static Vector dvToDo(NEBD);
     static Vector dvTrial(NEBD);
@@ -767,6 +771,7 @@ ForceBeamColumn3d::computeReactionSensitivity(double *dp0dh, int gradNumber)
 	    numIters = 10*maxIters; // allow 10 times more iterations for initial tangent
 
 	  for (j=0; j <numIters; j++) {
+	    numLocalIters++;
 
 	    // initialize f and vr for integration
 	    f.Zero();
@@ -1113,10 +1118,16 @@ ForceBeamColumn3d::computeReactionSensitivity(double *dp0dh, int gradNumber)
 	    }
 
 	  } // for (j=0; j<numIters; j++)
+
+	  if (j == numIters)
+	    numMaxHits++;
 	} // if (initialFlag != 2)
       } // for (int l=0; l<2; l++)
     } // while (converged == false)
 
+    if (ClassProfiler::isEnabled() == true)
+      ClassProfiler::addIterations(this, numLocalIters, numMaxHits);
+
     // if fail to converge we return an error flag & print an error message
 
     if (converged == false) {
@@ -2280,6 +2291,38 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
     return;	       
   }
 
+  void
+  ForceBeamColumn3d::reportMemory(MemoryReport &theReport)
+  {
+    size_t bytes = sizeof(ForceBeamColumn3d) + MemoryReport::bytes(connectedExternalNodes);
+    bytes += MemoryReport::bytes(kv) + MemoryReport::bytes(Se);
+    bytes += MemoryReport::bytes(kvcommit) + MemoryReport::bytes(Secommit);
+    bytes += MemoryReport::bytes(Ki);
+    bytes += numSections*sizeof(SectionForceDeformation *);
+    bytes += sizeEleLoads*(sizeof(ElementalLoad *) + sizeof(double));
+
+    // the section state of the local iterations
+    for (int i=0; i<numSections; i++) {
+      if (fs != 0)
+        bytes += sizeof(Matrix) + MemoryReport::bytes(fs[i]);
+      if (vs != 0)
+        bytes += sizeof(Vector) + MemoryReport::bytes(vs[i]);
+      if (Ssr != 0)
+        bytes += sizeof(Vector) + MemoryReport::bytes(Ssr[i]);
+      if (vscommit != 0)
+        bytes += sizeof(Vector) + MemoryReport::bytes(vscommit[i]);
+    }
+    theReport.add(*this, bytes);
+
+    for (int i=0; i<numSections; i++)
+      if (sections[i] != 0)
+        sections[i]->reportMemory(theReport);
+    if (crdTransf != 0)
+      crdTransf->reportMemory(theReport);
+    if (beamIntegr != 0)
+      beamIntegr->reportMemory(theReport);
+  }
+
   void
   ForceBeamColumn3d::Print(OPS_Stream &s, int flag)
   {
@@ -44,6 +44,7 @@
 #include <ElementResponse.h>
 #include <ElementalLoad.h>
 #include <elementAPI.h>
+#include <MemoryReport.h>
 
 void* OPS_FourNodeQuad()
 {
@@ -887,6 +888,19 @@ FourNodeQuad::recvSelf(int commitTag, Channel &theChannel,
   return res;
 }
 
+void
+FourNodeQuad::reportMemory(MemoryReport &theReport)
+{
+  size_t bytes = sizeof(FourNodeQuad) + 4*sizeof(NDMaterial *);
+  bytes += MemoryReport::bytes(connectedExternalNodes) + MemoryReport::bytes(Q);
+  bytes += MemoryReport::bytes(pressureLoad) + MemoryReport::bytes(Ki);
+  theReport.add(*this, bytes);
+
+  for (int i=0; i<4 && theMaterial != 0; i++)
+    if (theMaterial[i] != 0)
+      theMaterial[i]->reportMemory(theReport);
+}
+
 void
 FourNodeQuad::Print(OPS_Stream &s, int flag)
 {
@@ -89,6 +89,7 @@ class FourNodeQuad : public Element
 
     int displaySelf(Renderer &, int mode, float fact, const char **displayModes=0, int numModes=0);
     void Print(OPS_Stream &s, int flag =0);
+    void reportMemory(MemoryReport &theReport);
 
     Response *setResponse(const char **argv, int argc, 
 			  OPS_Stream &s);
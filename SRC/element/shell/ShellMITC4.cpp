@@ -279,6 +279,19 @@ int  ShellMITC4::getNumDOF( )
   return 24 ;
 }
 
+//linear if section is elastic and basis is not updated
+bool  ShellMITC4::isLinear( )
+{
+  if (doUpdateBasis == true)
+    return false ;
+
+  for ( int i = 0; i < 4; i++ )
+    if ( materialPointers[i]->getClassTag() != SEC_TAG_ElasticMembranePlateSection )
+      return false ;
+
+  return true ;
+}
+
 
 //commit state
 int  ShellMITC4::commitState( )
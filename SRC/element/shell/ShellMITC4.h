@@ -75,6 +75,9 @@ class ShellMITC4 : public Element {
     //return number of dofs
     int getNumDOF( ) ;
 
+    //linear if section is elastic and basis is not updated
+    bool isLinear( ) ;
+
     //commit state
     int commitState( ) ;
     
@@ -65,6 +65,7 @@ Vector Truss::trussV12(12);
 //  and storing the tags of the truss end nodes.
 
 #include <elementAPI.h>
+#include <MemoryReport.h>
 #define OPS_Export 
 
 OPS_Export void *
@@ -278,6 +279,12 @@ Truss::getNumDOF(void)
     return numDOF;
 }
 
+bool
+Truss::isLinear(void)
+{
+  return theMaterial->isLinear();
+}
+
 
 // method: setDomain()
 //    to set a link to the enclosing Domain and to set the node pointers.
@@ -1052,6 +1059,20 @@ Truss::displaySelf(Renderer &theViewer, int displayMode, float fact,
 
 
 
+void
+Truss::reportMemory(MemoryReport &theReport)
+{
+  size_t bytes = sizeof(Truss) + MemoryReport::bytes(connectedExternalNodes);
+  bytes += MemoryReport::bytes(theLoad) + MemoryReport::bytes(theLoadSens);
+  if (initialDisp != 0)
+    bytes += dimension*sizeof(double);
+  theReport.add(*this, bytes);
+
+  if (theMaterial != 0)
+    theMaterial->reportMemory(theReport);
+}
+
+
 void
 Truss::Print(OPS_Stream &s, int flag)
 {
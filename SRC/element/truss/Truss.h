@@ -65,6 +65,7 @@ class Truss : public Element
     Node **getNodePtrs(void);
 
     int getNumDOF(void);	
+    bool isLinear(void);
     void setDomain(Domain *theDomain);
 
     // public methods to set the state of the element    
@@ -92,6 +93,7 @@ class Truss : public Element
     int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
     int displaySelf(Renderer &, int mode, float fact, const char **displayModes=0, int numModes=0);
     void Print(OPS_Stream &s, int flag =0);    
+    void reportMemory(MemoryReport &theReport);
 
     Response *setResponse(const char **argv, int argc, OPS_Stream &s);
     int getResponse(int responseID, Information &eleInformation);
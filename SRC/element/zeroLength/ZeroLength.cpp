@@ -503,6 +503,21 @@ ZeroLength::getNumDOF(void)
     return numDOF;
 }
 
+bool
+ZeroLength::isLinear(void)
+{
+  // include any materials used for the damping
+  int numMat = numMaterials1d;
+  if (useRayleighDamping == 2)
+    numMat *= 2;
+
+  for (int mat=0; mat<numMat; mat++)
+    if (theMaterial1d[mat]->isLinear() == false)
+      return false;
+
+  return true;
+}
+
 
 // method: setDomain()
 //    to set a link to the enclosing Domain and to set the node pointers.
@@ -114,6 +114,7 @@ class ZeroLength : public Element
     Node **getNodePtrs(void);
 
     int getNumDOF(void);	
+    bool isLinear(void);
     void setDomain(Domain *theDomain);
 
     // public methods to set the state of the element    
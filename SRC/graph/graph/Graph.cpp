@@ -40,6 +40,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <Vector.h>
+#include <MemoryReport.h>
 
 Graph::Graph()
   :myVertices(0), theVertexIter(0), numEdge(0), nextFreeTag(START_VERTEX_NUM)
@@ -308,6 +309,18 @@ Graph::merge(Graph &other) {
   return result;
 }
 
+void
+Graph::reportMemory(MemoryReport &theReport)
+{
+  size_t bytes = sizeof(Graph);
+
+  Vertex *vertexPtr;
+  VertexIter &theVertices = this->getVertices();
+  while ((vertexPtr = theVertices()) != 0)
+    bytes += sizeof(Vertex) + MemoryReport::bytes(vertexPtr->getAdjacency());
+
+  theReport.add("graph", "Graph", bytes);
+}
 
 void 
 Graph::Print(OPS_Stream &s, int flag)
@@ -0,0 +1,504 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+// Description: This file contains the implementation of AsyncStream.
+
+#include <AsyncStream.h>
+#include <Vector.h>
+#include <ID.h>
+#include <classTags.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+
+//
+// the writer shared by all AsyncStreams; allocated on first use and never
+// deleted, so streams deleted during program exit can still flush
+//
+
+struct AsyncWrite {
+  AsyncStream *theStream;
+  double *data;
+  int size;
+};
+
+struct AsyncWriter {
+  std::mutex theMutex;
+  std::condition_variable queueChanged;
+  std::deque<AsyncWrite> theQueue;
+  std::vector<double *> freeData;    // buffers for reuse
+  std::vector<int> freeSizes;
+  long numQueued;                    // doubles held in queue
+  long maxQueued;
+  std::thread *theThread;
+};
+
+static AsyncWriter *theWriter = 0;
+static long maxQueuedDoubles = 8*1024*1024;
+
+static void
+asyncWriterLoop(AsyncWriter *writer)
+{
+  std::unique_lock<std::mutex> lock(writer->theMutex);
+  while (true) {
+    writer->queueChanged.wait(lock, [writer] {return !writer->theQueue.empty();});
+
+    AsyncWrite next = writer->theQueue.front();
+    writer->theQueue.pop_front();
+
+    // format and write without holding the lock
+    lock.unlock();
+    next.theStream->writeQueued(next.data, next.size);
+    lock.lock();
+
+    writer->numQueued -= next.size;
+    writer->freeData.push_back(next.data);
+    writer->freeSizes.push_back(next.size);
+    writer->queueChanged.notify_all();
+  }
+}
+
+static AsyncWriter *
+getWriter(void)
+{
+  if (theWriter == 0) {
+    theWriter = new AsyncWriter;
+    theWriter->numQueued = 0;
+    theWriter->maxQueued = maxQueuedDoubles;
+    theWriter->theThread = new std::thread(asyncWriterLoop, theWriter);
+    theWriter->theThread->detach();
+  }
+  return theWriter;
+}
+
+
+AsyncStream::AsyncStream(OPS_Stream *stream)
+  :OPS_Stream(OPS_STREAM_TAGS_AsyncStream), theStream(stream), flushTime(0.0), numPending(0)
+{
+  getWriter();
+}
+
+AsyncStream::~AsyncStream()
+{
+  this->flush();
+  if (theStream != 0)
+    delete theStream;
+}
+
+void
+AsyncStream::setMaxQueued(int numDoubles)
+{
+  maxQueuedDoubles = numDoubles;
+  if (theWriter != 0) {
+    std::lock_guard<std::mutex> lock(theWriter->theMutex);
+    theWriter->maxQueued = numDoubles;
+  }
+}
+
+int
+AsyncStream::flush(void)
+{
+  AsyncWriter *writer = getWriter();
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  std::unique_lock<std::mutex> lock(writer->theMutex);
+  writer->queueChanged.wait(lock, [this] {return numPending == 0;});
+  flushTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return 0;
+}
+
+long long
+AsyncStream::getNumBytes(void)
+{
+  // the writer thread must be idle before asking the wrapped stream
+  this->flush();
+  return theStream->getNumBytes();
+}
+
+double
+AsyncStream::getFlushTime(void)
+{
+  this->flush();
+  return flushTime + theStream->getFlushTime();
+}
+
+int
+AsyncStream::write(Vector &data)
+{
+  int size = data.Size();
+  if (size == 0)
+    return theStream->write(data);
+
+  AsyncWriter *writer = getWriter();
+  std::unique_lock<std::mutex> lock(writer->theMutex);
+
+  // backpressure: wait while the queue is full, unless it is empty
+  writer->queueChanged.wait(lock, [writer, size] {
+      return writer->theQueue.empty() || writer->numQueued + size <= writer->maxQueued;});
+
+  // reuse a buffer of the right size if there is one
+  double *copy = 0;
+  for (int i=(int)writer->freeData.size()-1; i>=0; i--) {
+    if (writer->freeSizes[i] == size) {
+      copy = writer->freeData[i];
+      writer->freeData[i] = writer->freeData.back();
+      writer->freeSizes[i] = writer->freeSizes.back();
+      writer->freeData.pop_back();
+      writer->freeSizes.pop_back();
+      break;
+    }
+  }
+
+  // do not let the unused buffers grow without bound
+  if (writer->freeData.size() > 1024) {
+    for (size_t i=0; i<writer->freeData.size(); i++)
+      delete [] writer->freeData[i];
+    writer->freeData.clear();
+    writer->freeSizes.clear();
+  }
+
+  if (copy == 0)
+    copy = new double[size];
+  for (int i=0; i<size; i++)
+    copy[i] = data(i);
+
+  AsyncWrite theWrite;
+  theWrite.theStream = this;
+  theWrite.data = copy;
+  theWrite.size = size;
+  writer->theQueue.push_back(theWrite);
+  writer->numQueued += size;
+  numPending++;
+  writer->queueChanged.notify_all();
+
+  return 0;
+}
+
+void
+AsyncStream::writeQueued(double *data, int size)
+{
+  Vector theData(data, size);
+  theStream->write(theData);
+
+  std::lock_guard<std::mutex> lock(theWriter->theMutex);
+  numPending--;
+}
+
+//
+// everything else waits for the queued data and is then passed on
+//
+
+int
+AsyncStream::setFile(const char *fileName, openMode mode, bool echo)
+{
+  this->flush();
+  return theStream->setFile(fileName, mode, echo);
+}
+
+int
+AsyncStream::setPrecision(int prec)
+{
+  this->flush();
+  return theStream->setPrecision(prec);
+}
+
+int
+AsyncStream::setFloatField(floatField field)
+{
+  this->flush();
+  return theStream->setFloatField(field);
+}
+
+int
+AsyncStream::precision(int prec)
+{
+  this->flush();
+  return theStream->precision(prec);
+}
+
+int
+AsyncStream::width(int w)
+{
+  this->flush();
+  return theStream->width(w);
+}
+
+int
+AsyncStream::tag(const char *tagName)
+{
+  this->flush();
+  return theStream->tag(tagName);
+}
+
+int
+AsyncStream::tag(const char *tagName, const char *value)
+{
+  this->flush();
+  return theStream->tag(tagName, value);
+}
+
+int
+AsyncStream::endTag()
+{
+  this->flush();
+  return theStream->endTag();
+}
+
+int
+AsyncStream::attr(const char *name, int value)
+{
+  this->flush();
+  return theStream->attr(name, value);
+}
+
+int
+AsyncStream::attr(const char *name, double value)
+{
+  this->flush();
+  return theStream->attr(name, value);
+}
+
+int
+AsyncStream::attr(const char *name, const char *value)
+{
+  this->flush();
+  return theStream->attr(name, value);
+}
+
+OPS_Stream &
+AsyncStream::write(const char *s, int n)
+{
+  this->flush();
+  theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::write(const unsigned char *s, int n)
+{
+  this->flush();
+  theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::write(const signed char *s, int n)
+{
+  this->flush();
+  theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::write(const void *s, int n)
+{
+  this->flush();
+  theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::write(const double *s, int n)
+{
+  this->flush();
+  theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(char c)
+{
+  this->flush();
+  (*theStream) << c;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(unsigned char c)
+{
+  this->flush();
+  (*theStream) << c;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(signed char c)
+{
+  this->flush();
+  (*theStream) << c;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(const char *s)
+{
+  this->flush();
+  (*theStream) << s;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(const unsigned char *s)
+{
+  this->flush();
+  (*theStream) << s;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(const signed char *s)
+{
+  this->flush();
+  (*theStream) << s;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(const void *p)
+{
+  this->flush();
+  (*theStream) << p;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(int n)
+{
+  this->flush();
+  (*theStream) << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(unsigned int n)
+{
+  this->flush();
+  (*theStream) << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(long n)
+{
+  this->flush();
+  (*theStream) << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(unsigned long n)
+{
+  this->flush();
+  (*theStream) << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(short n)
+{
+  this->flush();
+  (*theStream) << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(unsigned short n)
+{
+  this->flush();
+  (*theStream) << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(bool b)
+{
+  this->flush();
+  (*theStream) << b;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(double n)
+{
+  this->flush();
+  (*theStream) << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(float n)
+{
+  this->flush();
+  (*theStream) << n;
+  return *this;
+}
+
+int
+AsyncStream::setOrder(const ID &order)
+{
+  this->flush();
+  return theStream->setOrder(order);
+}
+
+int
+AsyncStream::sendSelf(int commitTag, Channel &theChannel)
+{
+  this->flush();
+
+  // the class of the wrapped stream, then the wrapped stream
+  static ID idData(1);
+  idData(0) = theStream->getClassTag();
+  if (theChannel.sendID(0, commitTag, idData) < 0) {
+    opserr << "AsyncStream::sendSelf() - failed to send the stream class tag\n";
+    return -1;
+  }
+
+  return theStream->sendSelf(commitTag, theChannel);
+}
+
+int
+AsyncStream::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  this->flush();
+
+  static ID idData(1);
+  if (theChannel.recvID(0, commitTag, idData) < 0) {
+    opserr << "AsyncStream::recvSelf() - failed to recv the stream class tag\n";
+    return -1;
+  }
+
+  if (theStream == 0 || theStream->getClassTag() != idData(0)) {
+    if (theStream != 0)
+      delete theStream;
+    theStream = theBroker.getPtrNewStream(idData(0));
+    if (theStream == 0) {
+      opserr << "AsyncStream::recvSelf() - no stream of class tag " << idData(0) << endln;
+      return -1;
+    }
+  }
+
+  return theStream->recvSelf(commitTag, theChannel, theBroker);
+}
@@ -0,0 +1,104 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef _AsyncStream
+#define _AsyncStream
+
+// Description: AsyncStream wraps another OPS_Stream. The Vectors given to
+// write(Vector &) are copied into a bounded queue and written to the
+// wrapped stream by a background writer thread shared by all AsyncStreams,
+// so the formatting and the file i/o are taken off the analysis thread.
+// When the queue is full the caller waits for the writer. Any other call
+// first waits until the data already queued for this stream is written,
+// so the order of the output is unchanged. Deleting the AsyncStream
+// flushes it and deletes the wrapped stream. sendSelf() sends the class
+// tag of the wrapped stream ahead of it, so the receiving AsyncStream
+// creates the wrapped stream through the broker.
+
+#include <OPS_Stream.h>
+
+class AsyncStream : public OPS_Stream
+{
+ public:
+  AsyncStream(OPS_Stream *theStream = 0);
+  ~AsyncStream();
+
+  // wait for everything queued for this stream to be written
+  int flush(void);
+
+  long long getNumBytes(void);
+  double getFlushTime(void);
+
+  // bound on the doubles queued by all AsyncStreams
+  static void setMaxQueued(int numDoubles);
+
+  int setFile(const char *fileName, openMode mode = OVERWRITE, bool echo = false);
+  int setPrecision(int precision);
+  int setFloatField(floatField);
+  int precision(int precision);
+  int width(int width);
+
+  // xml stuff
+  int tag(const char *);
+  int tag(const char *, const char *);
+  int endTag();
+  int attr(const char *name, int value);
+  int attr(const char *name, double value);
+  int attr(const char *name, const char *value);
+  int write(Vector &data);
+
+  OPS_Stream& write(const char *s, int n);
+  OPS_Stream& write(const unsigned char *s, int n);
+  OPS_Stream& write(const signed char *s, int n);
+  OPS_Stream& write(const void *s, int n);
+  OPS_Stream& write(const double *s, int n);
+  OPS_Stream& operator<<(char c);
+  OPS_Stream& operator<<(unsigned char c);
+  OPS_Stream& operator<<(signed char c);
+  OPS_Stream& operator<<(const char *s);
+  OPS_Stream& operator<<(const unsigned char *s);
+  OPS_Stream& operator<<(const signed char *s);
+  OPS_Stream& operator<<(const void *p);
+  OPS_Stream& operator<<(int n);
+  OPS_Stream& operator<<(unsigned int n);
+  OPS_Stream& operator<<(long n);
+  OPS_Stream& operator<<(unsigned long n);
+  OPS_Stream& operator<<(short n);
+  OPS_Stream& operator<<(unsigned short n);
+  OPS_Stream& operator<<(bool b);
+  OPS_Stream& operator<<(double n);
+  OPS_Stream& operator<<(float n);
+
+  int setOrder(const ID &order);
+
+  int sendSelf(int commitTag, Channel &theChannel);
+  int recvSelf(int commitTag, Channel &theChannel, 
+	       FEM_ObjectBroker &theBroker);
+
+  // used by the writer thread
+  void writeQueued(double *data, int size);
+
+ private:
+  OPS_Stream *theStream;
+  double flushTime;        // time spent waiting in flush()
+  int numPending;          // writes queued or being written
+};
+
+#endif
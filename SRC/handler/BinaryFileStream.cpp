@@ -23,6 +23,7 @@
 // $Source: /usr/local/cvs/OpenSees/SRC/handler/BinaryFileStream.cpp,v $
 
 #include <BinaryFileStream.h>
+#include <DataFileStream.h>
 #include <Vector.h>
 #include <iostream>
 #include <iomanip>
@@ -31,6 +32,7 @@
 #include <Channel.h>
 #include <Message.h>
 #include <Matrix.h>
+#include <chrono>
 
 using std::cerr;
 using std::ios;
@@ -43,7 +45,8 @@ BinaryFileStream::BinaryFileStream()
   :OPS_Stream(OPS_STREAM_TAGS_BinaryFileStream), 
    fileOpen(0), fileName(0), sendSelfCount(0),
    theChannels(0), numDataRows(0),
-   mapping(0), maxCount(0), sizeColumns(0), theColumns(0), theData(0), theRemoteData(0)
+   mapping(0), maxCount(0), sizeColumns(0), theColumns(0), theData(0), theRemoteData(0),
+   processFiles(false), numBytes(0), flushTime(0.0)
 {
 
 }
@@ -52,7 +55,8 @@ BinaryFileStream::BinaryFileStream(const char *file, openMode mode)
   :OPS_Stream(OPS_STREAM_TAGS_BinaryFileStream), 
    fileOpen(0), fileName(0), sendSelfCount(0),
    theChannels(0), numDataRows(0),
-   mapping(0), maxCount(0), sizeColumns(0), theColumns(0), theData(0), theRemoteData(0)
+   mapping(0), maxCount(0), sizeColumns(0), theColumns(0), theData(0), theRemoteData(0),
+   processFiles(false), numBytes(0), flushTime(0.0)
 {
   this->setFile(file, mode);
 }
@@ -135,6 +139,13 @@ BinaryFileStream::setFile(const char *name, openMode mode)
   return 0;
 }
 
+int
+BinaryFileStream::setProcessFiles(bool onOff)
+{
+  processFiles = onOff;
+  return 0;
+}
+
 int 
 BinaryFileStream::open(void)
 {
@@ -170,13 +181,30 @@ BinaryFileStream::open(void)
 int 
 BinaryFileStream::close(void)
 {
-  if (fileOpen != 0)
+  if (fileOpen != 0) {
+    numBytes = this->getNumBytes();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
     theFile.close();
+    flushTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
   fileOpen = 0;
 
   return 0;
 }
 
+long long
+BinaryFileStream::getNumBytes(void)
+{
+  // the file is written sequentially so its position is its size
+  if (fileOpen != 0) {
+    long long pos = (long long)theFile.tellp();
+    if (pos > numBytes)
+      return pos;
+  }
+
+  return numBytes;
+}
+
 
 int 
 BinaryFileStream::setPrecision(int prec)
@@ -244,7 +272,17 @@ BinaryFileStream::write(Vector &data)
   }
 
   //
-  // otherwise parallel, send the data if not p0
+  // otherwise parallel, with process files each process writes its own
+  //
+
+  if (processFiles == true) {
+    if (data.Size() != 0)
+      (*this) << data;
+    return 0;
+  }
+
+  //
+  // otherwise send the data if not p0
   //
 
   if (sendSelfCount < 0) {
@@ -329,7 +367,9 @@ BinaryFileStream::write(const double *s, int n)
     theFile.write((char *)(&s[0]), 8*n);
 
     theFile << '\n';
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
     theFile.flush();
+    flushTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
   }
   return *this;
 }
@@ -503,7 +543,7 @@ BinaryFileStream::sendSelf(int commitTag, Channel &theChannel)
     delete [] theChannels;
   theChannels = theNextChannels;
 
-  static ID idData(3);
+  static ID idData(4);
   int fileNameLength = 0;
   if (fileName != 0)
     fileNameLength = strlen(fileName);
@@ -516,6 +556,7 @@ BinaryFileStream::sendSelf(int commitTag, Channel &theChannel)
     idData(1) = 1;
 
   idData(2) = sendSelfCount;
+  idData(3) = processFiles;
 
   if (theChannel.sendID(0, commitTag, idData) < 0) {
     opserr << "BinaryFileStream::sendSelf() - failed to send id data\n";
@@ -536,7 +577,7 @@ BinaryFileStream::sendSelf(int commitTag, Channel &theChannel)
 int 
 BinaryFileStream::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
-  static ID idData(3);
+  static ID idData(4);
 
   sendSelfCount = -1;
   theChannels = new Channel *[1];
@@ -553,10 +594,12 @@ BinaryFileStream::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
   else
     theOpenMode = APPEND;
 
+  processFiles = (idData(3) == 1);
+
   if (fileNameLength != 0) {
     if (fileName != 0)
       delete [] fileName;
-    fileName = new char[fileNameLength+5];
+    fileName = new char[fileNameLength+10];
     if (fileName == 0) {
       opserr << "BinaryFileStream::recvSelf() - out of memory\n";
       return -1;
@@ -827,6 +870,15 @@ BinaryFileStream::setOrder(const ID &orderData)
       }
     }
 
+    // with process files only the index is needed, p0 writing to fileName.0
+    if (processFiles == true) {
+      int result = writeProcessFileIndex(fileName, "binary", sendSelfCount+1, theColumns);
+      string p0Name(fileName);
+      p0Name += ".0";
+      this->setFile(p0Name.c_str(), OVERWRITE);
+      return result;
+    }
+
     ID currentLoc(sendSelfCount+1);
     ID currentCount(sendSelfCount+1);
 	
@@ -52,6 +52,9 @@ class BinaryFileStream : public OPS_Stream
   int precision(int precision) {return 0;};
   int width(int width) {return 0;};
   const char *getFileName(void) {return fileName;}
+  int setProcessFiles(bool onOff);
+  long long getNumBytes(void);
+  double getFlushTime(void) {return flushTime;};
 
   // xml stuff
   int tag(const char *);
@@ -108,6 +111,11 @@ class BinaryFileStream : public OPS_Stream
   ID **theColumns;
   double **theData;
   Vector **theRemoteData;
+
+  bool processFiles;
+
+  long long numBytes;    // bytes in the file when last closed
+  double flushTime;
 };
 
 #endif
@@ -0,0 +1,418 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of ColumnarBinaryStream.
+
+#include <ColumnarBinaryStream.h>
+#include <Vector.h>
+#include <OPS_Globals.h>
+#include <string.h>
+#include <stdio.h>
+#include <limits>
+
+using std::ios;
+
+static const char COLB_MAGIC[8] = {'O','P','S','C','O','L','B','1'};
+static const int COLB_HEADER_SIZE = 64;
+static const int COLB_SCHEMA_SIZE = 64;
+static const int COLB_NAME_SIZE = 48;
+static const int COLB_MAX_OPEN = 16;
+
+// rows per block chosen so a block of all the columns is ~4MB
+static const int COLB_BLOCK_DOUBLES = 512*1024;
+static const int COLB_MAX_CHUNK_ROWS = 1024;
+
+ColumnarBinaryStream::ColumnarBinaryStream(const char *name)
+  :OPS_Stream(OPS_STREAM_TAGS_ColumnarBinaryStream),
+   fileName(0),
+   numColumns(0), maxColumns(0), colTags(0), colTypes(0), colComps(0), colNames(0),
+   numOpen(0),
+   dataStarted(false), dataOffset(0), numRows(0), chunkRows(0), rowsInChunk(0), chunk(0),
+   numBlocks(0), maxBlocks(0), blockOffsets(0), blockRows(0)
+{
+  fileName = new char[strlen(name)+1];
+  strcpy(fileName, name);
+
+  theFile.open(fileName, ios::out | ios::trunc | ios::binary);
+  if (theFile.bad() || !theFile.is_open()) {
+    opserr << "WARNING ColumnarBinaryStream::ColumnarBinaryStream() - could not open file ";
+    opserr << fileName << endln;
+  }
+}
+
+ColumnarBinaryStream::~ColumnarBinaryStream()
+{
+  if (theFile.is_open()) {
+
+    // a recorder that never wrote still leaves a valid (empty) file
+    if (dataStarted == false)
+      this->startData(numColumns);
+
+    if (rowsInChunk > 0)
+      this->writeBlock();
+
+    // the block index goes at the end, after the last block
+    long long indexOffset = dataOffset +
+      numBlocks*(long long)chunkRows*numColumns*(long long)sizeof(double);
+    theFile.seekp(indexOffset);
+    if (numBlocks > 0) {
+      theFile.write((char *)blockOffsets, numBlocks*sizeof(long long));
+      theFile.write((char *)blockRows, numBlocks*sizeof(long long));
+    }
+    this->writeHeader(indexOffset);
+    theFile.close();
+  }
+
+  if (fileName != 0)
+    delete [] fileName;
+  if (colTags != 0) {
+    delete [] colTags;
+    delete [] colTypes;
+    delete [] colComps;
+    delete [] colNames;
+  }
+  if (chunk != 0)
+    delete [] chunk;
+  if (blockOffsets != 0) {
+    delete [] blockOffsets;
+    delete [] blockRows;
+  }
+}
+
+int 
+ColumnarBinaryStream::tag(const char *tagName)
+{
+  if (numOpen < COLB_MAX_OPEN) {
+    strncpy(openTags[numOpen], tagName, COLB_NAME_SIZE-1);
+    openTags[numOpen][COLB_NAME_SIZE-1] = '\0';
+    openObjectTag[numOpen] = 0;
+    openTagLevel[numOpen] = 0;
+    openFirstInt[numOpen] = 0;
+    openHasInt[numOpen] = false;
+    openNumComps[numOpen] = 0;
+  }
+  numOpen++;
+
+  return 0;
+}
+
+int 
+ColumnarBinaryStream::tag(const char *tagName, const char *value)
+{
+  if (strcmp(tagName, "ResponseType") != 0 || dataStarted == true)
+    return 0;
+
+  // the column belongs to the innermost ...Output tag open
+  int top = (numOpen < COLB_MAX_OPEN) ? numOpen : COLB_MAX_OPEN;
+  int output = -1;
+  for (int i=top-1; i>=0 && output == -1; i--) {
+    int length = strlen(openTags[i]);
+    if (length >= 6 && strcmp(&openTags[i][length-6], "Output") == 0)
+      output = i;
+  }
+
+  int type = 4;
+  int objectTag = 0;
+  int component = numColumns+1;
+  if (output != -1) {
+    if (strcmp(openTags[output], "TimeOutput") == 0)
+      type = 0;
+    else if (strcmp(openTags[output], "NodeOutput") == 0)
+      type = 1;
+    else if (strcmp(openTags[output], "ElementOutput") == 0)
+      type = 2;
+    else if (strcmp(openTags[output], "DriftOutput") == 0)
+      type = 3;
+    objectTag = openObjectTag[output];
+    component = ++openNumComps[output];
+  }
+
+  // the name is the path of the tags inside the output tag, e.g.
+  // GaussPoint1/SectionForceDeformation3/P
+  char name[256];
+  name[0] = '\0';
+  for (int i=output+1; i<top; i++) {
+    char level[COLB_NAME_SIZE+16];
+    if (openHasInt[i] == true)
+      sprintf(level, "%s%d/", openTags[i], openFirstInt[i]);
+    else
+      sprintf(level, "%s/", openTags[i]);
+    if (strlen(name) + strlen(level) < 200)
+      strcat(name, level);
+  }
+  strncat(name, value, 255-strlen(name));
+
+  // add the column
+  if (numColumns == maxColumns) {
+    int newMax = (maxColumns == 0) ? 64 : 2*maxColumns;
+    int *newTags = new int[newMax];
+    int *newTypes = new int[newMax];
+    int *newComps = new int[newMax];
+    char (*newNames)[COLB_NAME_SIZE] = new char[newMax][COLB_NAME_SIZE];
+    if (numColumns > 0) {
+      memcpy(newTags, colTags, numColumns*sizeof(int));
+      memcpy(newTypes, colTypes, numColumns*sizeof(int));
+      memcpy(newComps, colComps, numColumns*sizeof(int));
+      memcpy(newNames, colNames, numColumns*COLB_NAME_SIZE);
+      delete [] colTags;
+      delete [] colTypes;
+      delete [] colComps;
+      delete [] colNames;
+    }
+    colTags = newTags;
+    colTypes = newTypes;
+    colComps = newComps;
+    colNames = newNames;
+    maxColumns = newMax;
+  }
+
+  colTags[numColumns] = objectTag;
+  colTypes[numColumns] = type;
+  colComps[numColumns] = component;
+  memset(colNames[numColumns], 0, COLB_NAME_SIZE);
+  strncpy(colNames[numColumns], name, COLB_NAME_SIZE-1);
+  numColumns++;
+
+  return 0;
+}
+
+int 
+ColumnarBinaryStream::endTag()
+{
+  if (numOpen > 0)
+    numOpen--;
+
+  return 0;
+}
+
+int 
+ColumnarBinaryStream::attr(const char *name, int value)
+{
+  int i = numOpen-1;
+  if (i < 0 || i >= COLB_MAX_OPEN)
+    return 0;
+
+  // the object tag is the nodeTag, eleTag or node1 attribute if there is
+  // one, the first integer attribute otherwise
+  if (strcmp(name, "nodeTag") == 0 || strcmp(name, "eleTag") == 0 ||
+      strcmp(name, "node1") == 0) {
+    if (openTagLevel[i] < 2) {
+      openObjectTag[i] = value;
+      openTagLevel[i] = 2;
+    }
+  } else if (openTagLevel[i] == 0) {
+    openObjectTag[i] = value;
+    openTagLevel[i] = 1;
+  }
+
+  if (openHasInt[i] == false) {
+    openFirstInt[i] = value;
+    openHasInt[i] = true;
+  }
+
+  return 0;
+}
+
+int 
+ColumnarBinaryStream::attr(const char *name, double value)
+{
+  return 0;
+}
+
+int 
+ColumnarBinaryStream::attr(const char *name, const char *value)
+{
+  return 0;
+}
+
+int
+ColumnarBinaryStream::startData(int dataSize)
+{
+  dataStarted = true;
+
+  // the schema should describe every value written
+  if (dataSize != numColumns) {
+    if (numColumns != 0) {
+      opserr << "WARNING ColumnarBinaryStream - " << fileName << " has " << numColumns;
+      opserr << " columns described but rows of " << dataSize << " values\n";
+    }
+
+    if (dataSize > maxColumns) {
+      int *newTags = new int[dataSize];
+      int *newTypes = new int[dataSize];
+      int *newComps = new int[dataSize];
+      char (*newNames)[COLB_NAME_SIZE] = new char[dataSize][COLB_NAME_SIZE];
+      if (numColumns > 0) {
+	memcpy(newTags, colTags, numColumns*sizeof(int));
+	memcpy(newTypes, colTypes, numColumns*sizeof(int));
+	memcpy(newComps, colComps, numColumns*sizeof(int));
+	memcpy(newNames, colNames, numColumns*COLB_NAME_SIZE);
+	delete [] colTags;
+	delete [] colTypes;
+	delete [] colComps;
+	delete [] colNames;
+      }
+      colTags = newTags;
+      colTypes = newTypes;
+      colComps = newComps;
+      colNames = newNames;
+      maxColumns = dataSize;
+    }
+
+    for (int j=numColumns; j<dataSize; j++) {
+      colTags[j] = 0;
+      colTypes[j] = 4;
+      colComps[j] = j+1;
+      memset(colNames[j], 0, COLB_NAME_SIZE);
+    }
+    numColumns = dataSize;
+  }
+
+  chunkRows = COLB_MAX_CHUNK_ROWS;
+  if (numColumns > 0 && COLB_BLOCK_DOUBLES/numColumns < chunkRows)
+    chunkRows = COLB_BLOCK_DOUBLES/numColumns;
+  if (chunkRows < 1)
+    chunkRows = 1;
+
+  int chunkSize = chunkRows*numColumns;
+  if (chunkSize > 0)
+    chunk = new double[chunkSize];
+
+  dataOffset = COLB_HEADER_SIZE + (long long)numColumns*COLB_SCHEMA_SIZE;
+
+  // header, then the schema
+  this->writeHeader(0);
+
+  for (int j=0; j<numColumns; j++) {
+    char record[COLB_SCHEMA_SIZE];
+    int values[4];
+    values[0] = colTags[j];
+    values[1] = colTypes[j];
+    values[2] = colComps[j];
+    values[3] = 0;
+    memcpy(record, values, 4*sizeof(int));
+    memcpy(&record[16], colNames[j], COLB_NAME_SIZE);
+    theFile.write(record, COLB_SCHEMA_SIZE);
+  }
+  theFile.flush();
+
+  return 0;
+}
+
+int
+ColumnarBinaryStream::writeHeader(long long indexOffset)
+{
+  long long header[8];
+  memcpy(header, COLB_MAGIC, 8);
+  header[1] = numColumns;
+  header[2] = numRows - rowsInChunk;    // only the rows already on disk
+  header[3] = chunkRows;
+  header[4] = numBlocks;
+  header[5] = dataOffset;
+  header[6] = indexOffset;
+  header[7] = 0;
+
+  theFile.seekp(0);
+  theFile.write((char *)header, COLB_HEADER_SIZE);
+
+  return 0;
+}
+
+int
+ColumnarBinaryStream::writeBlock(void)
+{
+  // pad the rows of a last part block
+  double nan = std::numeric_limits<double>::quiet_NaN();
+  for (int j=0; j<numColumns; j++)
+    for (int i=rowsInChunk; i<chunkRows; i++)
+      chunk[j*chunkRows+i] = nan;
+
+  if (numBlocks == maxBlocks) {
+    long long newMax = (maxBlocks == 0) ? 64 : 2*maxBlocks;
+    long long *newOffsets = new long long[newMax];
+    long long *newRows = new long long[newMax];
+    if (numBlocks > 0) {
+      memcpy(newOffsets, blockOffsets, numBlocks*sizeof(long long));
+      memcpy(newRows, blockRows, numBlocks*sizeof(long long));
+      delete [] blockOffsets;
+      delete [] blockRows;
+    }
+    blockOffsets = newOffsets;
+    blockRows = newRows;
+    maxBlocks = newMax;
+  }
+
+  long long blockSize = (long long)chunkRows*numColumns*sizeof(double);
+  long long offset = dataOffset + numBlocks*blockSize;
+
+  theFile.seekp(offset);
+  theFile.write((char *)chunk, blockSize);
+
+  blockOffsets[numBlocks] = offset;
+  blockRows[numBlocks] = rowsInChunk;
+  numBlocks++;
+  rowsInChunk = 0;
+
+  // keep the header current so the file can be read if the run stops
+  this->writeHeader(0);
+  theFile.flush();
+
+  return 0;
+}
+
+int 
+ColumnarBinaryStream::write(Vector &data)
+{
+  if (theFile.is_open() == false)
+    return -1;
+
+  if (dataStarted == false)
+    this->startData(data.Size());
+
+  if (numColumns == 0)
+    return 0;
+
+  int size = data.Size();
+  double nan = std::numeric_limits<double>::quiet_NaN();
+  for (int j=0; j<numColumns; j++)
+    chunk[j*chunkRows+rowsInChunk] = (j < size) ? data(j) : nan;
+
+  rowsInChunk++;
+  numRows++;
+
+  if (rowsInChunk == chunkRows)
+    this->writeBlock();
+
+  return 0;
+}
+
+int 
+ColumnarBinaryStream::sendSelf(int commitTag, Channel &theChannel)
+{
+  opserr << "ColumnarBinaryStream::sendSelf() - not yet implemented\n";
+  return -1;
+}
+
+int 
+ColumnarBinaryStream::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  opserr << "ColumnarBinaryStream::recvSelf() - not yet implemented\n";
+  return -1;
+}
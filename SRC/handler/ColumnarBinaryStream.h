@@ -0,0 +1,118 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+#ifndef _ColumnarBinaryStream
+#define _ColumnarBinaryStream
+
+// Description: ColumnarBinaryStream writes recorder output as a self
+// describing binary file, little endian on the usual machines:
+//
+//  header, 64 bytes:  char magic[8] "OPSCOLB1", then int64 numColumns,
+//                     numRows, chunkRows, numBlocks, dataOffset,
+//                     indexOffset (0 until the file is closed), 0
+//  schema:            numColumns records of 64 bytes: int32 objectTag,
+//                     int32 objectType (0 time, 1 node, 2 element,
+//                     3 drift, 4 other), int32 component (1 based, within
+//                     the object), int32 0, char name[48]
+//  blocks:            numBlocks blocks each of chunkRows rows of all the
+//                     columns, stored column after column (float64); the
+//                     rows of the last block past numRows are NaN
+//  index:             int64 offset[numBlocks], int64 rows[numBlocks]
+//
+// so that from NumPy, with h the header read as int64:
+//
+//   schema = numpy.memmap(f, dtype=[('tag','<i4'),('type','<i4'),
+//            ('comp','<i4'),('pad','<i4'),('name','S48')], mode='r',
+//            offset=64, shape=(h[1],))
+//   data   = numpy.memmap(f, dtype='<f8', mode='r', offset=h[5],
+//            shape=(h[4],h[1],h[3]))
+//   column = data[:,j,:].ravel()[:h[2]]
+//
+// The schema is built from the tag(), attr() and endTag() calls made by
+// the recorder while it sets up: each ResponseType becomes a column of
+// the innermost enclosing ...Output tag. The header is rewritten after
+// every block, so a file from an analysis that stops is still readable.
+
+#include <OPS_Stream.h>
+
+#include <fstream>
+using std::ofstream;
+
+class ColumnarBinaryStream : public OPS_Stream
+{
+ public:
+  ColumnarBinaryStream(const char *fileName);
+  ~ColumnarBinaryStream();
+
+  // xml stuff, used to build the schema
+  int tag(const char *);
+  int tag(const char *, const char *);
+  int endTag();
+  int attr(const char *name, int value);
+  int attr(const char *name, double value);
+  int attr(const char *name, const char *value);
+
+  // a row of data
+  int write(Vector &data);
+
+  int sendSelf(int commitTag, Channel &theChannel);
+  int recvSelf(int commitTag, Channel &theChannel, 
+	       FEM_ObjectBroker &theBroker);
+
+ private:
+  int startData(int dataSize);
+  int writeHeader(long long indexOffset);
+  int writeBlock(void);
+
+  ofstream theFile;
+  char *fileName;
+
+  // schema, filled in while the recorder sets up
+  int numColumns;
+  int maxColumns;
+  int *colTags;
+  int *colTypes;
+  int *colComps;
+  char (*colNames)[48];
+
+  // open tags
+  int numOpen;
+  char openTags[16][48];
+  int openObjectTag[16];
+  int openTagLevel[16];   // 0 no tag, 1 first int attr, 2 nodeTag, eleTag ..
+  int openFirstInt[16];
+  bool openHasInt[16];
+  int openNumComps[16];
+
+  // data
+  bool dataStarted;
+  long long dataOffset;
+  long long numRows;
+  int chunkRows;
+  int rowsInChunk;
+  double *chunk;
+  long long numBlocks;
+  long long maxBlocks;
+  long long *blockOffsets;
+  long long *blockRows;
+};
+
+#endif
@@ -0,0 +1,449 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of CompressedStream
+// and CompressedStreamReader.
+
+#include <CompressedStream.h>
+#include <Vector.h>
+#include <OPS_Globals.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+using std::ios;
+
+typedef unsigned long long bits64;
+
+static const char XORC_MAGIC[8] = {'O','P','S','X','O','R','C','1'};
+static const int XORC_RECORD_BYTES = 256*1024;
+
+static inline bits64
+toBits(double value)
+{
+  bits64 result;
+  memcpy(&result, &value, sizeof(double));
+  return result;
+}
+
+static inline double
+toDouble(bits64 value)
+{
+  double result;
+  memcpy(&result, &value, sizeof(double));
+  return result;
+}
+
+static inline int
+leadingZeros(bits64 x)
+{
+#ifdef __GNUC__
+  return (x == 0) ? 64 : __builtin_clzll(x);
+#else
+  int n = 0;
+  for (bits64 mask = 1ULL << 63; mask != 0 && (x & mask) == 0; mask >>= 1)
+    n++;
+  return n;
+#endif
+}
+
+static inline int
+trailingZeros(bits64 x)
+{
+#ifdef __GNUC__
+  return (x == 0) ? 64 : __builtin_ctzll(x);
+#else
+  int n = 0;
+  for (bits64 mask = 1; mask != 0 && (x & mask) == 0; mask <<= 1)
+    n++;
+  return n;
+#endif
+}
+
+// the linear extrapolation, evaluated in the same way when writing and
+// reading; the previous value if not finite, as the bits of a NaN result
+// may differ between machines
+static inline double
+extrapolate(const CompressedChannel &channel)
+{
+  double result = channel.prev1 + (channel.prev1 - channel.prev2);
+  if (result - result != 0.0)
+    return channel.prev1;
+  return result;
+}
+
+static void
+initChannels(CompressedChannel *channels, int numColumns)
+{
+  for (int j=0; j<numColumns; j++) {
+    channels[j].prev1 = 0.0;
+    channels[j].prev2 = 0.0;
+    channels[j].lead = 64;
+    channels[j].trail = 64;
+  }
+}
+
+
+CompressedStream::CompressedStream(const char *name)
+  :OPS_Stream(OPS_STREAM_TAGS_CompressedStream),
+   fileName(0), numColumns(-1), channels(0),
+   buffer(0), bufferSize(0), numBytes(0), currentByte(0), currentBits(0), rowsInRecord(0)
+{
+  fileName = new char[strlen(name)+1];
+  strcpy(fileName, name);
+
+  theFile.open(fileName, ios::out | ios::trunc | ios::binary);
+  if (theFile.bad() || !theFile.is_open()) {
+    opserr << "WARNING CompressedStream::CompressedStream() - could not open file ";
+    opserr << fileName << endln;
+  }
+}
+
+CompressedStream::~CompressedStream()
+{
+  if (theFile.is_open()) {
+    if (numColumns < 0) {
+      numColumns = 0;
+      theFile.write(XORC_MAGIC, 8);
+      int header[2] = {0, 0};
+      theFile.write((char *)header, 2*sizeof(int));
+    }
+    this->writeRecord();
+    theFile.close();
+  }
+
+  if (fileName != 0)
+    delete [] fileName;
+  if (channels != 0)
+    delete [] channels;
+  if (buffer != 0)
+    delete [] buffer;
+}
+
+void
+CompressedStream::putBits(bits64 value, int num)
+{
+  while (num > 0) {
+    int take = 8 - currentBits;
+    if (take > num)
+      take = num;
+    unsigned int bits = (unsigned int)(value >> (num - take)) & ((1u << take) - 1);
+    currentByte = (currentByte << take) | bits;
+    currentBits += take;
+    num -= take;
+
+    if (currentBits == 8) {
+      if (numBytes == bufferSize) {
+	int newSize = 2*bufferSize;
+	unsigned char *newBuffer = new unsigned char[newSize];
+	memcpy(newBuffer, buffer, numBytes);
+	delete [] buffer;
+	buffer = newBuffer;
+	bufferSize = newSize;
+      }
+      buffer[numBytes++] = (unsigned char)currentByte;
+      currentByte = 0;
+      currentBits = 0;
+    }
+  }
+}
+
+int
+CompressedStream::writeRecord(void)
+{
+  if (rowsInRecord == 0)
+    return 0;
+
+  // records start on a byte
+  if (currentBits != 0)
+    this->putBits(0, 8 - currentBits);
+
+  int header[2];
+  header[0] = rowsInRecord;
+  header[1] = numBytes;
+  theFile.write((char *)header, 2*sizeof(int));
+  theFile.write((char *)buffer, numBytes);
+  theFile.flush();
+
+  numBytes = 0;
+  rowsInRecord = 0;
+
+  return 0;
+}
+
+int 
+CompressedStream::write(Vector &data)
+{
+  if (theFile.is_open() == false)
+    return -1;
+
+  int size = data.Size();
+
+  // the first row sets the number of channels
+  if (numColumns < 0) {
+    numColumns = size;
+    theFile.write(XORC_MAGIC, 8);
+    int header[2];
+    header[0] = numColumns;
+    header[1] = 0;
+    theFile.write((char *)header, 2*sizeof(int));
+
+    if (numColumns > 0) {
+      channels = new CompressedChannel[numColumns];
+      initChannels(channels, numColumns);
+    }
+    bufferSize = XORC_RECORD_BYTES + 16*numColumns + 16;
+    buffer = new unsigned char[bufferSize];
+  }
+
+  if (size != numColumns) {
+    opserr << "WARNING CompressedStream::write() - " << fileName << " expects rows of ";
+    opserr << numColumns << " values, got " << size << endln;
+  }
+
+  for (int j=0; j<numColumns; j++) {
+    CompressedChannel &channel = channels[j];
+    double value = (j < size) ? data(j) : 0.0;
+
+    // choose the predictor leaving the fewer meaningful bits
+    bits64 bits = toBits(value);
+    bits64 xor1 = bits ^ toBits(channel.prev1);
+    bits64 xor2 = bits ^ toBits(extrapolate(channel));
+    int zeros1 = leadingZeros(xor1) + trailingZeros(xor1);
+    int zeros2 = leadingZeros(xor2) + trailingZeros(xor2);
+
+    bits64 x = xor1;
+    if (zeros2 > zeros1) {
+      x = xor2;
+      this->putBits(1, 1);
+    } else
+      this->putBits(0, 1);
+
+    if (x == 0)
+      this->putBits(0, 1);
+    else {
+      int lead = leadingZeros(x);
+      int trail = trailingZeros(x);
+      if (lead > 31)
+	lead = 31;
+
+      if (channel.lead != 64 && lead >= channel.lead && trail >= channel.trail) {
+	// fits the window of the previous value
+	this->putBits(2, 2);
+	this->putBits(x >> channel.trail, 64 - channel.lead - channel.trail);
+      } else {
+	int length = 64 - lead - trail;
+	this->putBits(3, 2);
+	this->putBits(lead, 5);
+	this->putBits(length - 1, 6);
+	this->putBits(x >> trail, length);
+	channel.lead = lead;
+	channel.trail = trail;
+      }
+    }
+
+    channel.prev2 = channel.prev1;
+    channel.prev1 = value;
+  }
+
+  rowsInRecord++;
+  if (numBytes >= XORC_RECORD_BYTES)
+    this->writeRecord();
+
+  return 0;
+}
+
+int 
+CompressedStream::sendSelf(int commitTag, Channel &theChannel)
+{
+  opserr << "CompressedStream::sendSelf() - not yet implemented\n";
+  return -1;
+}
+
+int 
+CompressedStream::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  opserr << "CompressedStream::recvSelf() - not yet implemented\n";
+  return -1;
+}
+
+
+CompressedStreamReader::CompressedStreamReader()
+  :numColumns(0), channels(0),
+   buffer(0), bufferSize(0), numBytes(0), position(0), currentByte(0), currentBits(0),
+   rowsInRecord(0)
+{
+
+}
+
+CompressedStreamReader::~CompressedStreamReader()
+{
+  if (channels != 0)
+    delete [] channels;
+  if (buffer != 0)
+    delete [] buffer;
+}
+
+int
+CompressedStreamReader::open(const char *fileName)
+{
+  theFile.open(fileName, ios::in | ios::binary);
+  if (theFile.bad() || !theFile.is_open()) {
+    opserr << "WARNING CompressedStreamReader::open() - could not open file " << fileName << endln;
+    return -1;
+  }
+
+  char magic[8];
+  int header[2];
+  theFile.read(magic, 8);
+  theFile.read((char *)header, 2*sizeof(int));
+  if (!theFile || memcmp(magic, XORC_MAGIC, 8) != 0 || header[0] < 0) {
+    opserr << "WARNING CompressedStreamReader::open() - " << fileName;
+    opserr << " is not a compressed recorder file\n";
+    return -1;
+  }
+
+  numColumns = header[0];
+  if (numColumns > 0) {
+    channels = new CompressedChannel[numColumns];
+    initChannels(channels, numColumns);
+  }
+
+  return 0;
+}
+
+int
+CompressedStreamReader::readRecord(void)
+{
+  int header[2];
+  theFile.read((char *)header, 2*sizeof(int));
+  if (!theFile || header[0] <= 0 || header[1] < 0)
+    return -1;
+
+  if (header[1] > bufferSize) {
+    if (buffer != 0)
+      delete [] buffer;
+    bufferSize = header[1];
+    buffer = new unsigned char[bufferSize];
+  }
+
+  theFile.read((char *)buffer, header[1]);
+  if (!theFile)
+    return -1;
+
+  rowsInRecord = header[0];
+  numBytes = header[1];
+  position = 0;
+  currentBits = 0;
+
+  return 0;
+}
+
+bits64
+CompressedStreamReader::getBits(int num)
+{
+  bits64 value = 0;
+  while (num > 0) {
+    if (currentBits == 0) {
+      currentByte = (position < numBytes) ? buffer[position++] : 0;
+      currentBits = 8;
+    }
+    int take = (currentBits < num) ? currentBits : num;
+    unsigned int bits = (currentByte >> (currentBits - take)) & ((1u << take) - 1);
+    value = (value << take) | bits;
+    currentBits -= take;
+    num -= take;
+  }
+
+  return value;
+}
+
+int
+CompressedStreamReader::readRow(double *data)
+{
+  if (rowsInRecord == 0 && this->readRecord() != 0)
+    return -1;
+
+  for (int j=0; j<numColumns; j++) {
+    CompressedChannel &channel = channels[j];
+
+    bits64 prediction = toBits(channel.prev1);
+    if (this->getBits(1) == 1)
+      prediction = toBits(extrapolate(channel));
+
+    bits64 x = 0;
+    if (this->getBits(1) == 1) {
+      if (this->getBits(1) == 0)
+	x = this->getBits(64 - channel.lead - channel.trail) << channel.trail;
+      else {
+	int lead = (int)this->getBits(5);
+	int length = (int)this->getBits(6) + 1;
+	int trail = 64 - lead - length;
+	x = this->getBits(length) << trail;
+	channel.lead = lead;
+	channel.trail = trail;
+      }
+    }
+
+    double value = toDouble(prediction ^ x);
+    data[j] = value;
+    channel.prev2 = channel.prev1;
+    channel.prev1 = value;
+  }
+
+  rowsInRecord--;
+
+  return 0;
+}
+
+
+int
+expandCompressedFile(const char *inputFilename, const char *outputFilename)
+{
+  CompressedStreamReader theReader;
+  if (theReader.open(inputFilename) != 0)
+    return -1;
+
+  FILE *output = fopen(outputFilename, "w");
+  if (output == 0) {
+    opserr << "WARNING expandCompressedFile() - could not open file " << outputFilename << endln;
+    return -1;
+  }
+
+  int numColumns = theReader.getNumColumns();
+  double *data = new double[numColumns > 0 ? numColumns : 1];
+
+  while (theReader.readRow(data) == 0) {
+    for (int j=0; j<numColumns; j++) {
+      // the shortest text that reads back to the same value
+      char text[32];
+      sprintf(text, "%.15g", data[j]);
+      if (strtod(text, 0) != data[j])
+	sprintf(text, "%.17g", data[j]);
+      fputs(text, output);
+      fputc((j < numColumns-1) ? ' ' : '\n', output);
+    }
+  }
+
+  delete [] data;
+  fclose(output);
+
+  return 0;
+}
@@ -0,0 +1,124 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef _CompressedStream
+#define _CompressedStream
+
+// Description: CompressedStream writes the rows of recorder output to a
+// binary file, each column (channel) compressed losslessly on its own in
+// the manner of the Gorilla and FPC floating point compressors. Each value
+// is predicted either as the previous value of the channel or by linear
+// extrapolation from the two previous values (which makes a time column of
+// constant step nearly free); one bit selects the better predictor and the
+// XOR of the value with the prediction is stored as:
+//
+//    '0'                            the XOR is zero
+//    '10' bits                      meaningful bits in the previous window
+//    '11' 5 bits lead, 6 bits len-1, bits
+//
+// The file is a 16 byte header, "OPSXORC1" and int numColumns, followed
+// by records each of int numRows, int numBytes and numBytes of bits. A
+// record holds whole rows and is written when its buffer fills, so a file
+// is readable up to the last record written. CompressedStreamReader
+// decodes a file; expandCompressedFile() writes it as text.
+
+#include <OPS_Stream.h>
+
+#include <fstream>
+using std::ofstream;
+using std::ifstream;
+
+// the compression state of a channel
+struct CompressedChannel {
+  double prev1, prev2;
+  int lead, trail;
+};
+
+class CompressedStream : public OPS_Stream
+{
+ public:
+  CompressedStream(const char *fileName);
+  ~CompressedStream();
+
+  // the metadata is not stored
+  int tag(const char *) {return 0;};
+  int tag(const char *, const char *) {return 0;};
+  int endTag() {return 0;};
+  int attr(const char *name, int value) {return 0;};
+  int attr(const char *name, double value) {return 0;};
+  int attr(const char *name, const char *value) {return 0;};
+
+  int write(Vector &data);
+
+  int sendSelf(int commitTag, Channel &theChannel);
+  int recvSelf(int commitTag, Channel &theChannel, 
+	       FEM_ObjectBroker &theBroker);
+
+ private:
+  void putBits(unsigned long long value, int numBits);
+  int writeRecord(void);
+
+  ofstream theFile;
+  char *fileName;
+
+  int numColumns;
+  CompressedChannel *channels;
+
+  unsigned char *buffer;
+  int bufferSize;
+  int numBytes;
+  unsigned int currentByte;
+  int currentBits;
+  int rowsInRecord;
+};
+
+class CompressedStreamReader
+{
+ public:
+  CompressedStreamReader();
+  ~CompressedStreamReader();
+
+  int open(const char *fileName);
+  int getNumColumns(void) {return numColumns;};
+
+  // fills data with the next row, returns -1 at the end of the file
+  int readRow(double *data);
+
+ private:
+  unsigned long long getBits(int numBits);
+  int readRecord(void);
+
+  ifstream theFile;
+  int numColumns;
+  CompressedChannel *channels;
+
+  unsigned char *buffer;
+  int bufferSize;
+  int numBytes;
+  int position;
+  unsigned int currentByte;
+  int currentBits;
+  int rowsInRecord;
+};
+
+// writes a compressed file as text, a row per line
+int expandCompressedFile(const char *inputFilename, const char *outputFilename);
+
+#endif
@@ -27,11 +27,15 @@
 #include <Vector.h>
 #include <iostream>
 #include <iomanip>
+#include <sstream>
 #include <string>
+#include <vector>
+#include <algorithm>
 #include <ID.h>
 #include <Channel.h>
 #include <Message.h>
 #include <Matrix.h>
+#include <chrono>
 
 using std::cerr;
 using std::ios;
@@ -43,7 +47,8 @@ using std::getline;
 DataFileStream::DataFileStream(int indent)
   :OPS_Stream(OPS_STREAM_TAGS_DataFileStream), 
    fileOpen(0), fileName(0), indentSize(indent), sendSelfCount(0), theChannels(0), numDataRows(0),
-   mapping(0), maxCount(0), sizeColumns(0), theColumns(0), theData(0), theRemoteData(0), doCSV(0)
+   mapping(0), maxCount(0), sizeColumns(0), theColumns(0), theData(0), theRemoteData(0), doCSV(0),
+   closeOnWrite(false), thePrecision(6), doScientific(false), processFiles(false), numBytes(0), flushTime(0.0)
 {
   if (indentSize < 1) indentSize = 1;
   indentString = new char[indentSize+5];
@@ -58,7 +63,7 @@ DataFileStream::DataFileStream(const char *file, openMode mode, int indent, int
    theChannels(0), numDataRows(0),
    mapping(0), maxCount(0), sizeColumns(0), 
    theColumns(0), theData(0), theRemoteData(0), 
-   doCSV(csv), closeOnWrite(closeWrite)
+   doCSV(csv), closeOnWrite(closeWrite), processFiles(false), numBytes(0), flushTime(0.0)
 {
   thePrecision = prec;
   doScientific = scientific;
@@ -149,6 +154,13 @@ DataFileStream::setFile(const char *name, openMode mode)
   return 0;
 }
 
+int
+DataFileStream::setProcessFiles(bool onOff)
+{
+  processFiles = onOff;
+  return 0;
+}
+
 int 
 DataFileStream::open(void)
 {
@@ -189,13 +201,30 @@ DataFileStream::open(void)
 int 
 DataFileStream::close(void)
 {
-  if (fileOpen != 0)
+  if (fileOpen != 0) {
+    numBytes = this->getNumBytes();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
     theFile.close();
+    flushTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
   fileOpen = 0;
 
   return 0;
 }
 
+long long
+DataFileStream::getNumBytes(void)
+{
+  // the file is written sequentially so its position is its size
+  if (fileOpen != 0) {
+    long long pos = (long long)theFile.tellp();
+    if (pos > numBytes)
+      return pos;
+  }
+
+  return numBytes;
+}
+
 
 int 
 DataFileStream::setPrecision(int prec)
@@ -283,7 +312,19 @@ DataFileStream::write(Vector &data)
   }
 
   //
-  // otherwise parallel, send the data if not p0
+  // otherwise parallel, with process files each process writes its own
+  //
+
+  if (processFiles == true) {
+    if (data.Size() != 0)
+      (*this) << data;
+    if (closeOnWrite == true)
+      this->close();
+    return 0;
+  }
+
+  //
+  // otherwise send the data if not p0
   //
 
   if (sendSelfCount < 0) {
@@ -472,7 +513,9 @@ DataFileStream::operator<<(const char *s)
   // a crash will cause a flush() - similar to what 
   if (fileOpen != 0) {
     theFile << s;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
     theFile.flush();
+    flushTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
   }
 
   return *this;
@@ -630,7 +673,7 @@ DataFileStream::sendSelf(int commitTag, Channel &theChannel)
     delete [] theChannels;
   theChannels = theNextChannels;
 
-  static ID idData(3);
+  static ID idData(7);
   int fileNameLength = 0;
   if (fileName != 0)
     fileNameLength = strlen(fileName);
@@ -643,6 +686,10 @@ DataFileStream::sendSelf(int commitTag, Channel &theChannel)
     idData(1) = 1;
 
   idData(2) = sendSelfCount;
+  idData(3) = processFiles;
+  idData(4) = thePrecision;
+  idData(5) = doScientific;
+  idData(6) = doCSV;
 
   if (theChannel.sendID(0, commitTag, idData) < 0) {
     opserr << "DataFileStream::sendSelf() - failed to send id data\n";
@@ -663,7 +710,7 @@ DataFileStream::sendSelf(int commitTag, Channel &theChannel)
 int 
 DataFileStream::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
-  static ID idData(3);
+  static ID idData(7);
 
   sendSelfCount = -1;
   theChannels = new Channel *[1];
@@ -680,6 +727,11 @@ DataFileStream::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &t
   else
     theOpenMode = APPEND;
 
+  processFiles = (idData(3) == 1);
+  thePrecision = idData(4);
+  doScientific = (idData(5) == 1);
+  doCSV = idData(6);
+
   if (fileNameLength != 0) {
     if (fileName != 0)
       delete [] fileName;
@@ -795,6 +847,16 @@ DataFileStream::setOrder(const ID &orderData)
       }
     }
 
+    // with process files only the index is needed, p0 writing to fileName.0
+    if (processFiles == true) {
+      int result = writeProcessFileIndex(fileName, (doCSV == 0) ? "text" : "csv",
+					 sendSelfCount+1, theColumns);
+      string p0Name(fileName);
+      p0Name += ".0";
+      this->setFile(p0Name.c_str(), OVERWRITE);
+      return result;
+    }
+
     ID currentLoc(sendSelfCount+1);
     ID currentCount(sendSelfCount+1);
 	
@@ -846,3 +908,178 @@ DataFileStream::setOrder(const ID &orderData)
 
   return 0;
 }
+
+
+int
+writeProcessFileIndex(const char *fileName, const char *format,
+		      int numProcesses, ID **theColumns)
+{
+  string indexName(fileName);
+  indexName += ".index";
+  ofstream index(indexName.c_str(), ios::out);
+  if (index.bad() || !index.is_open()) {
+    opserr << "WARNING writeProcessFileIndex() - could not open file " << indexName.c_str() << endln;
+    return -1;
+  }
+
+  // format, number of files, then for each file its name & column order
+  index << format << "\n" << numProcesses << "\n";
+  for (int i=0; i<numProcesses; i++) {
+    int numColumns = 0;
+    if (theColumns[i] != 0)
+      numColumns = theColumns[i]->Size();
+    index << fileName << "." << i << " " << numColumns;
+    for (int j=0; j<numColumns; j++)
+      index << " " << (*theColumns[i])(j);
+    index << "\n";
+  }
+  index.close();
+
+  return 0;
+}
+
+
+int
+mergeProcessFiles(const char *indexName, const char *outputName)
+{
+  ifstream index(indexName, ios::in);
+  if (index.bad() || !index.is_open()) {
+    opserr << "WARNING mergeProcessFiles() - could not open file " << indexName << endln;
+    return -1;
+  }
+
+  string format;
+  int numFiles = 0;
+  index >> format >> numFiles;
+  bool binary = (format == "binary");
+  bool csv = (format == "csv");
+
+  // the files holding columns and where each column goes
+  std::vector<string> names;
+  std::vector<int> numColumns;
+  std::vector<std::vector<int> > orders;
+  for (int i=0; i<numFiles; i++) {
+    string name;
+    int num = 0;
+    if (!(index >> name >> num)) {
+      opserr << "WARNING mergeProcessFiles() - index " << indexName << " is truncated\n";
+      return -1;
+    }
+    std::vector<int> order(num);
+    for (int j=0; j<num; j++)
+      index >> order[j];
+    if (num == 0)
+      continue;
+    names.push_back(name);
+    numColumns.push_back(num);
+    orders.push_back(order);
+  }
+  index.close();
+
+  // the output order is that of the columns; as in setOrder() the columns
+  // of an order given by more than one process, e.g. the time or a node
+  // shared by partitions, are taken from the last of those processes only
+  int numMerged = 0;
+  std::vector<std::pair<std::pair<int,int>, int> > sorted;
+  for (int i=0; i<(int)names.size(); i++) {
+    for (int j=0; j<numColumns[i]; j++) {
+      sorted.push_back(std::make_pair(std::make_pair(orders[i][j], i), numMerged+j));
+    }
+    numMerged += numColumns[i];
+  }
+  std::stable_sort(sorted.begin(), sorted.end());
+
+  std::vector<std::pair<std::pair<int,int>, int> > columns;
+  size_t first = 0;
+  while (first < sorted.size()) {
+    size_t last = first;
+    while (last+1 < sorted.size() && sorted[last+1].first.first == sorted[first].first.first)
+      last++;
+    int process = sorted[last].first.second;
+    for (size_t k=first; k<=last; k++)
+      if (sorted[k].first.second == process)
+	columns.push_back(sorted[k]);
+    first = last+1;
+  }
+  int numOutput = (int)columns.size();
+
+  std::vector<ifstream *> inputs(names.size());
+  for (int i=0; i<(int)names.size(); i++) {
+    if (binary == true)
+      inputs[i] = new ifstream(names[i].c_str(), ios::in | ios::binary);
+    else
+      inputs[i] = new ifstream(names[i].c_str(), ios::in);
+    if (inputs[i]->bad() || !inputs[i]->is_open()) {
+      opserr << "WARNING mergeProcessFiles() - could not open file " << names[i].c_str() << endln;
+      for (int j=0; j<=i; j++)
+	delete inputs[j];
+      return -1;
+    }
+  }
+
+  ofstream output;
+  if (binary == true)
+    output.open(outputName, ios::out | ios::binary);
+  else
+    output.open(outputName, ios::out);
+  if (output.bad() || !output.is_open()) {
+    opserr << "WARNING mergeProcessFiles() - could not open file " << outputName << endln;
+    for (int i=0; i<(int)inputs.size(); i++)
+      delete inputs[i];
+    return -1;
+  }
+
+  // a row from each file, until one of them ends; text values are
+  // copied as written
+  std::vector<double> values(numMerged);
+  std::vector<string> tokens(numMerged);
+  bool done = (numMerged == 0);
+  while (done == false) {
+    int loc = 0;
+    for (int i=0; i<(int)inputs.size() && done == false; i++) {
+      if (binary == true) {
+	char eol;
+	inputs[i]->read((char *)&values[loc], 8*numColumns[i]);
+	inputs[i]->get(eol);
+	if (!(*inputs[i]))
+	  done = true;
+      } else {
+	string line;
+	if (!getline(*inputs[i], line))
+	  done = true;
+	else {
+	  for (size_t k=0; k<line.size(); k++)
+	    if (line[k] == ',')
+	      line[k] = ' ';
+	  std::istringstream theLine(line);
+	  for (int j=0; j<numColumns[i]; j++)
+	    if (!(theLine >> tokens[loc+j]))
+	      done = true;
+	}
+      }
+      loc += numColumns[i];
+    }
+    if (done == true)
+      break;
+
+    if (binary == true) {
+      for (int k=0; k<numOutput; k++)
+	output.write((char *)&values[columns[k].second], 8);
+      output << '\n';
+    } else {
+      for (int k=0; k<numOutput; k++) {
+	output << tokens[columns[k].second];
+	if (k == numOutput-1)
+	  output << "\n";
+	else
+	  output << ((csv == true) ? "," : " ");
+      }
+    }
+  }
+
+  for (int i=0; i<(int)inputs.size(); i++)
+    delete inputs[i];
+  output.close();
+
+  return 0;
+}
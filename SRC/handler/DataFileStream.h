@@ -32,6 +32,14 @@ using std::ofstream;
 
 class Matrix;
 
+// in a parallel run with process files each process writes the rows of its
+// own columns to fileName.<process>, and process 0 lists the files and the
+// order of their columns in fileName.index; mergeProcessFiles() then writes
+// the rows with the columns in the order of a single file
+int writeProcessFileIndex(const char *fileName, const char *format,
+			  int numProcesses, ID **theColumns);
+int mergeProcessFiles(const char *indexName, const char *outputName);
+
 class DataFileStream : public OPS_Stream
 {
  public:
@@ -48,6 +56,9 @@ class DataFileStream : public OPS_Stream
   int precision(int precision) {return 0;};
   int width(int width) {return 0;};
   const char *getFileName(void) {return fileName;}
+  int setProcessFiles(bool onOff);
+  long long getNumBytes(void);
+  double getFlushTime(void) {return flushTime;};
 
   // xml stuff
   int tag(const char *);
@@ -115,6 +126,11 @@ class DataFileStream : public OPS_Stream
 
   int thePrecision;
   bool doScientific;
+
+  bool processFiles;
+
+  long long numBytes;    // bytes in the file when last closed
+  double flushTime;
 };
 
 #endif
@@ -44,6 +44,10 @@ class OPS_Stream:  public MovableObject
   virtual int precision(int precision) {return 0;}
   virtual int width(int width) {return 0;}
 
+  // bytes written and seconds spent flushing, for recorder cost accounting
+  virtual long long getNumBytes(void) {return 0;}
+  virtual double getFlushTime(void) {return 0.0;}
+
   // xml stuff
   virtual int tag(const char *) =0;
   virtual int tag(const char *, const char *) =0;
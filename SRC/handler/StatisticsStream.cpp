@@ -0,0 +1,589 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of StatisticsStream.
+
+#include <StatisticsStream.h>
+#include <Vector.h>
+#include <OPS_Globals.h>
+#include <elementAPI.h>
+#include <string.h>
+#include <math.h>
+
+static const int NUM_STATISTICS = 13;
+static const int RAINFLOW_STACK = 256;
+
+
+//
+// P-square estimate of a percentile (Jain & Chlamtac), 5 markers
+//
+
+class Percentile
+{
+ public:
+  void init(double p);
+  void add(double x, int count);
+  double get(int count);
+
+ private:
+  double p;
+  double q[5];
+  double n[5];
+  double np[5];
+  double dn[5];
+};
+
+void
+Percentile::init(double prob)
+{
+  p = prob;
+  for (int i=0; i<5; i++) {
+    q[i] = 0.0;
+    n[i] = i+1;
+  }
+  np[0] = 1.0; np[1] = 1.0+2.0*p; np[2] = 1.0+4.0*p; np[3] = 3.0+2.0*p; np[4] = 5.0;
+  dn[0] = 0.0; dn[1] = 0.5*p; dn[2] = p; dn[3] = 0.5*(1.0+p); dn[4] = 1.0;
+}
+
+// count is the number of values before x
+void
+Percentile::add(double x, int count)
+{
+  // the first 5 values are kept sorted
+  if (count < 5) {
+    int i = count;
+    while (i > 0 && q[i-1] > x) {
+      q[i] = q[i-1];
+      i--;
+    }
+    q[i] = x;
+    return;
+  }
+
+  int k;
+  if (x < q[0]) {
+    q[0] = x;
+    k = 0;
+  } else if (x >= q[4]) {
+    q[4] = x;
+    k = 3;
+  } else {
+    k = 0;
+    while (k < 3 && x >= q[k+1])
+      k++;
+  }
+
+  for (int i=k+1; i<5; i++)
+    n[i] += 1.0;
+  for (int i=0; i<5; i++)
+    np[i] += dn[i];
+
+  // adjust the middle markers
+  for (int i=1; i<4; i++) {
+    double d = np[i] - n[i];
+    if ((d >= 1.0 && n[i+1]-n[i] > 1.0) || (d <= -1.0 && n[i-1]-n[i] < -1.0)) {
+      int ds = (d > 0.0) ? 1 : -1;
+      double qp = q[i] + ds/(n[i+1]-n[i-1]) *
+	((n[i]-n[i-1]+ds)*(q[i+1]-q[i])/(n[i+1]-n[i]) +
+	 (n[i+1]-n[i]-ds)*(q[i]-q[i-1])/(n[i]-n[i-1]));
+      if (q[i-1] < qp && qp < q[i+1])
+	q[i] = qp;
+      else
+	q[i] = q[i] + ds*(q[i+ds]-q[i])/(n[i+ds]-n[i]);
+      n[i] += ds;
+    }
+  }
+}
+
+double
+Percentile::get(int count)
+{
+  if (count == 0)
+    return 0.0;
+  if (count < 5) {
+    int i = (int)floor(p*(count-1) + 0.5);
+    return q[i];
+  }
+  return q[2];
+}
+
+
+//
+// the running statistics of a channel
+//
+
+class StatisticsChannel
+{
+ public:
+  StatisticsChannel();
+  ~StatisticsChannel();
+
+  void init(const StatisticsOptions &options);
+  void add(double x, double dt, const StatisticsOptions &options);
+  void rainflow(double reversal, double exponent);
+  void finish(const StatisticsOptions &options);
+
+  int count;
+  double min, max, mean, m2, sumSquares;
+  double timeAbove;
+  double energy, lastValue;
+
+  Percentile percentiles[3];
+
+  // rainflow: residue of reversals, current extreme and its direction
+  double *residue;
+  int numResidue;
+  double peak;
+  int direction;
+  double cycles, damage;
+
+  double *bins;
+};
+
+StatisticsChannel::StatisticsChannel()
+  :count(0), min(0.0), max(0.0), mean(0.0), m2(0.0), sumSquares(0.0),
+   timeAbove(0.0), energy(0.0), lastValue(0.0),
+   residue(0), numResidue(0), peak(0.0), direction(0), cycles(0.0), damage(0.0),
+   bins(0)
+{
+
+}
+
+StatisticsChannel::~StatisticsChannel()
+{
+  if (residue != 0)
+    delete [] residue;
+  if (bins != 0)
+    delete [] bins;
+}
+
+void
+StatisticsChannel::init(const StatisticsOptions &options)
+{
+  percentiles[0].init(0.5);
+  percentiles[1].init(0.9);
+  percentiles[2].init(0.99);
+
+  residue = new double[RAINFLOW_STACK];
+
+  if (options.numBins > 0) {
+    bins = new double[options.numBins];
+    for (int i=0; i<options.numBins; i++)
+      bins[i] = 0.0;
+  }
+}
+
+// ASTM E1049 three point counting of the new reversal
+void
+StatisticsChannel::rainflow(double reversal, double exponent)
+{
+  if (numResidue == RAINFLOW_STACK) {
+    double range = fabs(residue[1] - residue[0]);
+    cycles += 0.5;
+    damage += 0.5*pow(range, exponent);
+    for (int i=1; i<numResidue; i++)
+      residue[i-1] = residue[i];
+    numResidue--;
+  }
+
+  residue[numResidue++] = reversal;
+
+  while (numResidue >= 3) {
+    double X = fabs(residue[numResidue-1] - residue[numResidue-2]);
+    double Y = fabs(residue[numResidue-2] - residue[numResidue-3]);
+    if (X < Y)
+      break;
+
+    if (numResidue == 3) {
+      // Y includes the starting point, count a half cycle
+      cycles += 0.5;
+      damage += 0.5*pow(Y, exponent);
+      residue[0] = residue[1];
+      residue[1] = residue[2];
+      numResidue = 2;
+    } else {
+      cycles += 1.0;
+      damage += pow(Y, exponent);
+      residue[numResidue-3] = residue[numResidue-1];
+      numResidue -= 2;
+    }
+  }
+}
+
+void
+StatisticsChannel::add(double x, double dt, const StatisticsOptions &options)
+{
+  if (count == 0) {
+    min = x;
+    max = x;
+    peak = x;
+    residue[numResidue++] = x;
+  } else {
+    if (x < min)
+      min = x;
+    if (x > max)
+      max = x;
+
+    // a change of direction makes the last extreme a reversal
+    if (direction == 0) {
+      if (x != peak)
+	direction = (x > peak) ? 1 : -1;
+      peak = x;
+    } else if ((x - peak)*direction >= 0.0)
+      peak = x;
+    else {
+      this->rainflow(peak, options.exponent);
+      direction = -direction;
+      peak = x;
+    }
+  }
+
+  for (int i=0; i<3; i++)
+    percentiles[i].add(x, count);
+
+  count++;
+  double delta = x - mean;
+  mean += delta/count;
+  m2 += delta*(x - mean);
+  sumSquares += x*x;
+
+  if (options.threshold >= 0.0 && fabs(x) >= options.threshold)
+    timeAbove += dt;
+
+  if (options.numBins > 0) {
+    int bin = 0;
+    if (options.binMax > options.binMin)
+      bin = (int)floor((x - options.binMin)/(options.binMax - options.binMin)*options.numBins);
+    if (bin < 0)
+      bin = 0;
+    if (bin >= options.numBins)
+      bin = options.numBins-1;
+    bins[bin] += 1.0;
+  }
+}
+
+void
+StatisticsChannel::finish(const StatisticsOptions &options)
+{
+  if (count == 0)
+    return;
+
+  // the last extreme, then what is left are half cycles
+  if (direction != 0)
+    this->rainflow(peak, options.exponent);
+  for (int i=1; i<numResidue; i++) {
+    double range = fabs(residue[i] - residue[i-1]);
+    cycles += 0.5;
+    damage += 0.5*pow(range, options.exponent);
+  }
+  numResidue = 0;
+}
+
+
+StatisticsOptions::StatisticsOptions()
+  :on(false), threshold(-1.0), numBins(0), binMin(0.0), binMax(0.0),
+   energy(false), exponent(3.0)
+{
+
+}
+
+int
+StatisticsOptions::parse(const char *option)
+{
+  int num = 1;
+
+#ifdef _PARALLEL_PROCESSING
+  // the statistics of each process can not be sent to process 0
+  if (strncmp(option, "-stats", 6) == 0) {
+    opserr << "WARNING: " << option << " - recorder statistics are not available in a parallel run\n";
+    return -1;
+  }
+#endif
+
+  if (strcmp(option, "-stats") == 0) {
+    on = true;
+    return 1;
+  }
+
+  if (strcmp(option, "-statsThreshold") == 0) {
+    on = true;
+    if (OPS_GetNumRemainingInputArgs() < 1 ||
+	OPS_GetDoubleInput(&num, &threshold) < 0) {
+      opserr << "WARNING: failed to read -statsThreshold value\n";
+      return -1;
+    }
+    return 1;
+  }
+
+  if (strcmp(option, "-statsHistogram") == 0) {
+    on = true;
+    if (OPS_GetNumRemainingInputArgs() < 3 ||
+	OPS_GetIntInput(&num, &numBins) < 0 ||
+	OPS_GetDoubleInput(&num, &binMin) < 0 ||
+	OPS_GetDoubleInput(&num, &binMax) < 0) {
+      opserr << "WARNING: failed to read -statsHistogram numBins min max\n";
+      return -1;
+    }
+    return 1;
+  }
+
+  if (strcmp(option, "-statsEnergy") == 0) {
+    on = true;
+    energy = true;
+    return 1;
+  }
+
+  if (strcmp(option, "-statsExponent") == 0) {
+    on = true;
+    if (OPS_GetNumRemainingInputArgs() < 1 ||
+	OPS_GetDoubleInput(&num, &exponent) < 0) {
+      opserr << "WARNING: failed to read -statsExponent m\n";
+      return -1;
+    }
+    return 1;
+  }
+
+  return 0;
+}
+
+
+StatisticsStream::StatisticsStream(OPS_Stream *stream, const StatisticsOptions &theOptions)
+  :OPS_Stream(OPS_STREAM_TAGS_StatisticsStream),
+   theStream(stream), options(theOptions),
+   numResponses(0), timeColumn(false), timeDepth(-1), depth(0), dataDepth(-1),
+   numColumns(-1), channels(0), lastTime(0.0), numSteps(0), written(false)
+{
+  if (options.numBins < 0)
+    options.numBins = 0;
+}
+
+StatisticsStream::~StatisticsStream()
+{
+  this->writeStatistics();
+
+  if (channels != 0)
+    delete [] channels;
+
+  if (theStream != 0)
+    delete theStream;
+}
+
+int
+StatisticsStream::writeStatistics(void)
+{
+  if (written == true || numColumns <= 0)
+    return 0;
+  written = true;
+
+  int first = (timeColumn == true) ? 1 : 0;
+  for (int j=first; j<numColumns; j++)
+    channels[j].finish(options);
+
+  int numRows = NUM_STATISTICS + options.numBins;
+  Vector row(numColumns);
+  for (int i=0; i<numRows; i++) {
+    if (timeColumn == true)
+      row(0) = i+1;
+
+    for (int j=first; j<numColumns; j++) {
+      StatisticsChannel &channel = channels[j];
+      int count = channel.count;
+      double value = 0.0;
+      switch (i) {
+      case 0: value = channel.min; break;
+      case 1: value = channel.max; break;
+      case 2: value = (-channel.min > channel.max) ? -channel.min : channel.max; break;
+      case 3: value = channel.mean; break;
+      case 4: value = (count > 0) ? sqrt(channel.sumSquares/count) : 0.0; break;
+      case 5: value = (count > 1) ? sqrt(channel.m2/(count-1)) : 0.0; break;
+      case 6: value = channel.timeAbove; break;
+      case 7: value = channel.percentiles[0].get(count); break;
+      case 8: value = channel.percentiles[1].get(count); break;
+      case 9: value = channel.percentiles[2].get(count); break;
+      case 10: value = channel.cycles; break;
+      case 11: value = channel.damage; break;
+      case 12: value = channel.energy; break;
+      default: value = channel.bins[i-NUM_STATISTICS]; break;
+      }
+      row(j) = value;
+    }
+
+    theStream->write(row);
+  }
+
+  return 0;
+}
+
+int 
+StatisticsStream::write(Vector &data)
+{
+  int size = data.Size();
+
+  if (numColumns < 0) {
+    numColumns = size;
+    if (numColumns > 0) {
+      channels = new StatisticsChannel[numColumns];
+      for (int j=0; j<numColumns; j++)
+	channels[j].init(options);
+    }
+    if (numColumns < 1)
+      timeColumn = false;
+  }
+
+  if (size != numColumns) {
+    opserr << "WARNING StatisticsStream::write() - expects rows of " << numColumns;
+    opserr << " values, got " << size << endln;
+    if (size > numColumns)
+      size = numColumns;
+  }
+
+  int first = 0;
+  double dt = 1.0;
+  if (timeColumn == true) {
+    double time = data(0);
+    dt = (numSteps > 0) ? time - lastTime : 0.0;
+    lastTime = time;
+    first = 1;
+  }
+
+  for (int j=first; j<size; j++)
+    channels[j].add(data(j), dt, options);
+
+  // energy of the (force, deformation) pairs
+  if (options.energy == true && numSteps > 0) {
+    for (int j=first; j+1<size; j+=2) {
+      double f = data(j);
+      double d = data(j+1);
+      double dE = 0.5*(f + channels[j].lastValue)*(d - channels[j+1].lastValue);
+      channels[j].energy += dE;
+      channels[j+1].energy += dE;
+    }
+  }
+  for (int j=first; j<size; j++)
+    channels[j].lastValue = data(j);
+
+  numSteps++;
+
+  return 0;
+}
+
+int
+StatisticsStream::setFile(const char *fileName, openMode mode, bool echo)
+{
+  return theStream->setFile(fileName, mode, echo);
+}
+
+int
+StatisticsStream::setPrecision(int prec)
+{
+  return theStream->setPrecision(prec);
+}
+
+int
+StatisticsStream::setFloatField(floatField field)
+{
+  return theStream->setFloatField(field);
+}
+
+int
+StatisticsStream::precision(int prec)
+{
+  return theStream->precision(prec);
+}
+
+int
+StatisticsStream::width(int w)
+{
+  return theStream->width(w);
+}
+
+int 
+StatisticsStream::tag(const char *tagName)
+{
+  if (strcmp(tagName, "TimeOutput") == 0)
+    timeDepth = depth;
+  else if (strcmp(tagName, "Data") == 0)
+    dataDepth = depth;
+  depth++;
+
+  return theStream->tag(tagName);
+}
+
+int 
+StatisticsStream::tag(const char *tagName, const char *value)
+{
+  if (strcmp(tagName, "ResponseType") == 0) {
+    if (numResponses == 0 && timeDepth != -1)
+      timeColumn = true;
+    numResponses++;
+  }
+
+  return theStream->tag(tagName, value);
+}
+
+int 
+StatisticsStream::endTag()
+{
+  if (depth > 0)
+    depth--;
+
+  if (depth == timeDepth)
+    timeDepth = -1;
+
+  // the statistics go in the data
+  if (depth == dataDepth) {
+    this->writeStatistics();
+    dataDepth = -1;
+  }
+
+  return theStream->endTag();
+}
+
+int 
+StatisticsStream::attr(const char *name, int value)
+{
+  return theStream->attr(name, value);
+}
+
+int 
+StatisticsStream::attr(const char *name, double value)
+{
+  return theStream->attr(name, value);
+}
+
+int 
+StatisticsStream::attr(const char *name, const char *value)
+{
+  return theStream->attr(name, value);
+}
+
+int 
+StatisticsStream::sendSelf(int commitTag, Channel &theChannel)
+{
+  opserr << "StatisticsStream::sendSelf() - not yet implemented\n";
+  return -1;
+}
+
+int 
+StatisticsStream::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  opserr << "StatisticsStream::recvSelf() - not yet implemented\n";
+  return -1;
+}
@@ -0,0 +1,115 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef _StatisticsStream
+#define _StatisticsStream
+
+// Description: StatisticsStream wraps another OPS_Stream. It passes on the
+// description of the output but, instead of the rows written each step,
+// keeps a fixed size set of running statistics for each column (channel)
+// and writes only these to the wrapped stream when the recorder is done,
+// one row per statistic:
+//
+//   1 min, 2 max, 3 absmax, 4 mean, 5 rms, 6 standard deviation,
+//   7 time with |value| >= threshold (0 if no threshold is given),
+//   8 median, 9 90th and 10 99th percentile (P-square estimates),
+//   11 number of rainflow cycles (half cycles count 1/2),
+//   12 rainflow damage sum of cycles * range^m,
+//   13 energy: the integral of f dd with columns taken in pairs (f,d)
+//      (0 unless requested),
+//   then numBins rows of histogram counts over [binMin,binMax], the first
+//   and last bin also counting the values below and above.
+//
+// If the recorder writes the time as its first column, that column holds
+// the number of the statistic and the times are used for the time above
+// the threshold; otherwise each step counts as 1. Rainflow counting keeps a
+// bounded residue; should it fill, its oldest range is counted as a half
+// cycle. Deleting the StatisticsStream deletes the wrapped stream.
+
+#include <OPS_Stream.h>
+
+class StatisticsOptions
+{
+ public:
+  StatisticsOptions();
+
+  // sets the options of a recorder -stats flag, its values read with
+  // OPS_GetIntInput & OPS_GetDoubleInput; returns 1 if option is one of
+  // the -stats flags, 0 if it is not and -1 if its values are missing
+  int parse(const char *option);
+
+  bool on;             // true if the statistics are recorded
+  double threshold;    // < 0 if none
+  int numBins;
+  double binMin, binMax;
+  bool energy;
+  double exponent;     // m of the rainflow damage sum
+};
+
+class StatisticsChannel;
+
+class StatisticsStream : public OPS_Stream
+{
+ public:
+  StatisticsStream(OPS_Stream *theStream, const StatisticsOptions &theOptions);
+  ~StatisticsStream();
+
+  int setFile(const char *fileName, openMode mode = OVERWRITE, bool echo = false);
+  int setPrecision(int precision);
+  int setFloatField(floatField);
+  int precision(int precision);
+  int width(int width);
+  long long getNumBytes(void) {return theStream->getNumBytes();};
+  double getFlushTime(void) {return theStream->getFlushTime();};
+
+  // xml stuff
+  int tag(const char *);
+  int tag(const char *, const char *);
+  int endTag();
+  int attr(const char *name, int value);
+  int attr(const char *name, double value);
+  int attr(const char *name, const char *value);
+  int write(Vector &data);
+
+  int sendSelf(int commitTag, Channel &theChannel);
+  int recvSelf(int commitTag, Channel &theChannel, 
+	       FEM_ObjectBroker &theBroker);
+
+ private:
+  int writeStatistics(void);
+
+  OPS_Stream *theStream;
+  StatisticsOptions options;
+
+  // column 0 is time if the first ResponseType is in a TimeOutput
+  int numResponses;
+  bool timeColumn;
+  int timeDepth;
+  int depth;
+  int dataDepth;
+
+  int numColumns;
+  StatisticsChannel *channels;
+  double lastTime;
+  int numSteps;
+  bool written;
+};
+
+#endif
@@ -94,6 +94,11 @@ UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 #include <RegulaFalsiLineSearch.h>
 #include <NewtonLineSearch.h>
 #include <FileDatastore.h>
+#include <LogDatastore.h>
+#include <MemoryDatastore.h>
+#include <ModelFile.h>
+#include <MemoryReport.h>
+#include <ConvergenceLog.h>
 
 
 // active object
@@ -965,9 +970,13 @@ OpenSeesCommands::wipe()
 
     // wipe domain
     if (theDomain != 0) {
+	theDomain->printRecorderCosts(opserr, 10);
 	theDomain->clearAll();
     }
 
+    // convergence log
+    ConvergenceLog::close();
+
     // time set to zero
     ops_Dt = 0.0;
 
@@ -1018,6 +1027,34 @@ OpenSeesCommands::setFileDatabase(const char* filename)
     }
 }
 
+void
+OpenSeesCommands::setLogDatabase(const char* filename, bool compress)
+{
+    if (theDatabase != 0) delete theDatabase;
+    theDatabase = new LogDatastore(filename, *theDomain, theBroker, compress);
+    if (theDatabase == 0) {
+	opserr << "WARNING ran out of memory - database Log " << filename << endln;
+    }
+}
+
+int
+OpenSeesCommands::createSnapshot(const char* name)
+{
+    return ::createSnapshot(name, *theDomain, theBroker);
+}
+
+int
+OpenSeesCommands::saveModel(const char* filename)
+{
+    return ::saveModel(filename, *theDomain, theBroker);
+}
+
+int
+OpenSeesCommands::loadModel(const char* filename)
+{
+    return ::loadModel(filename, *theDomain, theBroker);
+}
+
 /////////////////////////////
 //// OpenSees APIs  /// /////
 /////////////////////////////
@@ -2464,8 +2501,27 @@ int OPS_Database()
 
 	return 0;
     }
+
+    // an append-only Log Database for checkpoints
+    if (strcmp(type,"Log") == 0) {
+	if (OPS_GetNumRemainingInputArgs() < 1) {
+	    opserr << "WARNING database Log fileName? <-compress>";
+	    return -1;
+	}
+
+	const char* filename = OPS_GetString();
+	bool compress = false;
+	if (OPS_GetNumRemainingInputArgs() > 0) {
+	    const char* option = OPS_GetString();
+	    if (strcmp(option,"-compress") == 0)
+		compress = true;
+	}
+	cmds->setLogDatabase(filename, compress);
+
+	return 0;
+    }
     opserr << "WARNING No database type exists ";
-    opserr << "for database of type:" << type << "valid database type File\n";
+    opserr << "for database of type:" << type << "valid database type File, Log\n";
 
     return -1;
 }
@@ -2530,6 +2586,61 @@ int OPS_restore()
     return 0;
 }
 
+int OPS_snapshot()
+{
+    if (OPS_GetNumRemainingInputArgs() < 1) {
+	opserr << "WARNING snapshot create|restore|drop <name>\n";
+	return -1;
+    }
+
+    const char* action = OPS_GetString();
+    const char* name = 0;
+    if (OPS_GetNumRemainingInputArgs() > 0)
+	name = OPS_GetString();
+
+    if (strcmp(action,"drop") == 0)
+	return dropSnapshot(name);
+
+    if (name == 0) {
+	opserr << "WARNING snapshot " << action << " name?\n";
+	return -1;
+    }
+
+    if (strcmp(action,"create") == 0)
+	return cmds->createSnapshot(name);
+
+    if (strcmp(action,"restore") == 0) {
+	Domain* theDomain = cmds->getDomain();
+	if (theDomain == 0) return -1;
+	return restoreSnapshot(name, *theDomain);
+    }
+
+    opserr << "WARNING snapshot - unknown action " << action << ", valid create, restore, drop\n";
+    return -1;
+}
+
+int OPS_saveModel()
+{
+    if (OPS_GetNumRemainingInputArgs() < 1) {
+	opserr << "WARNING saveModel fileName\n";
+	return -1;
+    }
+
+    const char* filename = OPS_GetString();
+    return cmds->saveModel(filename);
+}
+
+int OPS_loadModel()
+{
+    if (OPS_GetNumRemainingInputArgs() < 1) {
+	opserr << "WARNING loadModel fileName\n";
+	return -1;
+    }
+
+    const char* filename = OPS_GetString();
+    return cmds->loadModel(filename);
+}
+
 int OPS_startTimer()
 {
     Timer* timer = cmds->getTimer();
@@ -3039,3 +3150,48 @@ int OPS_systemSize()
 
     return 0;
 }
+
+int OPS_memoryReport()
+{
+    Domain* theDomain = OPS_GetDomain();
+    if (theDomain == 0) return -1;
+
+    const char* fileName = 0;
+    int numClasses = 20;
+    int numdata = 1;
+    while (OPS_GetNumRemainingInputArgs() > 1) {
+	const char* option = OPS_GetString();
+	if (strcmp(option,"-json") == 0)
+	    fileName = OPS_GetString();
+	else if (strcmp(option,"-classes") == 0) {
+	    if (OPS_GetIntInput(&numdata, &numClasses) < 0) {
+		opserr << "WARNING memoryReport -classes numMax?\n";
+		return -1;
+	    }
+	} else {
+	    opserr << "WARNING memoryReport - unknown option " << option << endln;
+	    return -1;
+	}
+    }
+
+    MemoryReport theReport;
+    theDomain->reportMemory(theReport);
+    if (cmds->getAnalysisModel() != 0)
+	cmds->getAnalysisModel()->reportMemory(theReport);
+    if (cmds->getSOE() != 0)
+	cmds->getSOE()->reportMemory(theReport);
+
+    if (fileName != 0) {
+	if (theReport.writeJSON(fileName) < 0)
+	    return -1;
+    } else
+	theReport.report(opserr, numClasses);
+
+    double total = theReport.getTotal();
+    if (OPS_SetDoubleOutput(&numdata, &total) < 0) {
+	opserr << "WARNING memoryReport - failed to set output\n";
+	return -1;
+    }
+
+    return 0;
+}
@@ -83,6 +83,7 @@ public:
 
     void setSOE(LinearSOE* soe);
     LinearSOE* getSOE() {return theSOE;}
+    AnalysisModel* getAnalysisModel() {return theAnalysisModel;}
     
     void setNumberer(DOF_Numberer* numberer);
     DOF_Numberer* getNumberer() {return theNumberer;}
@@ -120,6 +121,10 @@ public:
     EigenSOE* getEigenSOE() {return theEigenSOE;}
     
     void setFileDatabase(const char* filename);
+    void setLogDatabase(const char* filename, bool compress);
+    int createSnapshot(const char* name);
+    int saveModel(const char* filename);
+    int loadModel(const char* filename);
     FE_Datastore* getDatabase() {return theDatabase;}
 
     Timer* getTimer() {return &theTimer;}
@@ -280,6 +285,12 @@ int OPS_record();
 int OPS_stripOpenSeesXML();
 int OPS_convertBinaryToText();
 int OPS_convertTextToBinary();
+int OPS_convertCompressedToText();
+int OPS_mergeProcessFiles();
+int OPS_recorderCost();
+int OPS_profile();
+int OPS_captureSOE();
+int OPS_convergenceLog();
 int OPS_InitialStateAnalysis();
 int OPS_RigidLink();
 int OPS_RigidDiaphragm();
@@ -308,6 +319,9 @@ int OPS_printModel();
 int OPS_Database();
 int OPS_save();
 int OPS_restore();
+int OPS_snapshot();
+int OPS_saveModel();
+int OPS_loadModel();
 int OPS_startTimer();
 int OPS_stopTimer();
 int OPS_modalDamping();
@@ -321,6 +335,7 @@ int OPS_accelCPU();
 int OPS_numFact();
 int OPS_numIter();
 int OPS_systemSize();
+int OPS_memoryReport();
 
 void* OPS_KrylovNewton();
 void* OPS_RaphsonNewton();
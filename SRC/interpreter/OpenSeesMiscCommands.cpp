@@ -1116,6 +1116,15 @@ int OPS_stripOpenSeesXML()
 
 extern int binaryToText(const char *inputFilename, const char *outputFilename);
 extern int textToBinary(const char *inputFilename, const char *outputFilename);
+#include <TimeSeriesFile.h>
+#include <PhaseProfiler.h>
+#include <ClassProfiler.h>
+#include <LinearSOECapture.h>
+#include <ConvergenceLog.h>
+#include <string>
+extern int drmTextToBinary(const char *inputFilename, const char *outputFilename, int numNodes);
+extern int expandCompressedFile(const char *inputFilename, const char *outputFilename);
+extern int mergeProcessFiles(const char *indexName, const char *outputName);
 
 int OPS_convertBinaryToText()
 {
@@ -1130,6 +1139,277 @@ int OPS_convertBinaryToText()
     return binaryToText(inputFile, outputFile);
 }
 
+int OPS_convertCompressedToText()
+{
+    if (OPS_GetNumRemainingInputArgs() < 2) {
+	opserr << "ERROR incorrect # args - convertCompressedToText inputFile outputFile\n";
+	return -1;
+    }
+
+    const char *inputFile = OPS_GetString();
+    const char *outputFile = OPS_GetString();
+
+    return expandCompressedFile(inputFile, outputFile);
+}
+
+int OPS_mergeProcessFiles()
+{
+    if (OPS_GetNumRemainingInputArgs() < 2) {
+	opserr << "ERROR incorrect # args - mergeProcessFiles indexFile outputFile\n";
+	return -1;
+    }
+
+    const char *indexFile = OPS_GetString();
+    const char *outputFile = OPS_GetString();
+
+    return mergeProcessFiles(indexFile, outputFile);
+}
+
+int OPS_recorderCost()
+{
+    Domain* theDomain = OPS_GetDomain();
+    if (theDomain == 0) return -1;
+
+    // with no options return tag, calls, skipped, time, bytes, flushTime of each recorder
+    if (OPS_GetNumRemainingInputArgs() < 1) {
+	Vector data;
+	theDomain->getRecorderCosts(data);
+	int size = data.Size();
+	if (OPS_SetDoubleOutput(&size, size > 0 ? &data(0) : 0) < 0) {
+	    opserr << "WARNING recorderCost - failed to set output\n";
+	    return -1;
+	}
+	return 0;
+    }
+
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char* option = OPS_GetString();
+	int numdata = 1;
+	if (strcmp(option,"-print") == 0) {
+	    int numMax = 0;
+	    if (OPS_GetNumRemainingInputArgs() > 0) {
+		if (OPS_GetIntInput(&numdata, &numMax) < 0) {
+		    numMax = 0;
+		    OPS_ResetCurrentInputArg(-1);
+		}
+	    }
+	    theDomain->printRecorderCosts(opserr, numMax);
+	} else if (strcmp(option,"-maxOverhead") == 0) {
+	    double maxOverhead;
+	    if (OPS_GetNumRemainingInputArgs() < 1 || OPS_GetDoubleInput(&numdata, &maxOverhead) < 0) {
+		opserr << "WARNING recorderCost -maxOverhead fraction?\n";
+		return -1;
+	    }
+	    theDomain->setRecorderMaxOverhead(maxOverhead);
+	} else if (strcmp(option,"-lowPriority") == 0) {
+	    int tag;
+	    while (OPS_GetNumRemainingInputArgs() > 0) {
+		if (OPS_GetIntInput(&numdata, &tag) < 0) {
+		    OPS_ResetCurrentInputArg(-1);
+		    break;
+		}
+		if (theDomain->setRecorderLowPriority(tag) < 0)
+		    return -1;
+	    }
+	} else if (strcmp(option,"-reset") == 0) {
+	    theDomain->resetRecorderCosts();
+	} else {
+	    opserr << "WARNING recorderCost - unknown option " << option << endln;
+	    return -1;
+	}
+    }
+
+    return 0;
+}
+
+int OPS_captureSOE()
+{
+    if (OPS_GetNumRemainingInputArgs() < 1) {
+	opserr << "WARNING captureSOE fileName <-step step?> <-iteration iter?> <-binary> | captureSOE -off\n";
+	return -1;
+    }
+
+    const char* fileName = OPS_GetString();
+    if (strcmp(fileName,"-off") == 0) {
+	LinearSOECapture::cancel();
+	return 0;
+    }
+
+    // copy the name, the next OPS_GetString may overwrite it
+    std::string name(fileName);
+    int step = 0;
+    int iteration = 1;
+    bool binary = false;
+    int numdata = 1;
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char* option = OPS_GetString();
+	if (strcmp(option,"-binary") == 0)
+	    binary = true;
+	else if (strcmp(option,"-step") == 0) {
+	    if (OPS_GetNumRemainingInputArgs() < 1 || OPS_GetIntInput(&numdata, &step) < 0) {
+		opserr << "WARNING captureSOE -step step?\n";
+		return -1;
+	    }
+	} else if (strcmp(option,"-iteration") == 0) {
+	    if (OPS_GetNumRemainingInputArgs() < 1 || OPS_GetIntInput(&numdata, &iteration) < 0) {
+		opserr << "WARNING captureSOE -iteration iter?\n";
+		return -1;
+	    }
+	} else {
+	    opserr << "WARNING captureSOE - unknown option " << option << endln;
+	    return -1;
+	}
+    }
+
+    LinearSOECapture::request(step, iteration, name.c_str(), binary);
+
+    return 0;
+}
+
+int OPS_convergenceLog()
+{
+    if (OPS_GetNumRemainingInputArgs() < 1) {
+	opserr << "WARNING convergenceLog fileName <-binary> | convergenceLog -close | -last | -norms | -algorithm\n";
+	return -1;
+    }
+
+    const char* fileName = OPS_GetString();
+
+    // the last step: step, time, dt, result, iterations, solves,
+    // factorizations, wall, firstNorm, lastNorm, algorithm class tag
+    if (strcmp(fileName,"-last") == 0 || strcmp(fileName,"-norms") == 0) {
+	Vector data = (strcmp(fileName,"-last") == 0) ?
+	    ConvergenceLog::getLastStep() : ConvergenceLog::getLastNorms();
+	int size = data.Size();
+	if (OPS_SetDoubleOutput(&size, size > 0 ? &data(0) : 0) < 0) {
+	    opserr << "WARNING convergenceLog - failed to set output\n";
+	    return -1;
+	}
+	return 0;
+    }
+
+    if (strcmp(fileName,"-algorithm") == 0) {
+	if (OPS_SetString(ConvergenceLog::getLastAlgorithm()) < 0) {
+	    opserr << "WARNING convergenceLog - failed to set output\n";
+	    return -1;
+	}
+	return 0;
+    }
+
+    if (strcmp(fileName,"-close") == 0) {
+	ConvergenceLog::close();
+	return 0;
+    }
+
+    // copy the name, the next OPS_GetString may overwrite it
+    std::string name(fileName);
+    bool binary = false;
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char* option = OPS_GetString();
+	if (strcmp(option,"-binary") == 0)
+	    binary = true;
+	else {
+	    opserr << "WARNING convergenceLog - unknown option " << option << endln;
+	    return -1;
+	}
+    }
+
+    if (ConvergenceLog::open(name.c_str(), binary) < 0)
+	return -1;
+
+    return 0;
+}
+
+int OPS_profile()
+{
+    if (OPS_GetNumRemainingInputArgs() < 1) {
+	opserr << "WARNING profile on|off|reset|report\n";
+	return -1;
+    }
+
+    const char* action = OPS_GetString();
+    int numdata = 1;
+
+    if (strcmp(action,"on") == 0) {
+	bool cpuTime = false;
+	while (OPS_GetNumRemainingInputArgs() > 0) {
+	    const char* option = OPS_GetString();
+	    if (strcmp(option,"-cpu") == 0)
+		cpuTime = true;
+	    else if (strcmp(option,"-classes") == 0)
+		ClassProfiler::setEnabled(true);
+	    else if (strcmp(option,"-trace") == 0) {
+		int maxEvents;
+		if (OPS_GetNumRemainingInputArgs() < 1 || OPS_GetIntInput(&numdata, &maxEvents) < 0) {
+		    opserr << "WARNING profile on -trace maxEvents?\n";
+		    return -1;
+		}
+		PhaseProfiler::setTrace(maxEvents);
+	    }
+	}
+	PhaseProfiler::setEnabled(true, cpuTime);
+
+    } else if (strcmp(action,"off") == 0) {
+	PhaseProfiler::setEnabled(false);
+	PhaseProfiler::setTrace(0);
+	ClassProfiler::setEnabled(false);
+
+    } else if (strcmp(action,"reset") == 0) {
+	PhaseProfiler::reset();
+	ClassProfiler::reset();
+
+    } else if (strcmp(action,"report") == 0) {
+	bool written = false;
+	int numClasses = 20;
+	while (OPS_GetNumRemainingInputArgs() > 1) {
+	    const char* option = OPS_GetString();
+	    if (strcmp(option,"-classes") == 0) {
+		if (OPS_GetIntInput(&numdata, &numClasses) < 0) {
+		    opserr << "WARNING profile report -classes numMax?\n";
+		    return -1;
+		}
+		continue;
+	    }
+	    const char* fileName = OPS_GetString();
+	    int res = 0;
+	    if (strcmp(option,"-json") == 0)
+		res = PhaseProfiler::writeJSON(fileName);
+	    else if (strcmp(option,"-trace") == 0)
+		res = PhaseProfiler::writeTrace(fileName);
+	    else {
+		opserr << "WARNING profile report - unknown option " << option << endln;
+		return -1;
+	    }
+	    if (res < 0)
+		return -1;
+	    written = true;
+	}
+	if (written == false) {
+	    PhaseProfiler::report(opserr);
+	    ClassProfiler::report(opserr, numClasses);
+	}
+
+	// name count wall cpu of each phase
+	std::string result;
+	char buffer[80];
+	for (int i=0; i<PROFILE_NUM_PHASES; i++) {
+	    sprintf(buffer, "%s %d %.10g %.10g ", PhaseProfiler::getName(i), PhaseProfiler::getCount(i),
+		    PhaseProfiler::getWallTime(i), PhaseProfiler::getCPUTime(i));
+	    result += buffer;
+	}
+	if (OPS_SetString(result.c_str()) < 0) {
+	    opserr << "WARNING profile report - failed to set output\n";
+	    return -1;
+	}
+
+    } else {
+	opserr << "WARNING profile - unknown action " << action << ", valid on, off, reset, report\n";
+	return -1;
+    }
+
+    return 0;
+}
+
 int OPS_convertTextToBinary()
 {
     if (OPS_GetNumRemainingInputArgs() < 2) {
@@ -1139,6 +1419,27 @@ int OPS_convertTextToBinary()
     
     const char *inputFile = OPS_GetString();
     const char *outputFile = OPS_GetString();
+
+    // -timeSeries writes the mapped format read by PathSeries & PathTimeSeries,
+    // -time if the text holds time & value pairs
+    // -drm numNodes writes the binary format read by the DRM input handlers
+    if (OPS_GetNumRemainingInputArgs() > 0) {
+	const char *type = OPS_GetString();
+	if (strcmp(type,"-timeSeries") == 0) {
+	    int numCols = 1;
+	    if (OPS_GetNumRemainingInputArgs() > 0 && strcmp(OPS_GetString(),"-time") == 0)
+		numCols = 2;
+	    return TimeSeriesFile::textToBinary(inputFile, outputFile, numCols);
+	} else if (strcmp(type,"-drm") == 0) {
+	    int numNodes;
+	    int numData = 1;
+	    if (OPS_GetNumRemainingInputArgs() < 1 || OPS_GetIntInput(&numData, &numNodes) < 0) {
+		opserr << "ERROR convertTextToBinary - -drm needs numNodes\n";
+		return -1;
+	    }
+	    return drmTextToBinary(inputFile, outputFile, numNodes);
+	}
+    }
     
     return textToBinary(inputFile, outputFile);
 }
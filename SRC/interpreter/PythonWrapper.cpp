@@ -42,6 +42,8 @@ UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 #include "PythonWrapper.h"
 #include "OpenSeesCommands.h"
 #include <OPS_Globals.h>
+#include <elementAPI.h>
+#include <BulkModel.h>
 
 PythonWrapper* wrapper = 0;
 
@@ -252,6 +254,224 @@ static PyObject *Py_ops_element(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+//
+// the bulk commands take the data of all the nodes or elements in
+// sequences or in objects with the buffer protocol, such as NumPy arrays
+//
+
+template<class T> static int
+getBufferArray(PyObject* obj, std::vector<T>& data)
+{
+    if (PyObject_CheckBuffer(obj)) {
+	Py_buffer view;
+	if (PyObject_GetBuffer(obj, &view, PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) != 0) {
+	    return -1;
+	}
+
+	// the format character, after the byte order if any
+	const char* format = view.format;
+	if (format == 0) format = "B";
+	if (*format == '@' || *format == '=' || *format == '<' || *format == '>' || *format == '!') format++;
+
+	Py_ssize_t size = view.itemsize > 0 ? view.len/view.itemsize : 0;
+	data.resize(size);
+	int res = 0;
+	for (Py_ssize_t i = 0; i < size && res == 0; i++) {
+	    const char* item = (const char*)view.buf + i*view.itemsize;
+	    if (*format == 'd') {
+		data[i] = (T)*(const double*)item;
+	    } else if (*format == 'f') {
+		data[i] = (T)*(const float*)item;
+	    } else if ((*format == 'i' || *format == 'l' || *format == 'q') && view.itemsize == 4) {
+		data[i] = (T)*(const int*)item;
+	    } else if ((*format == 'i' || *format == 'l' || *format == 'q') && view.itemsize == 8) {
+		data[i] = (T)*(const long long*)item;
+	    } else {
+		opserr << "WARNING unsupported array format " << view.format << "\n";
+		res = -1;
+	    }
+	}
+	PyBuffer_Release(&view);
+	return res;
+    }
+
+    PyObject* seq = PySequence_Fast(obj, "a sequence or an array is expected");
+    if (seq == 0) {
+	return -1;
+    }
+    Py_ssize_t size = PySequence_Fast_GET_SIZE(seq);
+    data.resize(size);
+    for (Py_ssize_t i = 0; i < size; i++) {
+	PyObject* o = PySequence_Fast_GET_ITEM(seq, i);
+	if (PyFloat_Check(o)) {
+	    data[i] = (T)PyFloat_AsDouble(o);
+	} else {
+	    data[i] = (T)PyLong_AsLong(o);
+	}
+    }
+    Py_DECREF(seq);
+    if (PyErr_Occurred()) {
+	return -1;
+    }
+
+    return 0;
+}
+
+static PyObject *Py_ops_nodes(PyObject *self, PyObject *args)
+{
+    // nodes(tags, crds, <ndf>)
+    PyObject* tagsObj = 0;
+    PyObject* crdsObj = 0;
+    int ndf = OPS_GetNDF();
+    if (!PyArg_ParseTuple(args, "OO|i", &tagsObj, &crdsObj, &ndf)) return NULL;
+
+    Domain* theDomain = OPS_GetDomain();
+    if (theDomain == 0) return NULL;
+
+    std::vector<int> tags;
+    std::vector<double> crds;
+    if (getBufferArray(tagsObj, tags) < 0 || getBufferArray(crdsObj, crds) < 0) {
+	opserr << "WARNING nodes - invalid tags or crds\n";
+	return NULL;
+    }
+
+    int ndm = OPS_GetNDM();
+    int numNodes = (int)tags.size();
+    if ((int)crds.size() != numNodes*ndm) {
+	opserr << "WARNING nodes - " << (int)crds.size() << " coordinates given for ";
+	opserr << numNodes << " nodes in " << ndm << " dimensions\n";
+	return NULL;
+    }
+
+    if (numNodes > 0 &&
+	BulkModel::addNodes(*theDomain, numNodes, &tags[0], ndm, &crds[0], ndf) < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_fixes(PyObject *self, PyObject *args)
+{
+    // fixes(tags, fixities)
+    PyObject* tagsObj = 0;
+    PyObject* fixObj = 0;
+    if (!PyArg_ParseTuple(args, "OO", &tagsObj, &fixObj)) return NULL;
+
+    Domain* theDomain = OPS_GetDomain();
+    if (theDomain == 0) return NULL;
+
+    std::vector<int> tags, fix;
+    if (getBufferArray(tagsObj, tags) < 0 || getBufferArray(fixObj, fix) < 0) {
+	opserr << "WARNING fixes - invalid tags or fixities\n";
+	return NULL;
+    }
+
+    int numNodes = (int)tags.size();
+    if (numNodes > 0) {
+	int ndf = (int)fix.size()/numNodes;
+	if (ndf == 0 || (int)fix.size() != numNodes*ndf) {
+	    opserr << "WARNING fixes - number of fixities not a multiple of the number of nodes\n";
+	    return NULL;
+	}
+	if (BulkModel::addFixities(*theDomain, numNodes, &tags[0], ndf, &fix[0]) < 0) return NULL;
+    }
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_masses(PyObject *self, PyObject *args)
+{
+    // masses(tags, masses)
+    PyObject* tagsObj = 0;
+    PyObject* massObj = 0;
+    if (!PyArg_ParseTuple(args, "OO", &tagsObj, &massObj)) return NULL;
+
+    Domain* theDomain = OPS_GetDomain();
+    if (theDomain == 0) return NULL;
+
+    std::vector<int> tags;
+    std::vector<double> mass;
+    if (getBufferArray(tagsObj, tags) < 0 || getBufferArray(massObj, mass) < 0) {
+	opserr << "WARNING masses - invalid tags or masses\n";
+	return NULL;
+    }
+
+    int numNodes = (int)tags.size();
+    if (numNodes > 0) {
+	int ndf = (int)mass.size()/numNodes;
+	if (ndf == 0 || (int)mass.size() != numNodes*ndf) {
+	    opserr << "WARNING masses - number of masses not a multiple of the number of nodes\n";
+	    return NULL;
+	}
+	if (BulkModel::addMasses(*theDomain, numNodes, &tags[0], ndf, &mass[0]) < 0) return NULL;
+    }
+
+    return wrapper->getResults();
+}
+
+static PyObject *newInt(int value)
+{
+#if PY_MAJOR_VERSION >= 3
+    return PyLong_FromLong(value);
+#else
+    return PyInt_FromLong(value);
+#endif
+}
+
+static PyObject *Py_ops_elements(PyObject *self, PyObject *args)
+{
+    // elements(eleType, tags, connectivity, *args shared by the elements)
+    Py_ssize_t numArgs = PyTuple_Size(args);
+    if (numArgs < 3) {
+	opserr << "WARNING want: elements(eleType, eleTags, connectivity, *args)\n";
+	return NULL;
+    }
+
+    std::vector<int> tags, nodes;
+    if (getBufferArray(PyTuple_GetItem(args, 1), tags) < 0 ||
+	getBufferArray(PyTuple_GetItem(args, 2), nodes) < 0) {
+	opserr << "WARNING elements - invalid eleTags or connectivity\n";
+	return NULL;
+    }
+
+    int numEle = (int)tags.size();
+    if (numEle == 0) {
+	return wrapper->getResults();
+    }
+
+    int numNodes = (int)nodes.size()/numEle;
+    if (numNodes == 0 || (int)nodes.size() != numEle*numNodes) {
+	opserr << "WARNING elements - connectivity not a multiple of the number of elements\n";
+	return NULL;
+    }
+
+    // each element is created by the element command from the arguments
+    // (eleType, tag, nodes.., args..)
+    PyObject* eleType = PyTuple_GetItem(args, 0);
+    int eleArgs = 2 + numNodes + (int)numArgs - 3;
+    for (int i = 0; i < numEle; i++) {
+	PyObject* eleArgv = PyTuple_New(eleArgs);
+	Py_INCREF(eleType);
+	PyTuple_SET_ITEM(eleArgv, 0, eleType);
+	PyTuple_SET_ITEM(eleArgv, 1, newInt(tags[i]));
+	for (int j = 0; j < numNodes; j++) {
+	    PyTuple_SET_ITEM(eleArgv, 2+j, newInt(nodes[i*numNodes+j]));
+	}
+	for (int j = 3; j < numArgs; j++) {
+	    PyObject* o = PyTuple_GetItem(args, j);
+	    Py_INCREF(o);
+	    PyTuple_SET_ITEM(eleArgv, 2+numNodes+j-3, o);
+	}
+
+	wrapper->resetCommandLine(eleArgs, 1, eleArgv);
+	int res = OPS_Element();
+	wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+	Py_DECREF(eleArgv);
+	if (res < 0) return NULL;
+    }
+
+    return wrapper->getResults();
+}
+
 static PyObject *Py_ops_timeSeries(PyObject *self, PyObject *args)
 {
     wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
@@ -720,6 +940,33 @@ static PyObject *Py_ops_restore(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+static PyObject *Py_ops_snapshot(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_snapshot() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_saveModel(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_saveModel() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_loadModel(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_loadModel() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
 static PyObject *Py_ops_eleForce(PyObject *self, PyObject *args)
 {
     wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
@@ -1017,6 +1264,51 @@ static PyObject *Py_ops_convertBinaryToText(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+static PyObject *Py_ops_convertCompressedToText(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_convertCompressedToText() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_recorderCost(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_recorderCost() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_profile(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_profile() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_captureSOE(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_captureSOE() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_mergeProcessFiles(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_mergeProcessFiles() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
 static PyObject *Py_ops_getEleTags(PyObject *self, PyObject *args)
 {
     wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
@@ -1198,6 +1490,24 @@ static PyObject *Py_ops_systemSize(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+static PyObject *Py_ops_memoryReport(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_memoryReport() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_convergenceLog(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_convergenceLog() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
 static PyObject *Py_ops_version(PyObject *self, PyObject *args)
 {
     wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
@@ -1332,6 +1642,10 @@ PythonWrapper::addOpenSeesCommands()
     addCommand("model", &Py_ops_model);
     addCommand("node", &Py_ops_node);
     addCommand("fix", &Py_ops_fix);
+    addCommand("nodes", &Py_ops_nodes);
+    addCommand("fixes", &Py_ops_fixes);
+    addCommand("masses", &Py_ops_masses);
+    addCommand("elements", &Py_ops_elements);
     addCommand("element", &Py_ops_element);
     addCommand("timeSeries", &Py_ops_timeSeries);
     addCommand("pattern", &Py_ops_pattern);
@@ -1385,6 +1699,9 @@ PythonWrapper::addOpenSeesCommands()
     addCommand("database", &Py_ops_database);
     addCommand("save", &Py_ops_save);
     addCommand("restore", &Py_ops_restore);
+    addCommand("snapshot", &Py_ops_snapshot);
+    addCommand("saveModel", &Py_ops_saveModel);
+    addCommand("loadModel", &Py_ops_loadModel);
     addCommand("eleForce", &Py_ops_eleForce);
     addCommand("eleDynamicalForce", &Py_ops_eleDynamicalForce);
     addCommand("nodeUnbalance", &Py_ops_nodeUnbalance);
@@ -1418,6 +1735,11 @@ PythonWrapper::addOpenSeesCommands()
     addCommand("stripXML", &Py_ops_stripXML);
     addCommand("convertBinaryToText", &Py_ops_convertBinaryToText);
     addCommand("convertTextToBinary", &Py_ops_convertTextToBinary);
+    addCommand("convertCompressedToText", &Py_ops_convertCompressedToText);
+    addCommand("mergeProcessFiles", &Py_ops_mergeProcessFiles);
+    addCommand("recorderCost", &Py_ops_recorderCost);
+    addCommand("profile", &Py_ops_profile);
+    addCommand("captureSOE", &Py_ops_captureSOE);
     addCommand("getEleTags", &Py_ops_getEleTags);
     addCommand("getNodeTags", &Py_ops_getNodeTags);
     addCommand("getParamTags", &Py_ops_getParamTags);
@@ -1438,6 +1760,8 @@ PythonWrapper::addOpenSeesCommands()
     addCommand("numFact", &Py_ops_numFact);
     addCommand("numIter", &Py_ops_numIter);
     addCommand("systemSize", &Py_ops_systemSize);
+    addCommand("memoryReport", &Py_ops_memoryReport);
+    addCommand("convergenceLog", &Py_ops_convergenceLog);
     addCommand("version", &Py_ops_version);
     addCommand("setMaxOpenFiles", &Py_ops_setMaxOpenFiles);
     addCommand("background", &Py_ops_background);
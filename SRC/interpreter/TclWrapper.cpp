@@ -613,6 +613,30 @@ static int Tcl_ops_restore(ClientData clientData, Tcl_Interp *interp, int argc,
     return TCL_OK;
 }
 
+static int Tcl_ops_snapshot(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_snapshot() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
+static int Tcl_ops_saveModel(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_saveModel() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
+static int Tcl_ops_loadModel(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_loadModel() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
 static int Tcl_ops_eleForce(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
     wrapper->resetCommandLine(argc, 1, argv);
 
@@ -837,6 +861,46 @@ static int Tcl_ops_convertTextToBinary(ClientData clientData, Tcl_Interp *interp
     return TCL_OK;
 }
 
+static int Tcl_ops_convertCompressedToText(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_convertCompressedToText() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
+static int Tcl_ops_recorderCost(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_recorderCost() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
+static int Tcl_ops_profile(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_profile() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
+static int Tcl_ops_captureSOE(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_captureSOE() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
+static int Tcl_ops_mergeProcessFiles(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_mergeProcessFiles() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
 static int Tcl_ops_getEleTags(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
     wrapper->resetCommandLine(argc, 1, argv);
 
@@ -997,6 +1061,22 @@ static int Tcl_ops_systemSize(ClientData clientData, Tcl_Interp *interp, int arg
     return TCL_OK;
 }
 
+static int Tcl_ops_memoryReport(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_memoryReport() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
+static int Tcl_ops_convergenceLog(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_convergenceLog() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
 static int Tcl_ops_version(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
     wrapper->resetCommandLine(argc, 1, argv);
 
@@ -1172,6 +1252,9 @@ TclWrapper::addOpenSeesCommands(Tcl_Interp* interp)
     addCommand(interp,"database", &Tcl_ops_database);
     addCommand(interp,"save", &Tcl_ops_save);
     addCommand(interp,"restore", &Tcl_ops_restore);
+    addCommand(interp,"snapshot", &Tcl_ops_snapshot);
+    addCommand(interp,"saveModel", &Tcl_ops_saveModel);
+    addCommand(interp,"loadModel", &Tcl_ops_loadModel);
     addCommand(interp,"eleForce", &Tcl_ops_eleForce);
     addCommand(interp,"eleDynamicalForce", &Tcl_ops_eleDynamicalForce);
     addCommand(interp,"nodeUnbalance", &Tcl_ops_nodeUnbalance);
@@ -1200,6 +1283,11 @@ TclWrapper::addOpenSeesCommands(Tcl_Interp* interp)
     addCommand(interp,"stripXML", &Tcl_ops_stripXML);
     addCommand(interp,"convertBinaryToText", &Tcl_ops_convertBinaryToText);
     addCommand(interp,"convertTextToBinary", &Tcl_ops_convertTextToBinary);
+    addCommand(interp,"convertCompressedToText", &Tcl_ops_convertCompressedToText);
+    addCommand(interp,"mergeProcessFiles", &Tcl_ops_mergeProcessFiles);
+    addCommand(interp,"recorderCost", &Tcl_ops_recorderCost);
+    addCommand(interp,"profile", &Tcl_ops_profile);
+    addCommand(interp,"captureSOE", &Tcl_ops_captureSOE);
     addCommand(interp,"getEleTags", &Tcl_ops_getEleTags);
     addCommand(interp,"getNodeTags", &Tcl_ops_getNodeTags);
     addCommand(interp,"getParamTags", &Tcl_ops_getParamTags);
@@ -1220,6 +1308,8 @@ TclWrapper::addOpenSeesCommands(Tcl_Interp* interp)
     addCommand(interp,"numFact", &Tcl_ops_numFact);
     addCommand(interp,"numIter", &Tcl_ops_numIter);
     addCommand(interp,"systemSize", &Tcl_ops_systemSize);
+    addCommand(interp,"memoryReport", &Tcl_ops_memoryReport);
+    addCommand(interp,"convergenceLog", &Tcl_ops_convergenceLog);
     addCommand(interp,"version", &Tcl_ops_version);
     addCommand(interp,"setMaxOpenFiles", &Tcl_ops_setMaxOpenFiles);
     addCommand(interp,"background", &Tcl_ops_background);
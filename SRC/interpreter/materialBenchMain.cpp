@@ -0,0 +1,445 @@
+/* *****************************************************************************
+Copyright (c) 2012-2017, The Regents of the University of California (Regents).
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without 
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the FreeBSD Project.
+
+REGENTS SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+THE SOFTWARE AND ACCOMPANYING DOCUMENTATION, IF ANY, PROVIDED HEREUNDER IS 
+PROVIDED "AS IS". REGENTS HAS NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT, 
+UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+
+*************************************************************************** */
+
+// Description: a compiled micro-benchmark of single materials. Materials
+// are created by the parsing functions of the uniaxialMaterial and
+// nDMaterial commands, the arguments coming from the command line instead
+// of an interpreter, so any registered material can be measured with the
+// parameters it would be given in a script. Each material is driven by
+// monotonic, cyclic and random strain histories, reporting
+//
+//   - setTrialStrain + getStress + getTangent + commitState calls per second
+//   - the heap memory allocated by getCopy(), per instance
+//   - the time of getCopy()
+//
+// usage: materialBench <-steps n> <-copies n> <-protocol name|all>
+//                      <-ndType type> <-out file> <-label string>
+//                      <-uniaxial type tag args.. <-strain max>> ..
+//                      <-nD type tag args.. <-strain max>> ..
+//
+// without any material a standard set is run. With -out one line of JSON
+// per material and protocol is appended to the file.
+
+#include "DL_Interpreter.h"
+#include "OpenSeesCommands.h"
+#include <UniaxialMaterial.h>
+#include <NDMaterial.h>
+#include <Vector.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <new>
+
+//
+// heap accounting, used for the footprint of a copy
+//
+
+static long long numLiveBytes = 0;
+
+void *operator new(size_t size)
+{
+  // the size is kept in front of the block, 16 bytes to keep the alignment
+  char *block = (char *)malloc(size + 16);
+  if (block == 0)
+    throw std::bad_alloc();
+  *((size_t *)block) = size;
+  numLiveBytes += size;
+  return block + 16;
+}
+
+void operator delete(void *ptr) noexcept
+{
+  if (ptr == 0)
+    return;
+  char *block = (char *)ptr - 16;
+  numLiveBytes -= *((size_t *)block);
+  free(block);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+  ::operator delete(ptr);
+}
+
+//
+// an interpreter whose input is a list of words
+//
+
+class ArgumentInterpreter: public DL_Interpreter
+{
+  public:
+    ArgumentInterpreter() :current(0) {};
+
+    int run() {return 0;};
+
+    void setInput(const std::vector<std::string> &theArgs) {args = theArgs; current = 0;};
+
+    int getNumRemainingInputArgs(void) {return (int)args.size() - current;};
+
+    int getInt(int *data, int numArgs) {
+      if (this->getNumRemainingInputArgs() < numArgs)
+	return -1;
+      for (int i=0; i<numArgs; i++) {
+	char *end;
+	const char *arg = args[current++].c_str();
+	data[i] = (int)strtol(arg, &end, 10);
+	if (end == arg || *end != '\0')
+	  return -1;
+      }
+      return 0;
+    };
+
+    int getDouble(double *data, int numArgs) {
+      if (this->getNumRemainingInputArgs() < numArgs)
+	return -1;
+      for (int i=0; i<numArgs; i++) {
+	char *end;
+	const char *arg = args[current++].c_str();
+	data[i] = strtod(arg, &end);
+	if (end == arg || *end != '\0')
+	  return -1;
+      }
+      return 0;
+    };
+
+    const char *getString() {
+      if (current >= (int)args.size())
+	return 0;
+      return args[current++].c_str();
+    };
+
+    // as in Tcl cArg counts the command name, negative moves back
+    void resetInput(int cArg) {
+      current = (cArg < 0) ? current + cArg : cArg - 1;
+      if (current < 0)
+	current = 0;
+    };
+
+    int setInt(int *, int) {return 0;};
+    int setDouble(double *, int) {return 0;};
+    int setString(const char *) {return 0;};
+
+  private:
+    std::vector<std::string> args;
+    int current;
+};
+
+struct BenchMaterial {
+  bool isND;
+  std::vector<std::string> args;  // type tag parameters
+  double maxStrain;
+};
+
+static const char *standardMaterials[] = {
+  "u 0.01 Elastic 1 200000",
+  "u 0.01 ElasticPP 2 200000 0.002",
+  "u 0.01 Steel01 3 420 200000 0.01",
+  "u 0.01 Steel02 4 420 200000 0.01 18 0.925 0.15",
+  "u -0.005 Concrete01 5 -30 -0.002 -6 -0.006",
+  "u -0.005 Concrete02 6 -30 -0.002 -6 -0.006 0.1 3 1500",
+  "u 0.01 Hysteretic 7 420 0.002 500 0.02 -420 -0.002 -500 -0.02 0.8 0.2 0 0",
+  "n 0.01 ElasticIsotropic 11 200000 0.3",
+  "n 0.01 J2Plasticity 12 166667 76923 250 300 10 100",
+  0
+};
+
+static const char *protocolNames[] = {"monotonic", "cyclic", "random"};
+static const int numProtocols = 3;
+
+// strain history value at step i of n, in [-1,1]
+static double
+getProtocolValue(int protocol, int i, int n, double &state)
+{
+  double t = (i+1.0)/n;
+  switch (protocol) {
+  case 0:
+    return t;
+  case 1: {
+    // 10 cycles of amplitude increasing every cycle
+    const int numCycles = 10;
+    double amp = ceil(t*numCycles)/numCycles;
+    return amp*sin(2.0*3.14159265358979*t*numCycles);
+  }
+  default: {
+    // random walk, the same sequence on every run
+    static unsigned int seed = 0;
+    if (i == 0) {
+      seed = 12345;
+      state = 0.0;
+    }
+    seed = seed*1103515245 + 12345;
+    double u = ((seed >> 16) & 0x7fff)/32767.0;
+    state += 0.1*(u - 0.5);
+    if (state > 1.0) state = 1.0;
+    if (state < -1.0) state = -1.0;
+    return state;
+  }
+  }
+}
+
+static double
+elapsed(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// drive a copy of the material, returns the time taken
+static double
+drive(UniaxialMaterial *theUniaxial, NDMaterial *theND, const char *ndType,
+      int protocol, int numSteps, double maxStrain, int &numFailed)
+{
+  double state = 0.0;
+  numFailed = 0;
+
+  if (theUniaxial != 0) {
+    UniaxialMaterial *theMat = theUniaxial->getCopy();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i=0; i<numSteps; i++) {
+      double strain = maxStrain*getProtocolValue(protocol, i, numSteps, state);
+      if (theMat->setTrialStrain(strain) != 0)
+	numFailed++;
+      theMat->getStress();
+      theMat->getTangent();
+      theMat->commitState();
+    }
+    double time = elapsed(start);
+    delete theMat;
+    return time;
+  }
+
+  NDMaterial *theMat = theND->getCopy(ndType);
+  if (theMat == 0)
+    return -1.0;
+
+  // strain direction, mostly axial with some shear
+  int size = theMat->getStrain().Size();
+  Vector direction(size);
+  static const double dir3[3] = {1.0, -0.3, 0.5};
+  static const double dir6[6] = {1.0, -0.3, -0.3, 0.5, 0.25, 0.1};
+  for (int j=0; j<size; j++)
+    direction(j) = (size == 3) ? dir3[j] : ((size == 6) ? dir6[j] : 1.0/(j+1));
+  Vector strain(size);
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (int i=0; i<numSteps; i++) {
+    strain.addVector(0.0, direction, maxStrain*getProtocolValue(protocol, i, numSteps, state));
+    if (theMat->setTrialStrain(strain) != 0)
+      numFailed++;
+    theMat->getStress();
+    theMat->getTangent();
+    theMat->commitState();
+  }
+  double time = elapsed(start);
+  delete theMat;
+  return time;
+}
+
+static int
+runMaterial(const BenchMaterial &theBench, ArgumentInterpreter &theInterpreter,
+	    int protocol, int numSteps, int numCopies, const char *ndType,
+	    std::ofstream *theFile, const char *label)
+{
+  // create the material through its parsing function
+  theInterpreter.setInput(theBench.args);
+  int res = theBench.isND ? OPS_NDMaterial() : OPS_UniaxialMaterial();
+  if (res < 0) {
+    opserr << "materialBench - could not create material " << theBench.args[0].c_str() << endln;
+    return -1;
+  }
+
+  int tag = atoi(theBench.args[1].c_str());
+  UniaxialMaterial *theUniaxial = 0;
+  NDMaterial *theND = 0;
+  if (theBench.isND)
+    theND = OPS_getNDMaterial(tag);
+  else
+    theUniaxial = OPS_getUniaxialMaterial(tag);
+  if (theUniaxial == 0 && theND == 0) {
+    opserr << "materialBench - material " << tag << " not found\n";
+    return -1;
+  }
+
+  // footprint and cost of getCopy
+  std::vector<void *> theCopies(numCopies);
+  long long bytesBefore = numLiveBytes;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (int i=0; i<numCopies; i++) {
+    if (theND != 0)
+      theCopies[i] = theND->getCopy(ndType);
+    else
+      theCopies[i] = theUniaxial->getCopy();
+  }
+  double copyTime = elapsed(start)/numCopies;
+  double bytesPerCopy = (double)(numLiveBytes - bytesBefore)/numCopies;
+  for (int i=0; i<numCopies; i++) {
+    if (theND != 0)
+      delete (NDMaterial *)theCopies[i];
+    else
+      delete (UniaxialMaterial *)theCopies[i];
+  }
+
+  const char *className = (theND != 0) ? theND->getClassType() : theUniaxial->getClassType();
+
+  for (int p=0; p<numProtocols; p++) {
+    if (protocol != -1 && protocol != p)
+      continue;
+
+    int numFailed = 0;
+    double time = drive(theUniaxial, theND, ndType, p, numSteps, theBench.maxStrain, numFailed);
+    if (time < 0.0) {
+      opserr << "materialBench - " << className << " has no " << ndType << " copy\n";
+      return -1;
+    }
+    double rate = (time > 0.0) ? numSteps/time : 0.0;
+
+    char buffer[512];
+    sprintf(buffer, "%-24s %-10s %12.0f calls/s  %8.0f bytes  getCopy %8.3f us  failed %d\n",
+	    className, protocolNames[p], rate, bytesPerCopy, 1.0e6*copyTime, numFailed);
+    opserr << buffer;
+
+    if (theFile != 0) {
+      sprintf(buffer, "{\"label\": \"%s\", \"material\": \"%s\", \"type\": \"%s\", "
+	      "\"protocol\": \"%s\", \"steps\": %d, \"maxStrain\": %g, \"callsPerSecond\": %.1f, "
+	      "\"bytes\": %.1f, \"copyTime\": %.9f, \"failed\": %d}\n",
+	      label, theBench.args[0].c_str(), className, protocolNames[p], numSteps,
+	      theBench.maxStrain, rate, bytesPerCopy, copyTime, numFailed);
+      *theFile << buffer;
+    }
+  }
+
+  return 0;
+}
+
+static bool
+isOption(const char *arg)
+{
+  return arg[0] == '-' && ((arg[1] >= 'a' && arg[1] <= 'z') || (arg[1] >= 'A' && arg[1] <= 'Z'));
+}
+
+int main(int argc, char **argv)
+{
+  ArgumentInterpreter theInterpreter;
+  OpenSeesCommands theCommands(&theInterpreter);
+
+  int numSteps = 100000;
+  int numCopies = 1000;
+  int protocol = -1;
+  const char *ndType = "ThreeDimensional";
+  const char *fileName = 0;
+  const char *label = "";
+  std::vector<BenchMaterial> theMaterials;
+
+  for (int i=1; i<argc; i++) {
+    if ((strcmp(argv[i],"-uniaxial") == 0 || strcmp(argv[i],"-nD") == 0) && i+2 < argc) {
+      BenchMaterial theBench;
+      theBench.isND = (strcmp(argv[i],"-nD") == 0);
+      theBench.maxStrain = 0.01;
+      while (i+1 < argc && isOption(argv[i+1]) == false)
+	theBench.args.push_back(argv[++i]);
+      if (i+2 < argc && strcmp(argv[i+1],"-strain") == 0) {
+	theBench.maxStrain = atof(argv[i+2]);
+	i += 2;
+      }
+      theMaterials.push_back(theBench);
+    } else if (strcmp(argv[i],"-steps") == 0 && i+1 < argc)
+      numSteps = atoi(argv[++i]);
+    else if (strcmp(argv[i],"-copies") == 0 && i+1 < argc)
+      numCopies = atoi(argv[++i]);
+    else if (strcmp(argv[i],"-protocol") == 0 && i+1 < argc) {
+      i++;
+      protocol = -1;
+      for (int j=0; j<numProtocols; j++)
+	if (strcmp(argv[i], protocolNames[j]) == 0)
+	  protocol = j;
+      if (protocol == -1 && strcmp(argv[i],"all") != 0) {
+	opserr << "materialBench - unknown protocol " << argv[i] << endln;
+	return -1;
+      }
+    } else if (strcmp(argv[i],"-ndType") == 0 && i+1 < argc)
+      ndType = argv[++i];
+    else if (strcmp(argv[i],"-out") == 0 && i+1 < argc)
+      fileName = argv[++i];
+    else if (strcmp(argv[i],"-label") == 0 && i+1 < argc)
+      label = argv[++i];
+    else {
+      opserr << "materialBench <-steps n> <-copies n> <-protocol name|all> <-ndType type> ";
+      opserr << "<-out file> <-label string> <-uniaxial type tag args.. <-strain max>> ";
+      opserr << "<-nD type tag args.. <-strain max>>\n";
+      return -1;
+    }
+  }
+
+  if (numSteps < 1)
+    numSteps = 1;
+  if (numCopies < 1)
+    numCopies = 1;
+
+  if (theMaterials.empty()) {
+    for (int i=0; standardMaterials[i] != 0; i++) {
+      BenchMaterial theBench;
+      char *line = strdup(standardMaterials[i]);
+      char *word = strtok(line, " ");
+      theBench.isND = (word[0] == 'n');
+      theBench.maxStrain = atof(strtok(0, " "));
+      while ((word = strtok(0, " ")) != 0)
+	theBench.args.push_back(word);
+      free(line);
+      theMaterials.push_back(theBench);
+    }
+  }
+
+  std::ofstream theFile;
+  if (fileName != 0) {
+    theFile.open(fileName, std::ios::out | std::ios::app);
+    if (!theFile.is_open()) {
+      opserr << "materialBench - could not open file " << fileName << endln;
+      return -1;
+    }
+  }
+
+  int numFailed = 0;
+  for (size_t i=0; i<theMaterials.size(); i++)
+    if (runMaterial(theMaterials[i], theInterpreter, protocol, numSteps, numCopies, ndType,
+		    (fileName != 0) ? &theFile : 0, label) != 0)
+      numFailed++;
+
+  return numFailed;
+}
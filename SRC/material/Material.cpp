@@ -65,3 +65,9 @@ Material::getResponseSensitivity(int responseID, int gradIndex,
 {
   return -1;
 }
+
+const Vector *
+Material::getResponseStorage(int responseID)
+{
+  return 0;
+}
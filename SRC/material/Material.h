@@ -43,6 +43,7 @@
 class OPS_Stream;
 class Information;
 class Response;
+class Vector;
 
 class Material : public TaggedObject, public MovableObject
 {
@@ -56,6 +57,10 @@ class Material : public TaggedObject, public MovableObject
     virtual int getResponseSensitivity(int responseID, int gradIndex,
 				       Information &info);
 
+    // the storage holding response responseID if kept current by the
+    // material, 0 otherwise (see Element::getResponseStorage)
+    virtual const Vector *getResponseStorage(int responseID);
+
     // method for this material to update itself according to its new parameters
     virtual void update(void) {return;}
 
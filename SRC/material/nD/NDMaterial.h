@@ -75,6 +75,7 @@ class NDMaterial : public Material
     virtual int commitState(void) = 0;
     virtual int revertToLastCommit(void) = 0;
     virtual int revertToStart(void) = 0;
+    virtual bool hasTrialStateChanged(void) {return true;}
 
     virtual NDMaterial *getCopy(void) = 0;
     virtual NDMaterial *getCopy(const char *code);
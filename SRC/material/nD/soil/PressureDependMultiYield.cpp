@@ -19,6 +19,7 @@
 #include <Parameter.h>
 #include <string.h>
 #include <elementAPI.h>
+#include <MemoryReport.h>
 
 int PressureDependMultiYield::matCount=0;
 int* PressureDependMultiYield::loadStagex = 0;  //=0 if elastic; =1 if plastic
@@ -1418,6 +1419,18 @@ PressureDependMultiYield::getResponse (int responseID, Information &matInfo)
   }
 }
 
+void
+PressureDependMultiYield::reportMemory(MemoryReport &theReport)
+{
+  // each T2Vector holds two Vectors of 6, each surface a T2Vector center
+  size_t t2Vector = 12*sizeof(double);
+  int numOfSurfaces = numOfSurfacesx[matN];
+  size_t bytes = sizeof(PressureDependMultiYield) + 12*t2Vector;
+  bytes += 2*(numOfSurfaces+1)*(sizeof(MultiYieldSurface) + t2Vector);
+  theReport.add(*this, bytes);
+}
+
+
 void
 PressureDependMultiYield::Print(OPS_Stream &s, int flag )
 
@@ -110,6 +110,7 @@ public:
      Response *setResponse (const char **argv, int argc, OPS_Stream &s);
      int getResponse (int responseID, Information &matInformation);
      void Print(OPS_Stream &s, int flag =0);
+     void reportMemory(MemoryReport &theReport);
      //void setCurrentStress(const Vector stress) { currentStress=T2Vector(stress); }
      int setParameter(const char **argv, int argc, Parameter &param);
      int updateParameter(int responseID, Information &eleInformation);
@@ -18,6 +18,7 @@
 #include <Parameter.h>
 #include <string.h>
 #include <elementAPI.h>
+#include <MemoryReport.h>
 
 Matrix PressureIndependMultiYield::theTangent(6,6);
 T2Vector PressureIndependMultiYield::subStrainRate;
@@ -987,6 +988,17 @@ void PressureIndependMultiYield::getBackbone (Matrix & bb)
 
 }
 
+void PressureIndependMultiYield::reportMemory(MemoryReport &theReport)
+{
+  // each T2Vector holds two Vectors of 6, each surface a T2Vector center
+  size_t t2Vector = 12*sizeof(double);
+  int numOfSurfaces = numOfSurfacesx[matN];
+  size_t bytes = sizeof(PressureIndependMultiYield) + 4*t2Vector;
+  bytes += 2*(numOfSurfaces+1)*(sizeof(MultiYieldSurface) + t2Vector);
+  theReport.add(*this, bytes);
+}
+
+
 void PressureIndependMultiYield::Print(OPS_Stream &s, int flag )
 {
   s << "PressureIndependMultiYield - loadStage: " <<  loadStagex[matN] << endln;
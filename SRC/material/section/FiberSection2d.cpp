@@ -45,6 +45,8 @@
 #include <UniaxialMaterial.h>
 #include <SectionIntegration.h>
 #include <elementAPI.h>
+#include <ClassProfiler.h>
+#include <MemoryReport.h>
 
 ID FiberSection2d::code(2);
 
@@ -373,7 +375,10 @@ FiberSection2d::setTrialSectionDeformation (const Vector &deforms)
     // determine material strain and set it
     double strain = d0 - y*d1;
     double tangent, stress;
-    res += theMat->setTrial(strain, stress, tangent);
+    {
+      ClassTimer theTimer(CLASS_PROFILE_MAT_TRIAL, theMat);
+      res += theMat->setTrial(strain, stress, tangent);
+    }
 
     double ks0 = tangent * A;
     double ks1 = ks0 * -y;
@@ -523,15 +528,35 @@ FiberSection2d::commitState(void)
 {
   int err = 0;
 
-  for (int i = 0; i < numFibers; i++)
+  // nothing to do if no fiber has left its committed state
+  if (this->hasTrialStateChanged() == false)
+    return 0;
+
+  for (int i = 0; i < numFibers; i++) {
+    ClassTimer theTimer(CLASS_PROFILE_MAT_COMMIT, theMaterials[i]);
     err += theMaterials[i]->commitState();
+  }
 
   return err;
 }
 
+bool
+FiberSection2d::hasTrialStateChanged(void)
+{
+  for (int i = 0; i < numFibers; i++)
+    if (theMaterials[i]->hasTrialStateChanged() == true)
+      return true;
+
+  return false;
+}
+
 int
 FiberSection2d::revertToLastCommit(void)
 {
+  // nothing to do if no fiber has left its committed state
+  if (this->hasTrialStateChanged() == false)
+    return 0;
+
   int err = 0;
 
   kData[0] = 0.0; kData[1] = 0.0; kData[2] = 0.0; kData[3] = 0.0;
@@ -793,6 +818,20 @@ FiberSection2d::recvSelf(int commitTag, Channel &theChannel,
   return res;
 }
 
+void
+FiberSection2d::reportMemory(MemoryReport &theReport)
+{
+  // s and ks hold their data in sData and kData
+  size_t bytes = sizeof(FiberSection2d) + sizeof(Vector) + sizeof(Matrix);
+  bytes += sizeFibers*(sizeof(UniaxialMaterial *) + 2*sizeof(double));
+  bytes += MemoryReport::bytes(e) + MemoryReport::bytes(dedh);
+  theReport.add(*this, bytes);
+
+  for (int i=0; i<numFibers; i++)
+    if (theMaterials[i] != 0)
+      theMaterials[i]->reportMemory(theReport);
+}
+
 void
 FiberSection2d::Print(OPS_Stream &s, int flag)
 {
@@ -994,6 +1033,18 @@ FiberSection2d::getResponse(int responseID, Information &sectInfo)
   return SectionForceDeformation::getResponse(responseID, sectInfo);
 }
 
+const Vector *
+FiberSection2d::getResponseStorage(int responseID)
+{
+  // deformations and resultants are set by setTrialSectionDeformation()
+  if (responseID == 1)
+    return &e;
+  else if (responseID == 2)
+    return s;
+
+  return 0;
+}
+
 
 
 // AddingSensitivity:BEGIN ////////////////////////////////////
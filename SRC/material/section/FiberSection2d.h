@@ -63,6 +63,7 @@ class FiberSection2d : public SectionForceDeformation
 
     int   commitState(void);
     int   revertToLastCommit(void);    
+    bool  hasTrialStateChanged(void);
     int   revertToStart(void);
  
     SectionForceDeformation *getCopy(void);
@@ -73,10 +74,12 @@ class FiberSection2d : public SectionForceDeformation
     int recvSelf(int cTag, Channel &theChannel, 
 		 FEM_ObjectBroker &theBroker);
     void Print(OPS_Stream &s, int flag = 0);
+    void reportMemory(MemoryReport &theReport);
 	    
     Response *setResponse(const char **argv, int argc, 
 			  OPS_Stream &s);
     int getResponse(int responseID, Information &info);
+    const Vector *getResponseStorage(int responseID);
 
     int addFiber(Fiber &theFiber);
 
@@ -45,7 +45,9 @@
 #include <ElasticMaterial.h>
 #include <SectionIntegration.h>
 #include <elementAPI.h>
+#include <ClassProfiler.h>
 #include <string.h>
+#include <MemoryReport.h>
 
 ID FiberSection3d::code(4);
 
@@ -447,7 +449,10 @@ FiberSection3d::setTrialSectionDeformation (const Vector &deforms)
 
     // determine material strain and set it
     double strain = d0 - y*d1 + z*d2;
-    res += theMat->setTrial(strain, stress, tangent);
+    {
+      ClassTimer theTimer(CLASS_PROFILE_MAT_TRIAL, theMat);
+      res += theMat->setTrial(strain, stress, tangent);
+    }
 
     double value = tangent * A;
     double vas1 = -y*value;
@@ -638,17 +643,37 @@ FiberSection3d::commitState(void)
 {
   int err = 0;
 
-  for (int i = 0; i < numFibers; i++)
+  // nothing to do if no fiber has left its committed state
+  if (this->hasTrialStateChanged() == false)
+    return 0;
+
+  for (int i = 0; i < numFibers; i++) {
+    ClassTimer theTimer(CLASS_PROFILE_MAT_COMMIT, theMaterials[i]);
     err += theMaterials[i]->commitState();
+  }
 
   err += theTorsion->commitState();
 
   return err;
 }
 
+bool
+FiberSection3d::hasTrialStateChanged(void)
+{
+  for (int i = 0; i < numFibers; i++)
+    if (theMaterials[i]->hasTrialStateChanged() == true)
+      return true;
+
+  return theTorsion->hasTrialStateChanged();
+}
+
 int
 FiberSection3d::revertToLastCommit(void)
 {
+  // nothing to do if no fiber has left its committed state
+  if (this->hasTrialStateChanged() == false)
+    return 0;
+
   int err = 0;
 
   kData[0] = 0.0; kData[1] = 0.0; kData[2] = 0.0; kData[3] = 0.0;
@@ -976,6 +1001,22 @@ FiberSection3d::recvSelf(int commitTag, Channel &theChannel,
   return res;
 }
 
+void
+FiberSection3d::reportMemory(MemoryReport &theReport)
+{
+  // s and ks hold their data in sData and kData
+  size_t bytes = sizeof(FiberSection3d) + sizeof(Vector) + sizeof(Matrix);
+  bytes += sizeFibers*(sizeof(UniaxialMaterial *) + 3*sizeof(double));
+  bytes += MemoryReport::bytes(e);
+  theReport.add(*this, bytes);
+
+  for (int i=0; i<numFibers; i++)
+    if (theMaterials[i] != 0)
+      theMaterials[i]->reportMemory(theReport);
+  if (theTorsion != 0)
+    theTorsion->reportMemory(theReport);
+}
+
 void
 FiberSection3d::Print(OPS_Stream &s, int flag)
 {
@@ -1327,6 +1368,18 @@ FiberSection3d::getResponse(int responseID, Information &sectInfo)
   return SectionForceDeformation::getResponse(responseID, sectInfo);
 }
 
+const Vector *
+FiberSection3d::getResponseStorage(int responseID)
+{
+  // deformations and resultants are set by setTrialSectionDeformation()
+  if (responseID == 1)
+    return &e;
+  else if (responseID == 2)
+    return s;
+
+  return 0;
+}
+
 int
 FiberSection3d::setParameter(const char **argv, int argc, Parameter &param)
 {
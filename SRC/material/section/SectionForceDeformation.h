@@ -78,6 +78,7 @@ class SectionForceDeformation : public Material
   virtual int commitState (void) = 0;
   virtual int revertToLastCommit (void) = 0;
   virtual int revertToStart (void) = 0;
+  virtual bool hasTrialStateChanged (void) {return true;}
   
   virtual SectionForceDeformation *getCopy (void) = 0;
   virtual const ID &getType (void) = 0;
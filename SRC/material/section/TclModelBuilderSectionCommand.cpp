@@ -2202,8 +2202,8 @@ TclCommand_addPatch(ClientData clientData, Tcl_Interp *interp, int argc,
 
 // add patch to fiber section
 int
-TclCommand_addFiber(ClientData clientData, Tcl_Interp *interp, int argc, 
-		    TCL_Char **argv, TclModelBuilder *theTclModelBuilder)
+TclCommand_addFiber(ClientData clientData, Tcl_Interp *interp, int objc, 
+		    Tcl_Obj *CONST objv[], TclModelBuilder *theTclModelBuilder)
 {
     // check if a section is being processed
     if (currentSectionTag == 0) {
@@ -2212,7 +2212,7 @@ TclCommand_addFiber(ClientData clientData, Tcl_Interp *interp, int argc,
     }	   
     
     // make sure at least one other argument to contain patch type
-    if (argc < 5) {
+    if (objc < 5) {
 	opserr <<  "WARNING invalid num args: fiber yLoc zLoc area matTag\n";
 	return TCL_ERROR;
     }    
@@ -2239,19 +2239,19 @@ TclCommand_addFiber(ClientData clientData, Tcl_Interp *interp, int argc,
     double yLoc, zLoc, area;
 
     
-    if (Tcl_GetDouble(interp, argv[1], &yLoc) != TCL_OK) {
+    if (Tcl_GetDoubleFromObj(interp, objv[1], &yLoc) != TCL_OK) {
       opserr <<  "WARNING invalid yLoc: fiber yLoc zLoc area matTag\n";
       return TCL_ERROR;
     }    
-    if (Tcl_GetDouble(interp, argv[2], &zLoc) != TCL_OK) {
+    if (Tcl_GetDoubleFromObj(interp, objv[2], &zLoc) != TCL_OK) {
       opserr <<  "WARNING invalid zLoc: fiber yLoc zLoc area matTag\n";
       return TCL_ERROR;
     }        
-    if (Tcl_GetDouble(interp, argv[3], &area) != TCL_OK) {
+    if (Tcl_GetDoubleFromObj(interp, objv[3], &area) != TCL_OK) {
       opserr <<  "WARNING invalid area: fiber yLoc zLoc area matTag\n";
       return TCL_ERROR;
     }            
-    if (Tcl_GetInt(interp, argv[4], &matTag) != TCL_OK) {
+    if (Tcl_GetIntFromObj(interp, objv[4], &matTag) != TCL_OK) {
       opserr <<  "WARNING invalid matTag: fiber yLoc zLoc area matTag\n";
       return TCL_ERROR;
     }                
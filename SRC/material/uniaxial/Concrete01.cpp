@@ -45,6 +45,7 @@
 
 #include <elementAPI.h>
 #include <OPS_Globals.h>
+#include <MemoryReport.h>
 
 void *
 OPS_Concrete01()
@@ -541,6 +542,11 @@ int Concrete01::recvSelf (int commitTag, Channel& theChannel,
    return res;
 }
 
+void Concrete01::reportMemory(MemoryReport &theReport)
+{
+   theReport.add(*this, sizeof(Concrete01));
+}
+
 void Concrete01::Print (OPS_Stream& s, int flag)
 {
   if (flag == OPS_PRINT_PRINTMODEL_MATERIAL) {      
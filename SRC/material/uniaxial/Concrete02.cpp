@@ -262,6 +262,13 @@ Concrete02::commitState(void)
   return 0;
 }
 
+bool
+Concrete02::hasTrialStateChanged(void)
+{
+  // ecmin and dept only move with the strain, stress and tangent
+  return (eps != epsP || sig != sigP || e != eP);
+}
+
 int 
 Concrete02::revertToLastCommit(void)
 {
@@ -63,6 +63,7 @@ class Concrete02 : public UniaxialMaterial
     
     int commitState(void);
     int revertToLastCommit(void);    
+    bool hasTrialStateChanged(void);
     int revertToStart(void);        
     
     int sendSelf(int commitTag, Channel &theChannel);  
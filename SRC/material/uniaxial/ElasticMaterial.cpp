@@ -213,6 +213,8 @@ ElasticMaterial::revertToStart(void)
 {
     trialStrain      = 0.0;
     trialStrainRate  = 0.0;
+    committedStrain      = 0.0;
+    committedStrainRate  = 0.0;
     return 0;
 }
 
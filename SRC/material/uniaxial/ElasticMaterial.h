@@ -56,10 +56,13 @@ class ElasticMaterial : public UniaxialMaterial
     double getTangent(void);
     double getDampTangent(void) {return eta;};
     double getInitialTangent(void);
+    bool isLinear(void) {return (Epos == Eneg);};
 
     int commitState(void);
     int revertToLastCommit(void);    
     int revertToStart(void);        
+    bool hasTrialStateChanged(void) {return (trialStrain != committedStrain ||
+					     trialStrainRate != committedStrainRate);};
 
     UniaxialMaterial *getCopy(void);
     
@@ -47,6 +47,7 @@
 
 #include <elementAPI.h>
 #include <OPS_Globals.h>
+#include <MemoryReport.h>
 
 
 void *
@@ -523,6 +524,11 @@ int Steel01::recvSelf (int commitTag, Channel& theChannel,
    return res;
 }
 
+void Steel01::reportMemory(MemoryReport &theReport)
+{
+   theReport.add(*this, sizeof(Steel01));
+}
+
 void Steel01::Print (OPS_Stream& s, int flag)
 {
   if (flag == OPS_PRINT_PRINTMODEL_MATERIAL) {    
@@ -66,6 +66,7 @@ class Steel01 : public UniaxialMaterial
 
     int commitState(void);
     int revertToLastCommit(void);    
+    bool hasTrialStateChanged(void) {return (Tstrain != Cstrain);};
     int revertToStart(void);        
 
     UniaxialMaterial *getCopy(void);
@@ -75,6 +76,7 @@ class Steel01 : public UniaxialMaterial
 		 FEM_ObjectBroker &theBroker);    
     
     void Print(OPS_Stream &s, int flag =0);
+    void reportMemory(MemoryReport &theReport);
     
 // AddingSensitivity:BEGIN //////////////////////////////////////////
     int setParameter(const char **argv, int argc, Parameter &param);
@@ -401,6 +401,14 @@ Steel02::commitState(void)
   return 0;
 }
 
+bool
+Steel02::hasTrialStateChanged(void)
+{
+  // the reversal points (epsr, sigr, epss0, ..) only move when the loading
+  // index kon or the stress and tangent do
+  return (eps != epsP || sig != sigP || e != eP || kon != konP);
+}
+
 int 
 Steel02::revertToLastCommit(void)
 {
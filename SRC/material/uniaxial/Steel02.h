@@ -74,6 +74,7 @@ class Steel02 : public UniaxialMaterial
     
     int commitState(void);
     int revertToLastCommit(void);    
+    bool hasTrialStateChanged(void);
     int revertToStart(void);        
     
     int sendSelf(int commitTag, Channel &theChannel);  
@@ -80,6 +80,8 @@ class UniaxialMaterial : public Material
 				   OPS_Stream &theOutputStream);
     virtual int getResponse (int responseID, Information &matInformation);    
     virtual bool hasFailed(void) {return false;}
+    virtual bool isLinear(void) {return false;}
+    virtual bool hasTrialStateChanged(void) {return true;}
 
     // AddingSensitivity:BEGIN //////////////////////////////////////////
     virtual double getStressSensitivity     (int gradIndex, bool conditional);
@@ -0,0 +1,98 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+// Description: This file contains the class implementation for BulkModel.
+
+#include <BulkModel.h>
+#include <Domain.h>
+#include <Node.h>
+#include <SP_Constraint.h>
+#include <Matrix.h>
+#include <OPS_Globals.h>
+
+int
+BulkModel::addNodes(Domain &theDomain, int numNodes, const int *tags,
+		    int ndm, const double *crds, int ndf)
+{
+  if (ndm < 1 || ndm > 3 || ndf < 1) {
+    opserr << "WARNING BulkModel::addNodes() - invalid ndm " << ndm << " or ndf " << ndf << endln;
+    return -1;
+  }
+
+  for (int i=0; i<numNodes; i++) {
+    const double *crd = &crds[i*ndm];
+    Node *theNode = 0;
+    if (ndm == 1)
+      theNode = new Node(tags[i], ndf, crd[0]);
+    else if (ndm == 2)
+      theNode = new Node(tags[i], ndf, crd[0], crd[1]);
+    else
+      theNode = new Node(tags[i], ndf, crd[0], crd[1], crd[2]);
+
+    if (theDomain.addNode(theNode) == false) {
+      opserr << "WARNING BulkModel::addNodes() - failed to add node " << tags[i] << endln;
+      delete theNode;
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+int
+BulkModel::addFixities(Domain &theDomain, int numNodes, const int *tags,
+		       int ndf, const int *fix)
+{
+  for (int i=0; i<numNodes; i++) {
+    for (int j=0; j<ndf; j++) {
+      if (fix[i*ndf+j] == 0)
+	continue;
+
+      SP_Constraint *theSP = new SP_Constraint(tags[i], j, 0.0, true);
+      if (theDomain.addSP_Constraint(theSP) == false) {
+	opserr << "WARNING BulkModel::addFixities() - failed to fix dof " << j+1;
+	opserr << " of node " << tags[i] << endln;
+	delete theSP;
+	return -1;
+      }
+    }
+  }
+
+  return 0;
+}
+
+int
+BulkModel::addMasses(Domain &theDomain, int numNodes, const int *tags,
+		     int ndf, const double *mass)
+{
+  Matrix theMass(ndf, ndf);
+  for (int i=0; i<numNodes; i++) {
+    for (int j=0; j<ndf; j++)
+      theMass(j,j) = mass[i*ndf+j];
+
+    if (theDomain.setMass(theMass, tags[i]) != 0) {
+      opserr << "WARNING BulkModel::addMasses() - failed to set mass at node " << tags[i] << endln;
+      return -1;
+    }
+  }
+
+  return 0;
+}
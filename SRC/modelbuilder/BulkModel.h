@@ -0,0 +1,51 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+#ifndef BulkModel_h
+#define BulkModel_h
+
+// Description: This file contains the class definition for BulkModel.
+// BulkModel adds the nodes, fixities and masses of a whole mesh to a
+// Domain from flat arrays, as given by the nodes, fixes and masses
+// commands of the interpreters, so a mesh generated by a script or in
+// NumPy is loaded in one call and not one command per node. Entry i
+// of the arrays is at data[i*size ... i*size+size-1]. Nodes given in
+// increasing tag order are added at the end of the domain storage.
+
+class Domain;
+
+class BulkModel
+{
+  public:
+    // numNodes nodes, node i with tag tags[i] at crds[i*ndm ...]
+    static int addNodes(Domain &theDomain, int numNodes, const int *tags,
+			int ndm, const double *crds, int ndf);
+
+    // an SP_Constraint for each non zero fix[i*ndf+j], node tags[i], dof j
+    static int addFixities(Domain &theDomain, int numNodes, const int *tags,
+			   int ndf, const int *fix);
+
+    // a lumped mass mass[i*ndf ...] at node tags[i]
+    static int addMasses(Domain &theDomain, int numNodes, const int *tags,
+			 int ndf, const double *mass);
+};
+
+#endif
@@ -97,6 +97,7 @@ using std::vector;							//L.Jiang [SIF]
 extern SimulationInformation simulationInfo;		//L.Jiang [SIF]
 extern const char * getInterpPWD(Tcl_Interp *interp);  //L.Jiang [SIF]
 
+#include <BulkModel.h>
 #include <Block2D.h>
 #include <Block3D.h>
 // Added by Scott J. Brandenberg (sjbrandenberg@ucdavis.edu)
@@ -160,12 +161,32 @@ TclCommand_addParameter(ClientData clientData, Tcl_Interp *interp, int argc,
 			TCL_Char **argv);
 
 int
-TclCommand_addNode(ClientData clientData, Tcl_Interp *interp, int argc, 
-		   TCL_Char **argv);
+TclCommand_addNode(ClientData clientData, Tcl_Interp *interp, int objc, 
+		   Tcl_Obj *CONST objv[]);
 
 int
-TclCommand_addElement(ClientData clientData, Tcl_Interp *interp,  int argc, 
-		      TCL_Char **argv);
+TclCommand_addElement(ClientData clientData, Tcl_Interp *interp,  int objc, 
+		      Tcl_Obj *CONST objv[]);
+
+int
+TclCommand_addNodes(ClientData clientData, Tcl_Interp *interp, int objc, 
+		    Tcl_Obj *CONST objv[]);
+
+int
+TclCommand_addElements(ClientData clientData, Tcl_Interp *interp, int objc, 
+		       Tcl_Obj *CONST objv[]);
+
+int
+TclCommand_addFixes(ClientData clientData, Tcl_Interp *interp, int objc, 
+		    Tcl_Obj *CONST objv[]);
+
+int
+TclCommand_addMasses(ClientData clientData, Tcl_Interp *interp, int objc, 
+		     Tcl_Obj *CONST objv[]);
+
+int
+TclCommand_addFibers(ClientData clientData, Tcl_Interp *interp, int objc, 
+		     Tcl_Obj *CONST objv[]);
 
 int
 TclCommand_PFEM2D(ClientData clientData, Tcl_Interp *interp,  int argc, 
@@ -234,8 +255,8 @@ TclCommand_addSeries(ClientData clientData, Tcl_Interp *interp, int argc,
 		     TCL_Char **argv);
 
 int
-TclCommand_addHomogeneousBC(ClientData clientData, Tcl_Interp *interp, int argc,
-			    TCL_Char **argv);
+TclCommand_addHomogeneousBC(ClientData clientData, Tcl_Interp *interp, int objc,
+			    Tcl_Obj *CONST objv[]);
 int
 TclCommand_addHomogeneousBC_X(ClientData clientData, Tcl_Interp *interp, int argc,
 			      TCL_Char **argv);
@@ -247,7 +268,7 @@ TclCommand_addHomogeneousBC_Z(ClientData clientData, Tcl_Interp *interp, int arg
 			      TCL_Char **argv);
 int
 TclCommand_addEqualDOF_MP (ClientData clientData, Tcl_Interp *interp,
-			   int argc, TCL_Char **argv);
+			   int objc, Tcl_Obj *CONST objv[]);
 
 int
 TclCommand_addEqualDOF_MP_Mixed (ClientData clientData, Tcl_Interp *interp,
@@ -265,19 +286,19 @@ TclCommand_addMP(ClientData clientData, Tcl_Interp *interp, int argc,
 		 TCL_Char **argv);
 
 int
-TclCommand_addNodalLoad(ClientData clientData, Tcl_Interp *interp, int argc,   
-			TCL_Char **argv);
+TclCommand_addNodalLoad(ClientData clientData, Tcl_Interp *interp, int objc,   
+			Tcl_Obj *CONST objv[]);
 
 int
 TclCommand_addElementalLoad(ClientData clientData, Tcl_Interp *interp, int argc,   
 			    TCL_Char **argv);
 
 int
-TclCommand_addNodalMass(ClientData clientData, Tcl_Interp *interp, int argc,   
-			TCL_Char **argv);
+TclCommand_addNodalMass(ClientData clientData, Tcl_Interp *interp, int objc,   
+			Tcl_Obj *CONST objv[]);
 int
-TclCommand_addSP(ClientData clientData, Tcl_Interp *interp, int argc,   
-		      TCL_Char **argv);
+TclCommand_addSP(ClientData clientData, Tcl_Interp *interp, int objc,   
+		      Tcl_Obj *CONST objv[]);
 
 int
 TclCommand_addImposedMotionSP(ClientData clientData, 
@@ -323,8 +344,8 @@ TclCommand_addRemoLayer(ClientData clientData,
 int
 TclCommand_addRemoFiber(ClientData clientData, 
 			Tcl_Interp *interp, 
-			int argc,    
-			TCL_Char **argv);   
+			int objc,    
+			Tcl_Obj *CONST objv[]);   
 
 
 //Leo
@@ -413,7 +434,7 @@ TclCommand_addPatch (ClientData clientData, Tcl_Interp *interp,
 
 extern int
 TclCommand_addFiber (ClientData clientData, Tcl_Interp *interp,
-		     int argc, TCL_Char **argv,
+		     int objc, Tcl_Obj *CONST objv[],
 		     TclModelBuilder *theTclBuilder);
 
 
@@ -470,10 +491,22 @@ TclModelBuilder::TclModelBuilder(Domain &theDomain, Tcl_Interp *interp, int NDM,
   Tcl_CreateCommand(interp, "updateParameter", TclCommand_addParameter,
 		    (ClientData)NULL, NULL);
 
-  Tcl_CreateCommand(interp, "node", TclCommand_addNode,
+  Tcl_CreateObjCommand(interp, "node", TclCommand_addNode,
+		    (ClientData)NULL, NULL);
+
+  Tcl_CreateObjCommand(interp, "element", TclCommand_addElement,
 		    (ClientData)NULL, NULL);
 
-  Tcl_CreateCommand(interp, "element", TclCommand_addElement,
+  Tcl_CreateObjCommand(interp, "nodes", TclCommand_addNodes,
+		    (ClientData)NULL, NULL);
+
+  Tcl_CreateObjCommand(interp, "elements", TclCommand_addElements,
+		    (ClientData)NULL, NULL);
+
+  Tcl_CreateObjCommand(interp, "fixes", TclCommand_addFixes,
+		    (ClientData)NULL, NULL);
+
+  Tcl_CreateObjCommand(interp, "masses", TclCommand_addMasses,
 		    (ClientData)NULL, NULL);
 
   Tcl_CreateCommand(interp, "PFEM2D", TclCommand_PFEM2D,
@@ -527,16 +560,16 @@ TclModelBuilder::TclModelBuilder(Domain &theDomain, Tcl_Interp *interp, int NDM,
   Tcl_CreateCommand(interp, "timeSeries", TclCommand_addTimeSeries,
 		    (ClientData)NULL, NULL);
 
-  Tcl_CreateCommand(interp, "load", TclCommand_addNodalLoad,
+  Tcl_CreateObjCommand(interp, "load", TclCommand_addNodalLoad,
 		    (ClientData)NULL, NULL);
 
   Tcl_CreateCommand(interp, "eleLoad", TclCommand_addElementalLoad,
 		    (ClientData)NULL, NULL);
 
-  Tcl_CreateCommand(interp, "mass", TclCommand_addNodalMass,
+  Tcl_CreateObjCommand(interp, "mass", TclCommand_addNodalMass,
 		    (ClientData)NULL, NULL);
 
-  Tcl_CreateCommand(interp, "fix", TclCommand_addHomogeneousBC,
+  Tcl_CreateObjCommand(interp, "fix", TclCommand_addHomogeneousBC,
   		    (ClientData)NULL, NULL);
 
   Tcl_CreateCommand(interp, "fixX", TclCommand_addHomogeneousBC_X,
@@ -548,7 +581,7 @@ TclModelBuilder::TclModelBuilder(Domain &theDomain, Tcl_Interp *interp, int NDM,
   Tcl_CreateCommand(interp, "fixZ", TclCommand_addHomogeneousBC_Z,
 		    (ClientData)NULL, NULL);
 
-  Tcl_CreateCommand(interp, "sp", TclCommand_addSP,
+  Tcl_CreateObjCommand(interp, "sp", TclCommand_addSP,
 		    (ClientData)NULL, NULL);
 
   Tcl_CreateCommand(interp, "imposedMotion", 
@@ -563,7 +596,7 @@ TclModelBuilder::TclModelBuilder(Domain &theDomain, Tcl_Interp *interp, int NDM,
 		    TclCommand_addGroundMotion,
 		    (ClientData)NULL, NULL);    
 
-  Tcl_CreateCommand(interp, "equalDOF", TclCommand_addEqualDOF_MP,
+  Tcl_CreateObjCommand(interp, "equalDOF", TclCommand_addEqualDOF_MP,
 		    (ClientData)NULL, NULL);
 
   Tcl_CreateCommand(interp, "equalDOF_Mixed", TclCommand_addEqualDOF_MP_Mixed,
@@ -602,9 +635,12 @@ TclModelBuilder::TclModelBuilder(Domain &theDomain, Tcl_Interp *interp, int NDM,
   Tcl_CreateCommand(interp, "layer", TclCommand_addRemoLayer,
 		    (ClientData)NULL, NULL);    
   
-  Tcl_CreateCommand(interp, "fiber", TclCommand_addRemoFiber,
+  Tcl_CreateObjCommand(interp, "fiber", TclCommand_addRemoFiber,
 		    (ClientData)NULL, NULL);    
 
+  Tcl_CreateObjCommand(interp, "fibers", TclCommand_addFibers,
+		    (ClientData)NULL, NULL);
+
   //LEO
   Tcl_CreateCommand(interp, "Hfiber", TclModelBuilder_addRemoHFiber,
 		    (ClientData)NULL, NULL);
@@ -725,6 +761,10 @@ TclModelBuilder::~TclModelBuilder()
   Tcl_DeleteCommand(theInterp, "updateParameter");
   Tcl_DeleteCommand(theInterp, "node");
   Tcl_DeleteCommand(theInterp, "element");
+  Tcl_DeleteCommand(theInterp, "nodes");
+  Tcl_DeleteCommand(theInterp, "elements");
+  Tcl_DeleteCommand(theInterp, "fixes");
+  Tcl_DeleteCommand(theInterp, "masses");
   Tcl_DeleteCommand(theInterp, "PFEM2D");
   Tcl_DeleteCommand(theInterp, "PFEM3D");
   Tcl_DeleteCommand(theInterp, "mesh");
@@ -754,6 +794,7 @@ TclModelBuilder::~TclModelBuilder()
   Tcl_DeleteCommand(theInterp, "layer");
 
   Tcl_DeleteCommand(theInterp, "fiber");
+  Tcl_DeleteCommand(theInterp, "fibers");
   Tcl_DeleteCommand(theInterp, "Hfiber"); //LEO
   Tcl_DeleteCommand(theInterp, "geomTransf");
   Tcl_DeleteCommand(theInterp, "updateMaterialStage");
@@ -1071,9 +1112,53 @@ void printCommand(int argc, TCL_Char **argv)
   opserr << endln;
 } 
 
+void printCommand(int objc, Tcl_Obj *CONST objv[])
+{
+  opserr << "Input command: ";
+  for (int i=0; i<objc; i++)
+    opserr << Tcl_GetString(objv[i]) << " ";
+  opserr << endln;
+} 
+
+//
+// the argv of an object command, for the commands parsing strings; the
+// OPS_GetIntInput() and OPS_GetDoubleInput() of the commands take the
+// numbers from the objects instead
+//
+
+extern int OPS_SetInputObjects(TCL_Char **argv, Tcl_Obj *CONST *objv);
+
+class TclObjArgv
+{
+ public:
+  TclObjArgv(int objc, Tcl_Obj *CONST objv[])
+    :argv(theArgs)
+  {
+    if (objc >= 64)
+      argv = new TCL_Char *[objc+1];
+    for (int i=0; i<objc; i++)
+      argv[i] = Tcl_GetString(objv[i]);
+    argv[objc] = 0;
+    OPS_SetInputObjects(argv, objv);
+  }
+
+  ~TclObjArgv()
+  {
+    OPS_SetInputObjects(0, 0);
+    if (argv != theArgs)
+      delete [] argv;
+  }
+
+  operator TCL_Char **() {return argv;}
+
+ private:
+  TCL_Char *theArgs[64];
+  TCL_Char **argv;
+};
+
 int
-TclCommand_addNode(ClientData clientData, Tcl_Interp *interp, int argc, 
-                        TCL_Char **argv)
+TclCommand_addNode(ClientData clientData, Tcl_Interp *interp, int objc, 
+                        Tcl_Obj *CONST objv[])
 {
 
   // ensure the destructor has not been called - 
@@ -1086,9 +1171,9 @@ TclCommand_addNode(ClientData clientData, Tcl_Interp *interp, int argc,
   int ndf = theTclBuilder->getNDF();
 
   // make sure corect number of arguments on command line
-  if (argc < 2+ndm) {
+  if (objc < 2+ndm) {
     opserr << "WARNING insufficient arguments\n";
-    printCommand(argc, argv);
+    printCommand(objc, objv);
     opserr << "Want: node nodeTag? [ndm coordinates?] <-mass [ndf values?]>\n";
     return TCL_ERROR;
   }    
@@ -1097,7 +1182,7 @@ TclCommand_addNode(ClientData clientData, Tcl_Interp *interp, int argc,
 
   // get the nodal id
   int nodeId;
-  if (Tcl_GetInt(interp, argv[1], &nodeId) != TCL_OK) {
+  if (Tcl_GetIntFromObj(interp, objv[1], &nodeId) != TCL_OK) {
     opserr << "WARNING invalid nodeTag\n";
     opserr << "Want: node nodeTag? [ndm coordinates?] <-mass [ndf values?]>\n";
     return TCL_ERROR;
@@ -1107,7 +1192,7 @@ TclCommand_addNode(ClientData clientData, Tcl_Interp *interp, int argc,
   double xLoc, yLoc, zLoc;
   if (ndm == 1) { 
     // create a node in 1d space
-    if (Tcl_GetDouble(interp, argv[2], &xLoc) != TCL_OK) {
+    if (Tcl_GetDoubleFromObj(interp, objv[2], &xLoc) != TCL_OK) {
       opserr << "WARNING invalid XCoordinate\n";
       opserr << "node: " << nodeId << endln;
       return TCL_ERROR;
@@ -1117,12 +1202,12 @@ TclCommand_addNode(ClientData clientData, Tcl_Interp *interp, int argc,
 
   else if (ndm == 2) { 
     // create a node in 2d space
-    if (Tcl_GetDouble(interp, argv[2], &xLoc) != TCL_OK) {
+    if (Tcl_GetDoubleFromObj(interp, objv[2], &xLoc) != TCL_OK) {
       opserr << "WARNING invalid XCoordinate\n";
       opserr << "node: " << nodeId << endln;
       return TCL_ERROR;
     }
-    if (Tcl_GetDouble(interp, argv[3], &yLoc) != TCL_OK) {
+    if (Tcl_GetDoubleFromObj(interp, objv[3], &yLoc) != TCL_OK) {
       opserr << "WARNING invalid YCoordinate\n";
       opserr << "node: " << nodeId << endln;
       return TCL_ERROR;
@@ -1132,17 +1217,17 @@ TclCommand_addNode(ClientData clientData, Tcl_Interp *interp, int argc,
 
   else if (ndm == 3) { 
     // create a node in 3d space
-    if (Tcl_GetDouble(interp, argv[2], &xLoc) != TCL_OK) {
+    if (Tcl_GetDoubleFromObj(interp, objv[2], &xLoc) != TCL_OK) {
       opserr << "WARNING invalid XCoordinate\n";
       opserr << "node: " << nodeId << endln;
       return TCL_ERROR;
     }
-    if (Tcl_GetDouble(interp, argv[3], &yLoc) != TCL_OK) {
+    if (Tcl_GetDoubleFromObj(interp, objv[3], &yLoc) != TCL_OK) {
       opserr << "WARNING invalid YCoordinate\n";
       opserr << "node: " << nodeId << endln;
       return TCL_ERROR;
     }
-    if (Tcl_GetDouble(interp, argv[4], &zLoc) != TCL_OK) {
+    if (Tcl_GetDoubleFromObj(interp, objv[4], &zLoc) != TCL_OK) {
       opserr << "WARNING invalid ZCoordinate\n";
       opserr << "node: " << nodeId << endln;
       return TCL_ERROR;
@@ -1156,8 +1241,8 @@ TclCommand_addNode(ClientData clientData, Tcl_Interp *interp, int argc,
 
   // check for -ndf override option
   int currentArg = 2+ndm;  
-  if (currentArg < argc && strcmp(argv[currentArg],"-ndf") == 0) {
-    if (Tcl_GetInt(interp, argv[currentArg+1], &ndf) != TCL_OK) {
+  if (currentArg < objc && strcmp(Tcl_GetString(objv[currentArg]),"-ndf") == 0) {
+    if (Tcl_GetIntFromObj(interp, objv[currentArg+1], &ndf) != TCL_OK) {
       opserr << "WARNING invalid nodal ndf given for node " << nodeId << endln;
       return TCL_ERROR;
     }
@@ -1186,10 +1271,10 @@ TclCommand_addNode(ClientData clientData, Tcl_Interp *interp, int argc,
     return TCL_ERROR;
   }
 
-  while (currentArg < argc) {
-    if (strcmp(argv[currentArg],"-mass") == 0) {
+  while (currentArg < objc) {
+    if (strcmp(Tcl_GetString(objv[currentArg]),"-mass") == 0) {
       currentArg++;
-      if (argc < currentArg+ndf) {
+      if (objc < currentArg+ndf) {
 	opserr << "WARNING incorrect number of nodal mass terms\n";
 	opserr << "node: " << nodeId << endln;
 	return TCL_ERROR;      
@@ -1197,7 +1282,7 @@ TclCommand_addNode(ClientData clientData, Tcl_Interp *interp, int argc,
       Matrix mass(ndf,ndf);
       double theMass;
       for (int i=0; i<ndf; i++) {
-	if (Tcl_GetDouble(interp, argv[currentArg++], &theMass) != TCL_OK) {
+	if (Tcl_GetDoubleFromObj(interp, objv[currentArg++], &theMass) != TCL_OK) {
 	  opserr << "WARNING invalid nodal mass term\n";
 	  opserr << "node: " << nodeId << ", dof: " << i+1 << endln;
 	  return TCL_ERROR;
@@ -1205,9 +1290,9 @@ TclCommand_addNode(ClientData clientData, Tcl_Interp *interp, int argc,
 	mass(i,i) = theMass;
       }
       theNode->setMass(mass);      
-    } else if (strcmp(argv[currentArg],"-dispLoc") == 0) {
+    } else if (strcmp(Tcl_GetString(objv[currentArg]),"-dispLoc") == 0) {
       currentArg++;
-      if (argc < currentArg+ndm) {
+      if (objc < currentArg+ndm) {
 	opserr << "WARNING incorrect number of nodal display location terms, need ndm\n";
 	opserr << "node: " << nodeId << endln;
 	return TCL_ERROR;      
@@ -1215,7 +1300,7 @@ TclCommand_addNode(ClientData clientData, Tcl_Interp *interp, int argc,
       Vector displayLoc(ndm);
       double theCrd;
       for (int i=0; i<ndm; i++) {
-	if (Tcl_GetDouble(interp, argv[currentArg++], &theCrd) != TCL_OK) {
+	if (Tcl_GetDoubleFromObj(interp, objv[currentArg++], &theCrd) != TCL_OK) {
 	  opserr << "WARNING invalid nodal mass term\n";
 	  opserr << "node: " << nodeId << ", dof: " << i+1 << endln;
 	  return TCL_ERROR;
@@ -1224,9 +1309,9 @@ TclCommand_addNode(ClientData clientData, Tcl_Interp *interp, int argc,
       }
       theNode->setDisplayCrds(displayLoc);
 
-    } else if (strcmp(argv[currentArg],"-disp") == 0) {
+    } else if (strcmp(Tcl_GetString(objv[currentArg]),"-disp") == 0) {
       currentArg++;
-      if (argc < currentArg+ndf) {
+      if (objc < currentArg+ndf) {
 	opserr << "WARNING incorrect number of nodal disp terms\n";
 	opserr << "node: " << nodeId << endln;
 	return TCL_ERROR;      
@@ -1234,7 +1319,7 @@ TclCommand_addNode(ClientData clientData, Tcl_Interp *interp, int argc,
       Vector disp(ndf);
       double theDisp;
       for (int i=0; i<ndf; i++) {
-	if (Tcl_GetDouble(interp, argv[currentArg++], &theDisp) != TCL_OK) {
+	if (Tcl_GetDoubleFromObj(interp, objv[currentArg++], &theDisp) != TCL_OK) {
 	  opserr << "WARNING invalid nodal disp term\n";
 	  opserr << "node: " << nodeId << ", dof: " << i+1 << endln;
 	  return TCL_ERROR;
@@ -1244,9 +1329,9 @@ TclCommand_addNode(ClientData clientData, Tcl_Interp *interp, int argc,
       theNode->setTrialDisp(disp);      
       theNode->commitState();
 
-    } else if (strcmp(argv[currentArg],"-vel") == 0) {
+    } else if (strcmp(Tcl_GetString(objv[currentArg]),"-vel") == 0) {
       currentArg++;
-      if (argc < currentArg+ndf) {
+      if (objc < currentArg+ndf) {
 	opserr << "WARNING incorrect number of nodal vel terms\n";
 	opserr << "node: " << nodeId << endln;
 	return TCL_ERROR;      
@@ -1254,7 +1339,7 @@ TclCommand_addNode(ClientData clientData, Tcl_Interp *interp, int argc,
       Vector disp(ndf);
       double theDisp;
       for (int i=0; i<ndf; i++) {
-	if (Tcl_GetDouble(interp, argv[currentArg++], &theDisp) != TCL_OK) {
+	if (Tcl_GetDoubleFromObj(interp, objv[currentArg++], &theDisp) != TCL_OK) {
 	  opserr << "WARNING invalid nodal vel term\n";
 	  opserr << "node: " << nodeId << ", dof: " << i+1 << endln;
 	  return TCL_ERROR;
@@ -1371,11 +1456,322 @@ TclModelBuilderElementCommand(ClientData clientData,
 			      Domain *theDomain, TclModelBuilder *theTclBuilder);
 int
 TclCommand_addElement(ClientData clientData, Tcl_Interp *interp, 
-			   int argc,    TCL_Char **argv)
+			   int objc,    Tcl_Obj *CONST objv[])
                           
 {
+  TclObjArgv argv(objc, objv);
   return TclModelBuilderElementCommand(clientData, interp, 
-				       argc, argv, theTclDomain, theTclBuilder);
+				       objc, argv, theTclDomain, theTclBuilder);
+}
+
+//
+// the bulk commands; the data of all the nodes, elements or fibers is
+// given in lists, or with -binary in byte arrays of native ints and
+// doubles (binary format n* and d*)
+//
+
+static int
+getIntArray(Tcl_Interp *interp, Tcl_Obj *obj, bool binary, ID &data)
+{
+  if (binary == true) {
+    int numBytes = 0;
+    unsigned char *bytes = Tcl_GetByteArrayFromObj(obj, &numBytes);
+    int size = numBytes/sizeof(int);
+    data.resize(size);
+    if (size > 0)
+      memcpy(&data(0), bytes, size*sizeof(int));
+    return 0;
+  }
+
+  int size = 0;
+  Tcl_Obj **objs = 0;
+  if (Tcl_ListObjGetElements(interp, obj, &size, &objs) != TCL_OK)
+    return -1;
+  data.resize(size);
+  for (int i=0; i<size; i++)
+    if (Tcl_GetIntFromObj(interp, objs[i], &data(i)) != TCL_OK)
+      return -1;
+
+  return 0;
+}
+
+static int
+getDoubleArray(Tcl_Interp *interp, Tcl_Obj *obj, bool binary, Vector &data)
+{
+  if (binary == true) {
+    int numBytes = 0;
+    unsigned char *bytes = Tcl_GetByteArrayFromObj(obj, &numBytes);
+    int size = numBytes/sizeof(double);
+    data.resize(size);
+    if (size > 0)
+      memcpy(&data(0), bytes, size*sizeof(double));
+    return 0;
+  }
+
+  int size = 0;
+  Tcl_Obj **objs = 0;
+  if (Tcl_ListObjGetElements(interp, obj, &size, &objs) != TCL_OK)
+    return -1;
+  data.resize(size);
+  for (int i=0; i<size; i++)
+    if (Tcl_GetDoubleFromObj(interp, objs[i], &data(i)) != TCL_OK)
+      return -1;
+
+  return 0;
+}
+
+// the leading -binary option of the bulk commands
+static bool
+getBinaryOption(int &objc, Tcl_Obj *CONST *&objv)
+{
+  if (objc > 1 && strcmp(Tcl_GetString(objv[1]),"-binary") == 0) {
+    objc--;
+    objv++;
+    return true;
+  }
+  return false;
+}
+
+int
+TclCommand_addNodes(ClientData clientData, Tcl_Interp *interp, int objc, 
+		    Tcl_Obj *CONST objv[])
+{
+  if (theTclBuilder == 0) {
+    opserr << "WARNING builder has been destroyed" << endln;
+    return TCL_ERROR;
+  }
+
+  bool binary = getBinaryOption(objc, objv);
+  if (objc < 3) {
+    opserr << "WARNING want: nodes <-binary> nodeTags? crds? <-ndf ndf?>\n";
+    return TCL_ERROR;
+  }
+
+  int ndm = theTclBuilder->getNDM();
+  int ndf = theTclBuilder->getNDF();
+  if (objc > 4 && strcmp(Tcl_GetString(objv[3]),"-ndf") == 0) {
+    if (Tcl_GetIntFromObj(interp, objv[4], &ndf) != TCL_OK) {
+      opserr << "WARNING nodes - invalid ndf\n";
+      return TCL_ERROR;
+    }
+  }
+
+  ID tags(0);
+  Vector crds(0);
+  if (getIntArray(interp, objv[1], binary, tags) != 0 ||
+      getDoubleArray(interp, objv[2], binary, crds) != 0) {
+    opserr << "WARNING nodes - invalid nodeTags or crds\n";
+    return TCL_ERROR;
+  }
+
+  int numNodes = tags.Size();
+  if (crds.Size() != numNodes*ndm) {
+    opserr << "WARNING nodes - " << crds.Size() << " coordinates given for ";
+    opserr << numNodes << " nodes in " << ndm << " dimensions\n";
+    return TCL_ERROR;
+  }
+
+  if (numNodes == 0)
+    return TCL_OK;
+
+  if (BulkModel::addNodes(*theTclDomain, numNodes, &tags(0), ndm, &crds(0), ndf) != 0)
+    return TCL_ERROR;
+
+  return TCL_OK;
+}
+
+int
+TclCommand_addFixes(ClientData clientData, Tcl_Interp *interp, int objc, 
+		    Tcl_Obj *CONST objv[])
+{
+  if (theTclBuilder == 0) {
+    opserr << "WARNING builder has been destroyed" << endln;
+    return TCL_ERROR;
+  }
+
+  bool binary = getBinaryOption(objc, objv);
+  if (objc < 3) {
+    opserr << "WARNING want: fixes <-binary> nodeTags? fixities?\n";
+    return TCL_ERROR;
+  }
+
+  ID tags(0);
+  ID fix(0);
+  if (getIntArray(interp, objv[1], binary, tags) != 0 ||
+      getIntArray(interp, objv[2], binary, fix) != 0) {
+    opserr << "WARNING fixes - invalid nodeTags or fixities\n";
+    return TCL_ERROR;
+  }
+
+  int numNodes = tags.Size();
+  if (numNodes == 0)
+    return TCL_OK;
+
+  int ndf = fix.Size()/numNodes;
+  if (ndf == 0 || fix.Size() != numNodes*ndf) {
+    opserr << "WARNING fixes - number of fixities not a multiple of the number of nodes\n";
+    return TCL_ERROR;
+  }
+
+  if (BulkModel::addFixities(*theTclDomain, numNodes, &tags(0), ndf, &fix(0)) != 0)
+    return TCL_ERROR;
+
+  return TCL_OK;
+}
+
+int
+TclCommand_addMasses(ClientData clientData, Tcl_Interp *interp, int objc, 
+		     Tcl_Obj *CONST objv[])
+{
+  if (theTclBuilder == 0) {
+    opserr << "WARNING builder has been destroyed" << endln;
+    return TCL_ERROR;
+  }
+
+  bool binary = getBinaryOption(objc, objv);
+  if (objc < 3) {
+    opserr << "WARNING want: masses <-binary> nodeTags? masses?\n";
+    return TCL_ERROR;
+  }
+
+  ID tags(0);
+  Vector mass(0);
+  if (getIntArray(interp, objv[1], binary, tags) != 0 ||
+      getDoubleArray(interp, objv[2], binary, mass) != 0) {
+    opserr << "WARNING masses - invalid nodeTags or masses\n";
+    return TCL_ERROR;
+  }
+
+  int numNodes = tags.Size();
+  if (numNodes == 0)
+    return TCL_OK;
+
+  int ndf = mass.Size()/numNodes;
+  if (ndf == 0 || mass.Size() != numNodes*ndf) {
+    opserr << "WARNING masses - number of masses not a multiple of the number of nodes\n";
+    return TCL_ERROR;
+  }
+
+  if (BulkModel::addMasses(*theTclDomain, numNodes, &tags(0), ndf, &mass(0)) != 0)
+    return TCL_ERROR;
+
+  return TCL_OK;
+}
+
+int
+TclCommand_addElements(ClientData clientData, Tcl_Interp *interp, int objc, 
+		       Tcl_Obj *CONST objv[])
+{
+  if (theTclBuilder == 0) {
+    opserr << "WARNING builder has been destroyed" << endln;
+    return TCL_ERROR;
+  }
+
+  bool binary = getBinaryOption(objc, objv);
+  if (objc < 4) {
+    opserr << "WARNING want: elements <-binary> eleType eleTags? connectivity? <args shared by the elements>\n";
+    return TCL_ERROR;
+  }
+
+  ID tags(0);
+  ID nodes(0);
+  if (getIntArray(interp, objv[2], binary, tags) != 0 ||
+      getIntArray(interp, objv[3], binary, nodes) != 0) {
+    opserr << "WARNING elements - invalid eleTags or connectivity\n";
+    return TCL_ERROR;
+  }
+
+  int numEle = tags.Size();
+  if (numEle == 0)
+    return TCL_OK;
+
+  int numNodes = nodes.Size()/numEle;
+  if (numNodes == 0 || nodes.Size() != numEle*numNodes) {
+    opserr << "WARNING elements - connectivity not a multiple of the number of elements\n";
+    return TCL_ERROR;
+  }
+
+  // each element is created by the element command, from the objects
+  // "element eleType tag nodes.. args..". The strings of the shared
+  // arguments are taken once; for each element only the tag and nodes
+  // change, their objects are set to the ints, and as the older parsers
+  // read the strings, these are printed into buffers reused for all the
+  // elements rather than generated by Tcl for each new int
+  int numArgs = objc - 4;
+  int eleObjc = 3 + numNodes + numArgs;
+  Tcl_Obj **eleObjv = new Tcl_Obj *[eleObjc];
+  TCL_Char **eleArgv = new TCL_Char *[eleObjc+1];
+  char *intBuffers = new char[(numNodes+1)*16];
+
+  eleObjv[0] = Tcl_NewStringObj("element", -1);
+  Tcl_IncrRefCount(eleObjv[0]);
+  eleObjv[1] = objv[1];
+  for (int i=0; i<numArgs; i++)
+    eleObjv[3+numNodes+i] = objv[4+i];
+  for (int i=0; i<numNodes+1; i++) {
+    eleObjv[2+i] = Tcl_NewIntObj(0);
+    Tcl_IncrRefCount(eleObjv[2+i]);
+    eleArgv[2+i] = &intBuffers[i*16];
+  }
+  eleArgv[0] = Tcl_GetString(eleObjv[0]);
+  eleArgv[1] = Tcl_GetString(eleObjv[1]);
+  for (int i=0; i<numArgs; i++)
+    eleArgv[3+numNodes+i] = Tcl_GetString(eleObjv[3+numNodes+i]);
+  eleArgv[eleObjc] = 0;
+
+  OPS_SetInputObjects(eleArgv, eleObjv);
+
+  int result = TCL_OK;
+  for (int i=0; i<numEle && result == TCL_OK; i++) {
+    Tcl_SetIntObj(eleObjv[2], tags(i));
+    sprintf(&intBuffers[0], "%d", tags(i));
+    for (int j=0; j<numNodes; j++) {
+      Tcl_SetIntObj(eleObjv[3+j], nodes(i*numNodes+j));
+      sprintf(&intBuffers[(j+1)*16], "%d", nodes(i*numNodes+j));
+    }
+    result = TclModelBuilderElementCommand(clientData, interp, eleObjc, eleArgv,
+					   theTclDomain, theTclBuilder);
+  }
+
+  OPS_SetInputObjects(0, 0);
+
+  for (int i=0; i<numNodes+1; i++)
+    Tcl_DecrRefCount(eleObjv[2+i]);
+  Tcl_DecrRefCount(eleObjv[0]);
+  delete [] intBuffers;
+  delete [] eleArgv;
+  delete [] eleObjv;
+
+  return result;
+}
+
+int
+TclCommand_addFibers(ClientData clientData, Tcl_Interp *interp, int objc, 
+		     Tcl_Obj *CONST objv[])
+{
+  if (objc < 2) {
+    opserr << "WARNING want: fibers {yLoc zLoc area matTag ...}\n";
+    return TCL_ERROR;
+  }
+
+  int size = 0;
+  Tcl_Obj **objs = 0;
+  if (Tcl_ListObjGetElements(interp, objv[1], &size, &objs) != TCL_OK || size%4 != 0) {
+    opserr << "WARNING fibers - want a list of yLoc zLoc area matTag\n";
+    return TCL_ERROR;
+  }
+
+  // each fiber is added by the fiber command
+  Tcl_Obj *fiberObjv[5];
+  fiberObjv[0] = objv[0];
+  for (int i=0; i<size; i+=4) {
+    for (int j=0; j<4; j++)
+      fiberObjv[1+j] = objs[i+j];
+    if (TclCommand_addRemoFiber(clientData, interp, 5, fiberObjv) != TCL_OK)
+      return TCL_ERROR;
+  }
+
+  return TCL_OK;
 }
 
 extern int
@@ -1758,8 +2154,8 @@ TclCommand_addGroundMotion(ClientData clientData, Tcl_Interp *interp,
 
 
 int
-TclCommand_addNodalLoad(ClientData clientData, Tcl_Interp *interp, int argc,
-	TCL_Char **argv)
+TclCommand_addNodalLoad(ClientData clientData, Tcl_Interp *interp, int objc,
+	Tcl_Obj *CONST objv[])
 {
 	// ensure the destructor has not been called - 
 	if (theTclBuilder == 0) {
@@ -1769,7 +2165,7 @@ TclCommand_addNodalLoad(ClientData clientData, Tcl_Interp *interp, int argc,
 
 	//  int ndf = theTclBuilder->getNDF();
 
-	int ndf = argc - 2;
+	int ndf = objc - 2;
 	NodalLoad *theLoad = 0;
 
 	bool isLoadConst = false;
@@ -1778,70 +2174,70 @@ TclCommand_addNodalLoad(ClientData clientData, Tcl_Interp *interp, int argc,
 	//The above definition are moved forward for the use in both cases
 
 	//-------------Adding Proc for NodalThermalAction, By Liming Jiang, [SIF] 2017
-	if ((strcmp(argv[2], "-NodalThermal") == 0) || (strcmp(argv[2], "-nodalThermal") == 0)) {
+	if (objc > 2 && ((strcmp(Tcl_GetString(objv[2]), "-NodalThermal") == 0) || (strcmp(Tcl_GetString(objv[2]), "-nodalThermal") == 0))) {
 
 		int nodeId;
-		if (Tcl_GetInt(interp, argv[1], &nodeId) != TCL_OK) {
-			opserr << "WARNING invalid nodeId: " << argv[1] << endln;
+		if (Tcl_GetIntFromObj(interp, objv[1], &nodeId) != TCL_OK) {
+			opserr << "WARNING invalid nodeId: " << Tcl_GetString(objv[1]) << endln;
 			return TCL_ERROR;
 		}
 
 		Vector* thecrds = new Vector();
 		Node* theNode = theTclDomain->getNode(nodeId);
 		if (theNode == 0) {
-			opserr << "WARNING invalid nodeID: " << argv[1] << endln;
+			opserr << "WARNING invalid nodeID: " << Tcl_GetString(objv[1]) << endln;
 			return TCL_ERROR;
 		}
 		(*thecrds) = theNode->getCrds();
 
 		int count = 3;
-		if (strcmp(argv[count], "-source") == 0) {
+		if (strcmp(Tcl_GetString(objv[count]), "-source") == 0) {
 			count++;
 			const char *pwd = getInterpPWD(interp);
-			simulationInfo.addInputFile(argv[count], pwd);
+			simulationInfo.addInputFile(Tcl_GetString(objv[count]), pwd);
 			TimeSeries* theSeries;
 
 			int dataLen = 9;//default num of temperature input for nodal ThermalAction;
 
-			if (argc - count == 5) {
+			if (objc - count == 5) {
 				//which indicates the nodal thermal action is applied to 3D I section Beam;
 				dataLen = 15;
-				theSeries = new PathTimeSeriesThermal(nodeId, argv[count], dataLen);
+				theSeries = new PathTimeSeriesThermal(nodeId, Tcl_GetString(objv[count]), dataLen);
 				count++;
 				double RcvLoc1, RcvLoc2, RcvLoc3, RcvLoc4;
-				if (Tcl_GetDouble(interp, argv[count], &RcvLoc1) != TCL_OK) {
-					opserr << "WARNING NodalLoad - invalid loc1  " << argv[count] << " for NodalThermalAction\n";
+				if (Tcl_GetDoubleFromObj(interp, objv[count], &RcvLoc1) != TCL_OK) {
+					opserr << "WARNING NodalLoad - invalid loc1  " << Tcl_GetString(objv[count]) << " for NodalThermalAction\n";
 					return TCL_ERROR;
 				}
-				if (Tcl_GetDouble(interp, argv[count + 1], &RcvLoc2) != TCL_OK) {
-					opserr << "WARNING NodalLoad - invalid loc2  " << argv[count + 1] << " for NodalThermalAction\n";
+				if (Tcl_GetDoubleFromObj(interp, objv[count + 1], &RcvLoc2) != TCL_OK) {
+					opserr << "WARNING NodalLoad - invalid loc2  " << Tcl_GetString(objv[count + 1]) << " for NodalThermalAction\n";
 					return TCL_ERROR;
 				}
-				if (Tcl_GetDouble(interp, argv[count + 2], &RcvLoc3) != TCL_OK) {
-					opserr << "WARNING NodalLoad - invalid loc3  " << argv[count + 2] << " for NodalThermalAction\n";
+				if (Tcl_GetDoubleFromObj(interp, objv[count + 2], &RcvLoc3) != TCL_OK) {
+					opserr << "WARNING NodalLoad - invalid loc3  " << Tcl_GetString(objv[count + 2]) << " for NodalThermalAction\n";
 					return TCL_ERROR;
 				}
-				if (Tcl_GetDouble(interp, argv[count + 3], &RcvLoc4) != TCL_OK) {
-					opserr << "WARNING NodalLoad - invalid loc4  " << argv[count + 3] << " for NodalThermalAction\n";
+				if (Tcl_GetDoubleFromObj(interp, objv[count + 3], &RcvLoc4) != TCL_OK) {
+					opserr << "WARNING NodalLoad - invalid loc4  " << Tcl_GetString(objv[count + 3]) << " for NodalThermalAction\n";
 					return TCL_ERROR;
 				}
 				//end of recieving data;
 				theLoad = new NodalThermalAction(nodeLoadTag, nodeId, RcvLoc1, RcvLoc2, RcvLoc3, RcvLoc4, theSeries, thecrds);
 			}
 			//end of for 15 data input;
-			else if (argc - count == 3 || argc - count == 10) {
+			else if (objc - count == 3 || objc - count == 10) {
 
-				theSeries = new PathTimeSeriesThermal(nodeId, argv[count]);
+				theSeries = new PathTimeSeriesThermal(nodeId, Tcl_GetString(objv[count]));
 				count++;
 				Vector locy;
-				if (argc - count == 2) {
+				if (objc - count == 2) {
 					double RcvLoc1, RcvLoc2;
-					if (Tcl_GetDouble(interp, argv[count], &RcvLoc1) != TCL_OK) {
-						opserr << "WARNING NodalLoad - invalid loc1  " << argv[count] << " for NodalThermalAction\n";
+					if (Tcl_GetDoubleFromObj(interp, objv[count], &RcvLoc1) != TCL_OK) {
+						opserr << "WARNING NodalLoad - invalid loc1  " << Tcl_GetString(objv[count]) << " for NodalThermalAction\n";
 						return TCL_ERROR;
 					}
-					if (Tcl_GetDouble(interp, argv[count + 1], &RcvLoc2) != TCL_OK) {
-						opserr << "WARNING NodalLoad - invalid loc2  " << argv[count + 1] << " for NodalThermalAction\n";
+					if (Tcl_GetDoubleFromObj(interp, objv[count + 1], &RcvLoc2) != TCL_OK) {
+						opserr << "WARNING NodalLoad - invalid loc2  " << Tcl_GetString(objv[count + 1]) << " for NodalThermalAction\n";
 						return TCL_ERROR;
 					}
 					locy = Vector(9);
@@ -1851,13 +2247,13 @@ TclCommand_addNodalLoad(ClientData clientData, Tcl_Interp *interp, int argc,
 					locy(7) = (1 * RcvLoc1 + 7 * RcvLoc2) / 8;  locy(8) = RcvLoc2;
 
 				}//end of if only recieving one loc data;
-				else if (argc - count == 9) {
+				else if (objc - count == 9) {
 					double indata[9];
 					double BufferData;
 
 					for (int i = 0; i<9; i++) {
-						if (Tcl_GetDouble(interp, argv[count], &BufferData) != TCL_OK) {
-							opserr << "WARNING eleLoad - invalid data " << argv[count] << " for -beamThermal 3D\n";
+						if (Tcl_GetDoubleFromObj(interp, objv[count], &BufferData) != TCL_OK) {
+							opserr << "WARNING eleLoad - invalid data " << Tcl_GetString(objv[count]) << " for -beamThermal 3D\n";
 							return TCL_ERROR;
 						}
 						indata[i] = BufferData;
@@ -1878,22 +2274,22 @@ TclCommand_addNodalLoad(ClientData clientData, Tcl_Interp *interp, int argc,
 		}
 		//end for detecting source 
 		else {
-			if (argc - count == 4) {
+			if (objc - count == 4) {
 				double t1, t2, locY1, locY2;
-				if (Tcl_GetDouble(interp, argv[count], &t1) != TCL_OK) {
-					opserr << "WARNING eleLoad - invalid T1 " << argv[count] << " for NodalThermalAction\n";
+				if (Tcl_GetDoubleFromObj(interp, objv[count], &t1) != TCL_OK) {
+					opserr << "WARNING eleLoad - invalid T1 " << Tcl_GetString(objv[count]) << " for NodalThermalAction\n";
 					return TCL_ERROR;
 				}
-				if (Tcl_GetDouble(interp, argv[count + 1], &locY1) != TCL_OK) {
-					opserr << "WARNING eleLoad - invalid LocY1 " << argv[count + 1] << " for NodalThermalAction\n";
+				if (Tcl_GetDoubleFromObj(interp, objv[count + 1], &locY1) != TCL_OK) {
+					opserr << "WARNING eleLoad - invalid LocY1 " << Tcl_GetString(objv[count + 1]) << " for NodalThermalAction\n";
 					return TCL_ERROR;
 				}
-				if (Tcl_GetDouble(interp, argv[count + 2], &t2) != TCL_OK) {
-					opserr << "WARNING eleLoad - invalid T1 " << argv[count] << " for NodalThermalAction\n";
+				if (Tcl_GetDoubleFromObj(interp, objv[count + 2], &t2) != TCL_OK) {
+					opserr << "WARNING eleLoad - invalid T1 " << Tcl_GetString(objv[count]) << " for NodalThermalAction\n";
 					return TCL_ERROR;
 				}
-				if (Tcl_GetDouble(interp, argv[count + 3], &locY2) != TCL_OK) {
-					opserr << "WARNING eleLoad - invalid LocY1 " << argv[count + 1] << " for NodalThermalAction\n";
+				if (Tcl_GetDoubleFromObj(interp, objv[count + 3], &locY2) != TCL_OK) {
+					opserr << "WARNING eleLoad - invalid LocY1 " << Tcl_GetString(objv[count + 1]) << " for NodalThermalAction\n";
 					return TCL_ERROR;
 				}
 
@@ -1903,7 +2299,7 @@ TclCommand_addNodalLoad(ClientData clientData, Tcl_Interp *interp, int argc,
 		}
 		//end for source or no source 
 		if (theLoad == 0) {
-			opserr << "WARNING NodalLoad - out of memory creating load " << argv[1];
+			opserr << "WARNING NodalLoad - out of memory creating load " << Tcl_GetString(objv[1]);
 			return TCL_ERROR;
 		}
 		// get the current pattern tag if no tag given in i/p
@@ -1925,16 +2321,16 @@ TclCommand_addNodalLoad(ClientData clientData, Tcl_Interp *interp, int argc,
 	
 
 	// make sure at least one other argument to contain type of system
-	if (argc < (2 + ndf)) {
+	if (objc < (2 + ndf)) {
 		opserr << "WARNING bad command - want: load nodeId " << ndf << " forces\n";
-		printCommand(argc, argv);
+		printCommand(objc, objv);
 		return TCL_ERROR;
 	}
 
 	// get the id of the node
 	int nodeId;
-	if (Tcl_GetInt(interp, argv[1], &nodeId) != TCL_OK) {
-		opserr << "WARNING invalid nodeId: " << argv[1];
+	if (Tcl_GetIntFromObj(interp, objv[1], &nodeId) != TCL_OK) {
+		opserr << "WARNING invalid nodeId: " << Tcl_GetString(objv[1]);
 		opserr << " - load nodeId " << ndf << " forces\n";
 		return TCL_ERROR;
 	}
@@ -1943,7 +2339,7 @@ TclCommand_addNodalLoad(ClientData clientData, Tcl_Interp *interp, int argc,
 	Vector forces(ndf);
 	for (int i = 0; i < ndf; i++) {
 		double theForce;
-		if (Tcl_GetDouble(interp, argv[2 + i], &theForce) != TCL_OK) {
+		if (Tcl_GetDoubleFromObj(interp, objv[2 + i], &theForce) != TCL_OK) {
 			opserr << "WARNING invalid force " << i + 1 << " - load " << nodeId;
 			opserr << " " << ndf << " forces\n";
 			return TCL_ERROR;
@@ -1954,17 +2350,17 @@ TclCommand_addNodalLoad(ClientData clientData, Tcl_Interp *interp, int argc,
 
 	// allow some additional options at end of command
 	int endMarker = 2 + ndf;
-	while (endMarker != argc) {
-		if (strcmp(argv[endMarker], "-const") == 0) {
+	while (endMarker != objc) {
+		if (strcmp(Tcl_GetString(objv[endMarker]), "-const") == 0) {
 			// allow user to specify const load
 			isLoadConst = true;
 		}
-		else if (strcmp(argv[endMarker], "-pattern") == 0) {
+		else if (strcmp(Tcl_GetString(objv[endMarker]), "-pattern") == 0) {
 			// allow user to specify load pattern other than current
 			endMarker++;
 			userSpecifiedPattern = true;
-			if (endMarker == argc ||
-				Tcl_GetInt(interp, argv[endMarker], &loadPatternTag) != TCL_OK) {
+			if (endMarker == objc ||
+				Tcl_GetIntFromObj(interp, objv[endMarker], &loadPatternTag) != TCL_OK) {
 
 				opserr << "WARNING invalid patternTag - load " << nodeId << " ";
 				opserr << ndf << " forces pattern patterntag\n";
@@ -1998,7 +2394,7 @@ TclCommand_addNodalLoad(ClientData clientData, Tcl_Interp *interp, int argc,
   // add the load to the domain
   if (theTclDomain->addNodalLoad(theLoad, loadPatternTag) == false) {
     opserr << "WARNING TclModelBuilder - could not add load to domain\n";
-    printCommand(argc, argv);
+    printCommand(objc, objv);
     delete theLoad;
     return TCL_ERROR;
   }
@@ -3334,8 +3730,8 @@ TclCommand_addElementalLoad(ClientData clientData, Tcl_Interp *interp, int argc,
 
 
 int
-TclCommand_addNodalMass(ClientData clientData, Tcl_Interp *interp, int argc, 
-                        TCL_Char **argv)
+TclCommand_addNodalMass(ClientData clientData, Tcl_Interp *interp, int objc, 
+                        Tcl_Obj *CONST objv[])
 {
   // ensure the destructor has not been called - 
   if (theTclBuilder == 0) {
@@ -3344,19 +3740,19 @@ TclCommand_addNodalMass(ClientData clientData, Tcl_Interp *interp, int argc,
   }
 
   //  int ndf = theTclBuilder->getNDF();
-  int ndf = argc - 2;
+  int ndf = objc - 2;
 
   // make sure at least one other argument to contain type of system
-  if (argc < (2 + ndf)) {
+  if (objc < (2 + ndf)) {
     opserr << "WARNING bad command - want: mass nodeId " << ndf << " mass values\n";
-    printCommand(argc, argv);
+    printCommand(objc, objv);
     return TCL_ERROR;
   }    
 
   // get the id of the node
   int nodeId;
-  if (Tcl_GetInt(interp, argv[1], &nodeId) != TCL_OK) {
-    opserr << "WARNING invalid nodeId: " << argv[1];
+  if (Tcl_GetIntFromObj(interp, objv[1], &nodeId) != TCL_OK) {
+    opserr << "WARNING invalid nodeId: " << Tcl_GetString(objv[1]);
     opserr << " - mass nodeId " << ndf << " forces\n";
     return TCL_ERROR;
   }
@@ -3366,7 +3762,7 @@ TclCommand_addNodalMass(ClientData clientData, Tcl_Interp *interp, int argc,
   double theMass;
   for (int i=0; i<ndf; i++) 
   {
-     if (Tcl_GetDouble(interp, argv[i+2], &theMass) != TCL_OK) 
+     if (Tcl_GetDoubleFromObj(interp, objv[i+2], &theMass) != TCL_OK) 
      {
 	  opserr << "WARNING invalid nodal mass term\n";
 	  opserr << "node: " << nodeId << ", dof: " << i+1 << endln;
@@ -3387,8 +3783,8 @@ TclCommand_addNodalMass(ClientData clientData, Tcl_Interp *interp, int argc,
 
 
 int
-TclCommand_addHomogeneousBC(ClientData clientData, Tcl_Interp *interp, int argc,   
-				 TCL_Char **argv)
+TclCommand_addHomogeneousBC(ClientData clientData, Tcl_Interp *interp, int objc,   
+				 Tcl_Obj *CONST objv[])
 {
   // ensure the destructor has not been called - 
   if (theTclBuilder == 0) {
@@ -3397,18 +3793,18 @@ TclCommand_addHomogeneousBC(ClientData clientData, Tcl_Interp *interp, int argc,
   }
 
   //  int ndf = theTclBuilder->getNDF();
-  int ndf = argc - 2;
+  int ndf = objc - 2;
 
   // check number of arguments
-  if (argc < (2 + ndf)) {
+  if (objc < (2 + ndf)) {
     opserr << "WARNING bad command - want: fix nodeId " << ndf << " [0,1] conditions";
-    printCommand(argc, argv);
+    printCommand(objc, objv);
     return TCL_ERROR;
   }    
 
   // get the id of the node
   int nodeId;
-  if (Tcl_GetInt(interp, argv[1], &nodeId) != TCL_OK) {
+  if (Tcl_GetIntFromObj(interp, objv[1], &nodeId) != TCL_OK) {
       opserr << "WARNING invalid nodeId - fix nodeId " << ndf << " [0,1] conditions\n";
       return TCL_ERROR;
   }
@@ -3418,7 +3814,7 @@ TclCommand_addHomogeneousBC(ClientData clientData, Tcl_Interp *interp, int argc,
   // get the fixity condition and add the constraint if fixed
   for (int i=0; i<ndf; i++) {
     int theFixity;
-    if (Tcl_GetInt(interp, argv[2+i], &theFixity) != TCL_OK) {
+    if (Tcl_GetIntFromObj(interp, objv[2+i], &theFixity) != TCL_OK) {
       opserr << "WARNING invalid fixity " << i+1 << " - load " << nodeId;
       opserr << " " << ndf << " fixities\n";
       return TCL_ERROR;
@@ -3628,8 +4024,8 @@ TclCommand_addHomogeneousBC_Z(ClientData clientData, Tcl_Interp *interp,
 
 
 int
-TclCommand_addSP(ClientData clientData, Tcl_Interp *interp, int argc,   
-		      TCL_Char **argv)
+TclCommand_addSP(ClientData clientData, Tcl_Interp *interp, int objc,   
+		      Tcl_Obj *CONST objv[])
 {
   // ensure the destructor has not been called - 
   if (theTclBuilder == 0) {
@@ -3640,9 +4036,9 @@ TclCommand_addSP(ClientData clientData, Tcl_Interp *interp, int argc,
   //int ndf = theTclBuilder->getNDF();
 
   // check number of arguments
-  if (argc < 4) {
+  if (objc < 4) {
     opserr << "WARNING bad command - want: sp nodeId dofID value";
-    printCommand(argc, argv);
+    printCommand(objc, objv);
     return TCL_ERROR;
   }    
 
@@ -3650,19 +4046,19 @@ TclCommand_addSP(ClientData clientData, Tcl_Interp *interp, int argc,
   int nodeId, dofId;
   double value;
 
-  if (Tcl_GetInt(interp, argv[1], &nodeId) != TCL_OK) {
-    opserr << "WARNING invalid nodeId: " << argv[1] << " -  sp nodeId dofID value\n";
+  if (Tcl_GetIntFromObj(interp, objv[1], &nodeId) != TCL_OK) {
+    opserr << "WARNING invalid nodeId: " << Tcl_GetString(objv[1]) << " -  sp nodeId dofID value\n";
     return TCL_ERROR;
   }
-  if (Tcl_GetInt(interp, argv[2], &dofId) != TCL_OK) {
-    opserr << "WARNING invalid dofId: " << argv[2] << " -  sp ";
+  if (Tcl_GetIntFromObj(interp, objv[2], &dofId) != TCL_OK) {
+    opserr << "WARNING invalid dofId: " << Tcl_GetString(objv[2]) << " -  sp ";
     opserr << nodeId << " dofID value\n";
       return TCL_ERROR;
   }
   dofId--; // DECREMENT THE DOF VALUE BY 1 TO GO TO OUR C++ INDEXING
 
-  if (Tcl_GetDouble(interp, argv[3], &value) != TCL_OK) {
-    opserr << "WARNING invalid value: " << argv[3] << " -  sp ";
+  if (Tcl_GetDoubleFromObj(interp, objv[3], &value) != TCL_OK) {
+    opserr << "WARNING invalid value: " << Tcl_GetString(objv[3]) << " -  sp ";
     opserr << nodeId << " dofID value\n";
       return TCL_ERROR;
   }
@@ -3672,16 +4068,16 @@ TclCommand_addSP(ClientData clientData, Tcl_Interp *interp, int argc,
   int loadPatternTag = 0; // some pattern that will never be used!
 
   int endMarker = 4;
-  while (endMarker != argc) {
-    if (strcmp(argv[endMarker],"-const") == 0) {
+  while (endMarker != objc) {
+    if (strcmp(Tcl_GetString(objv[endMarker]),"-const") == 0) {
       // allow user to specify const load
       isSpConst = true;
-    } else if (strcmp(argv[endMarker],"-pattern") == 0) {
+    } else if (strcmp(Tcl_GetString(objv[endMarker]),"-pattern") == 0) {
       // allow user to specify load pattern other than current
       endMarker++;
       userSpecifiedPattern = true;
-      if (endMarker == argc || 
-	  Tcl_GetInt(interp, argv[endMarker], &loadPatternTag) != TCL_OK) {
+      if (endMarker == objc || 
+	  Tcl_GetIntFromObj(interp, objv[endMarker], &loadPatternTag) != TCL_OK) {
 
 	opserr << "WARNING invalid patternTag - load " << nodeId << "\n";
 	return TCL_ERROR;
@@ -3711,7 +4107,7 @@ TclCommand_addSP(ClientData clientData, Tcl_Interp *interp, int argc,
   }
   if (theTclDomain->addSP_Constraint(theSP, loadPatternTag) == false) {
     opserr << "WARNING could not add SP_Constraint to domain ";
-    printCommand(argc, argv);
+    printCommand(objc, objv);
     delete theSP;
     return TCL_ERROR;
   }
@@ -3818,7 +4214,7 @@ TclCommand_addImposedMotionSP(ClientData clientData,
 
 int
 TclCommand_addEqualDOF_MP (ClientData clientData, Tcl_Interp *interp,
-                                int argc, TCL_Char **argv)
+                                int objc, Tcl_Obj *CONST objv[])
 {
         // Ensure the destructor has not been called
         if (theTclBuilder == 0) {
@@ -3827,28 +4223,28 @@ TclCommand_addEqualDOF_MP (ClientData clientData, Tcl_Interp *interp,
         }
 
         // Check number of arguments
-        if (argc < 4) {
+        if (objc < 4) {
 	  opserr << "WARNING bad command - want: equalDOF RnodeID? CnodeID? DOF1? DOF2? ...";
-	  printCommand (argc, argv);
+	  printCommand(objc, objv);
 	  return TCL_ERROR;
         }
 
         // Read in the node IDs and the DOF
         int RnodeID, CnodeID, dofID;
 
-        if (Tcl_GetInt (interp, argv[1], &RnodeID) != TCL_OK) {
-	  opserr << "WARNING invalid RnodeID: " << argv[1]
+        if (Tcl_GetIntFromObj(interp, objv[1], &RnodeID) != TCL_OK) {
+	  opserr << "WARNING invalid RnodeID: " << Tcl_GetString(objv[1])
 	       << " equalDOF RnodeID? CnodeID? DOF1? DOF2? ...";
 	  return TCL_ERROR;
         }
-        if (Tcl_GetInt (interp, argv[2], &CnodeID) != TCL_OK) {
-	  opserr << "WARNING invalid CnodeID: " << argv[2]
+        if (Tcl_GetIntFromObj(interp, objv[2], &CnodeID) != TCL_OK) {
+	  opserr << "WARNING invalid CnodeID: " << Tcl_GetString(objv[2])
 	       << " equalDOF RnodeID? CnodeID? DOF1? DOF2? ...";
 	  return TCL_ERROR;
         }
 
         // The number of DOF to be coupled
-        int numDOF = argc - 3;
+        int numDOF = objc - 3;
 
         // The constraint matrix ... U_c = C_cr * U_r
         Matrix Ccr (numDOF, numDOF);
@@ -3859,16 +4255,16 @@ TclCommand_addEqualDOF_MP (ClientData clientData, Tcl_Interp *interp,
 
         int i, j;
         // Read the degrees of freedom which are to be coupled
-        for (i = 3, j = 0; i < argc; i++, j++) {
-	  if (Tcl_GetInt (interp, argv[i], &dofID) != TCL_OK) {
-	    opserr << "WARNING invalid dofID: " << argv[3]
+        for (i = 3, j = 0; i < objc; i++, j++) {
+	  if (Tcl_GetIntFromObj(interp, objv[i], &dofID) != TCL_OK) {
+	    opserr << "WARNING invalid dofID: " << Tcl_GetString(objv[3])
 		 << " equalDOF RnodeID? CnodeID? DOF1? DOF2? ...";
 	    return TCL_ERROR;
 	  }
 
 	  dofID -= 1; // Decrement for C++ indexing
 	  if (dofID < 0) {
-	    opserr << "WARNING invalid dofID: " << argv[i]
+	    opserr << "WARNING invalid dofID: " << Tcl_GetString(objv[i])
 		   << " must be >= 1";
 	    return TCL_ERROR;
 	  }
@@ -3880,14 +4276,14 @@ TclCommand_addEqualDOF_MP (ClientData clientData, Tcl_Interp *interp,
         MP_Constraint *theMP = new MP_Constraint (RnodeID, CnodeID, Ccr, rcDOF, rcDOF);
         if (theMP == 0) {
 	  opserr << "WARNING ran out of memory for equalDOF MP_Constraint ";
-	  printCommand (argc, argv);
+	  printCommand(objc, objv);
 	  return TCL_ERROR;
         }
 
         // Add the multi-point constraint to the domain
         if (theTclDomain->addMP_Constraint (theMP) == false) {
 	  opserr << "WARNING could not add equalDOF MP_Constraint to domain ";
-	  printCommand(argc, argv);
+	  printCommand(objc, objv);
 	  delete theMP;
 	  return TCL_ERROR;
         }
@@ -4546,10 +4942,10 @@ TclCommand_addRemoPatch(ClientData clientData, Tcl_Interp *interp, int argc,
 }
 
 int
-TclCommand_addRemoFiber(ClientData clientData, Tcl_Interp *interp, int argc,   
-			   TCL_Char **argv)
+TclCommand_addRemoFiber(ClientData clientData, Tcl_Interp *interp, int objc,   
+			   Tcl_Obj *CONST objv[])
 {
-  return TclCommand_addFiber(clientData, interp, argc,argv,
+  return TclCommand_addFiber(clientData, interp, objc,objv,
 				  theTclBuilder);
 }
 
@@ -57,6 +57,7 @@ class DriftRecorder: public Recorder
   ~DriftRecorder();
 
   int record(int commitTag, double timeStamp);
+  OPS_Stream *getOutputStream(void) {return theOutputHandler;};
   int restart(void);    
 
   int setDomain(Domain &theDomain);
@@ -49,6 +49,10 @@
 #include <DataFileStreamAdd.h>
 #include <XmlFileStream.h>
 #include <BinaryFileStream.h>
+#include <ColumnarBinaryStream.h>
+#include <CompressedStream.h>
+#include <AsyncStream.h>
+#include <StatisticsStream.h>
 #include <DatabaseStream.h>
 #include <TCP_Stream.h>
 
@@ -78,6 +82,8 @@ OPS_ElementRecorder()
     const int DATA_STREAM_CSV = 5;
     const int TCP_STREAM = 6;
     const int DATA_STREAM_ADD = 7;
+    const int COLUMNAR_STREAM = 8;
+    const int COMPRESSED_STREAM = 9;
 
     int eMode = STANDARD_STREAM;
 
@@ -88,6 +94,10 @@ OPS_ElementRecorder()
     int precision = 6;
 
     bool closeOnWrite = false;
+    bool doAsync = false;
+    bool processFiles = false;
+    StatisticsOptions statsOptions;
+    int statsResult = 0;
 
     const char *inetAddr = 0;
     int inetPort;
@@ -123,6 +133,16 @@ OPS_ElementRecorder()
         else if (strcmp(option, "-closeOnWrite") == 0) {
             closeOnWrite = true;
         }
+        else if (strcmp(option, "-async") == 0) {
+            doAsync = true;
+        }
+        else if (strcmp(option, "-perProcess") == 0) {
+            processFiles = true;
+        }
+        else if ((statsResult = statsOptions.parse(option)) != 0) {
+            if (statsResult < 0)
+                return 0;
+        }
         else if (strcmp(option, "-csv") == 0) {
             if (OPS_GetNumRemainingInputArgs() > 0) {
                 filename = OPS_GetString();
@@ -154,6 +174,18 @@ OPS_ElementRecorder()
             }
             eMode = BINARY_STREAM;
         }
+        else if (strcmp(option, "-binaryColumnar") == 0) {
+            if (OPS_GetNumRemainingInputArgs() > 0) {
+                filename = OPS_GetString();
+            }
+            eMode = COLUMNAR_STREAM;
+        }
+        else if (strcmp(option, "-compressed") == 0) {
+            if (OPS_GetNumRemainingInputArgs() > 0) {
+                filename = OPS_GetString();
+            }
+            eMode = COMPRESSED_STREAM;
+        }
         else if (strcmp(option, "-dT") == 0) {
             if (OPS_GetNumRemainingInputArgs() > 0) {
                 int num = 1;
@@ -253,6 +285,13 @@ OPS_ElementRecorder()
     }
     
     // data handler
+#ifdef _PARALLEL_PROCESSING
+    // these streams write the file themselves, they can not be sent
+    if (eMode == COLUMNAR_STREAM || eMode == COMPRESSED_STREAM) {
+        opserr << "WARNING recorder - -binaryColumnar and -compressed output are not available in a parallel run\n";
+        return 0;
+    }
+#endif
     if (eMode == DATA_STREAM && filename != 0)
         theOutputStream = new DataFileStream(filename, OVERWRITE, 2, 0, closeOnWrite, precision, doScientific);
     else if (eMode == DATA_STREAM_ADD && filename != 0)
@@ -265,11 +304,33 @@ OPS_ElementRecorder()
     //    theOutputStream = new DatabaseStream(theDatabase, tableName);
     else if (eMode == BINARY_STREAM && filename != 0)
         theOutputStream = new BinaryFileStream(filename);
+    else if (eMode == COLUMNAR_STREAM && filename != 0)
+        theOutputStream = new ColumnarBinaryStream(filename);
+    else if (eMode == COMPRESSED_STREAM && filename != 0)
+        theOutputStream = new CompressedStream(filename);
     else if (eMode == TCP_STREAM && inetAddr != 0)
         theOutputStream = new TCP_Stream(inetPort, inetAddr);
     else
         theOutputStream = new StandardStream();
 
+    // each process writes its own file, merged with mergeProcessFiles
+    if (processFiles == true) {
+        if (theOutputStream->getClassTag() == OPS_STREAM_TAGS_DataFileStream)
+            ((DataFileStream *)theOutputStream)->setProcessFiles(true);
+        else if (theOutputStream->getClassTag() == OPS_STREAM_TAGS_BinaryFileStream)
+            ((BinaryFileStream *)theOutputStream)->setProcessFiles(true);
+        else
+            opserr << "WARNING -perProcess needs -file, -csv or -binary\n";
+    }
+
+    // keep only running statistics of the output
+    if (statsOptions.on == true)
+        theOutputStream = new StatisticsStream(theOutputStream, statsOptions);
+
+    // format and write the output on the writer thread
+    if (doAsync == true)
+        theOutputStream = new AsyncStream(theOutputStream);
+
     theOutputStream->setPrecision(precision);
 
     Domain* domain = OPS_GetDomain();
@@ -285,7 +346,7 @@ OPS_ElementRecorder()
 
 ElementRecorder::ElementRecorder()
 :Recorder(RECORDER_TAGS_ElementRecorder),
- numEle(0), numDOF(0), eleID(0), dof(0), theResponses(0), 
+ numEle(0), numDOF(0), eleID(0), dof(0), theResponses(0), responseStorage(0),
  theDomain(0), theOutputHandler(0),
  echoTimeFlag(true), deltaT(0), nextTimeStampToRecord(0.0), data(0), 
  initializationDone(false), responseArgs(0), numArgs(0), addColumnInfo(0)
@@ -302,7 +363,7 @@ ElementRecorder::ElementRecorder(const ID *ele,
 				 double dT,
 				 const ID *theDOFs)
 :Recorder(RECORDER_TAGS_ElementRecorder),
- numEle(0), numDOF(0), eleID(0), dof(0), theResponses(0), 
+ numEle(0), numDOF(0), eleID(0), dof(0), theResponses(0), responseStorage(0),
  theDomain(&theDom), theOutputHandler(&theOutputHandler),
  echoTimeFlag(echoTime), deltaT(dT), nextTimeStampToRecord(0.0), data(0),
  initializationDone(false), responseArgs(0), numArgs(0), addColumnInfo(0)
@@ -367,6 +428,9 @@ ElementRecorder::~ElementRecorder()
     delete [] theResponses;
   }
 
+  if (responseStorage != 0)
+    delete [] responseStorage;
+
   if (data != 0)
     delete data;
   
@@ -409,7 +473,24 @@ ElementRecorder::record(int commitTag, double timeStamp)
     // for each element if responses exist, put them in response vector
     //
     for (int i=0; i< numEle; i++) {
-      if (theResponses[i] != 0) {
+      const Vector *storage = responseStorage[i];
+      if (storage != 0) {
+	// copy directly from the element
+	if (numDOF == 0) {
+	  int size = storage->Size();
+	  for (int j=0; j<size; j++)
+	    (*data)(loc++) = (*storage)(j);
+	} else {
+	  int size = storage->Size();
+	  for (int j=0; j<numDOF; j++) {
+	    int index = (*dof)(j);
+	    if (index >= 0 && index < size)
+	      (*data)(loc++) = (*storage)(index);
+	    else
+	      (*data)(loc++) = 0.0;
+	  }
+	}
+      } else if (theResponses[i] != 0) {
 	// ask the element for the reponse
 	int res;
 	if (( res = theResponses[i]->getResponse()) < 0)
@@ -751,6 +832,11 @@ ElementRecorder::initialize(void)
     delete [] theResponses;
   }
 
+  if (responseStorage != 0) {
+    delete [] responseStorage;
+    responseStorage = 0;
+  }
+
   int numDbColumns = 0;
 
   // Set the response objects:
@@ -905,6 +991,22 @@ ElementRecorder::initialize(void)
     numEle = numResponse;
   }
 
+  //
+  // the gather plan: responses whose storage the element keeps current are
+  // copied straight from it each step, the others through getResponse()
+  //
+
+  responseStorage = new const Vector *[numEle];
+  for (i=0; i<numEle; i++) {
+    responseStorage[i] = 0;
+    if (theResponses[i] != 0) {
+      const Vector *storage = theResponses[i]->getResponseStorage();
+      if (storage != 0 &&
+	  storage->Size() == theResponses[i]->getInformation().getData().Size())
+	responseStorage[i] = storage;
+    }
+  }
+
   // create the vector to hold the data
   data = new Vector(numDbColumns);
 
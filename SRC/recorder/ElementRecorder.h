@@ -64,6 +64,7 @@ class ElementRecorder: public Recorder
     ~ElementRecorder();
 
     int record(int commitTag, double timeStamp);
+    OPS_Stream *getOutputStream(void) {return theOutputHandler;};
     int restart(void);    
 
     int setDomain(Domain &theDomain);
@@ -84,6 +85,7 @@ class ElementRecorder: public Recorder
     ID *dof;
 
     Response **theResponses;
+    const Vector **responseStorage; // gather plan, 0 where getResponse() is needed
 
     Domain *theDomain;
     OPS_Stream *theOutputHandler;
@@ -55,6 +55,7 @@ class EnvelopeDriftRecorder: public Recorder
   ~EnvelopeDriftRecorder();
   
   int record(int commitTag, double timeStamp);
+  OPS_Stream *getOutputStream(void) {return theOutputHandler;};
   int restart(void);    
   
   int setDomain(Domain &theDomain);
@@ -59,6 +59,7 @@ class EnvelopeElementRecorder: public Recorder
     ~EnvelopeElementRecorder();
 
     int record(int commitTag, double timeStamp);
+    OPS_Stream *getOutputStream(void) {return theHandler;};
     int restart(void);    
 
     int setDomain(Domain &theDomain);
@@ -64,6 +64,7 @@ class EnvelopeNodeRecorder: public Recorder
     ~EnvelopeNodeRecorder();
 
     int record(int commitTag, double timeStamp);
+    OPS_Stream *getOutputStream(void) {return theHandler;};
     int restart(void);    
 
     int setDomain(Domain &theDomain);
@@ -44,6 +44,10 @@
 #include <DataFileStreamAdd.h>
 #include <XmlFileStream.h>
 #include <BinaryFileStream.h>
+#include <ColumnarBinaryStream.h>
+#include <CompressedStream.h>
+#include <AsyncStream.h>
+#include <StatisticsStream.h>
 #include <DatabaseStream.h>
 #include <TCP_Stream.h>
 
@@ -74,6 +78,8 @@ OPS_NodeRecorder()
     const int DATA_STREAM_CSV = 5;
     const int TCP_STREAM = 6;
     const int DATA_STREAM_ADD = 7;
+    const int COLUMNAR_STREAM = 8;
+    const int COMPRESSED_STREAM = 9;
     
     int eMode = STANDARD_STREAM;
     
@@ -84,6 +90,10 @@ OPS_NodeRecorder()
     int precision = 6;
     
     bool closeOnWrite = false;
+    bool doAsync = false;
+    bool processFiles = false;
+    StatisticsOptions statsOptions;
+    int statsResult = 0;
     
     const char *inetAddr = 0;
     int inetPort;
@@ -125,6 +135,16 @@ OPS_NodeRecorder()
         else if (strcmp(option, "-closeOnWrite") == 0) {
             closeOnWrite = true;
         }
+        else if (strcmp(option, "-async") == 0) {
+            doAsync = true;
+        }
+        else if (strcmp(option, "-perProcess") == 0) {
+            processFiles = true;
+        }
+        else if ((statsResult = statsOptions.parse(option)) != 0) {
+            if (statsResult < 0)
+                return 0;
+        }
         else if (strcmp(option, "-csv") == 0) {
             if (OPS_GetNumRemainingInputArgs() > 0) {
                 filename = OPS_GetString();
@@ -156,6 +176,18 @@ OPS_NodeRecorder()
             }
             eMode = BINARY_STREAM;
         }
+        else if (strcmp(option, "-binaryColumnar") == 0) {
+            if (OPS_GetNumRemainingInputArgs() > 0) {
+                filename = OPS_GetString();
+            }
+            eMode = COLUMNAR_STREAM;
+        }
+        else if (strcmp(option, "-compressed") == 0) {
+            if (OPS_GetNumRemainingInputArgs() > 0) {
+                filename = OPS_GetString();
+            }
+            eMode = COMPRESSED_STREAM;
+        }
         else if (strcmp(option, "-dT") == 0) {
             if (OPS_GetNumRemainingInputArgs() > 0) {
                 int num = 1;
@@ -265,6 +297,13 @@ OPS_NodeRecorder()
     }
     
     // data handler
+#ifdef _PARALLEL_PROCESSING
+    // these streams write the file themselves, they can not be sent
+    if (eMode == COLUMNAR_STREAM || eMode == COMPRESSED_STREAM) {
+        opserr << "WARNING recorder - -binaryColumnar and -compressed output are not available in a parallel run\n";
+        return 0;
+    }
+#endif
     if (eMode == DATA_STREAM && filename != 0)
         theOutputStream = new DataFileStream(filename, OVERWRITE, 2, 0, closeOnWrite, precision, doScientific);
     else if (eMode == DATA_STREAM_ADD && filename != 0)
@@ -277,10 +316,32 @@ OPS_NodeRecorder()
     //    theOutputStream = new DatabaseStream(theDatabase, tableName);
     else if (eMode == BINARY_STREAM && filename != 0)
         theOutputStream = new BinaryFileStream(filename);
+    else if (eMode == COLUMNAR_STREAM && filename != 0)
+        theOutputStream = new ColumnarBinaryStream(filename);
+    else if (eMode == COMPRESSED_STREAM && filename != 0)
+        theOutputStream = new CompressedStream(filename);
     else if (eMode == TCP_STREAM && inetAddr != 0)
         theOutputStream = new TCP_Stream(inetPort, inetAddr);
     else
         theOutputStream = new StandardStream();
+
+    // each process writes its own file, merged with mergeProcessFiles
+    if (processFiles == true) {
+        if (theOutputStream->getClassTag() == OPS_STREAM_TAGS_DataFileStream)
+            ((DataFileStream *)theOutputStream)->setProcessFiles(true);
+        else if (theOutputStream->getClassTag() == OPS_STREAM_TAGS_BinaryFileStream)
+            ((BinaryFileStream *)theOutputStream)->setProcessFiles(true);
+        else
+            opserr << "WARNING -perProcess needs -file, -csv or -binary\n";
+    }
+
+    // keep only running statistics of the output
+    if (statsOptions.on == true)
+        theOutputStream = new StatisticsStream(theOutputStream, statsOptions);
+
+    // format and write the output on the writer thread
+    if (doAsync == true)
+        theOutputStream = new AsyncStream(theOutputStream);
     
     theOutputStream->setPrecision(precision);
     
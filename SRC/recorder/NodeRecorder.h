@@ -62,6 +62,7 @@ class NodeRecorder: public Recorder
     ~NodeRecorder();
 
     int record(int commitTag, double timeStamp);
+    OPS_Stream *getOutputStream(void) {return theOutputHandler;};
 
     int domainChanged(void);    
     int setDomain(Domain &theDomain);
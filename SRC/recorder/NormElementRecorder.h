@@ -64,6 +64,7 @@ class NormElementRecorder: public Recorder
     ~NormElementRecorder();
 
     int record(int commitTag, double timeStamp);
+    OPS_Stream *getOutputStream(void) {return theOutputHandler;};
     int restart(void);    
 
     int setDomain(Domain &theDomain);
@@ -24,6 +24,7 @@
 
 #include "PVDRecorder.h"
 #include <sstream>
+#include <algorithm>
 #include <elementAPI.h>
 #include <OPS_Globals.h>
 #include <Domain.h>
@@ -37,6 +38,14 @@
 #include <NodeIter.h>
 #include <BackgroundMesh.h>
 
+#ifdef _ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef _PARALLEL_INTERPRETERS
+#include <mpi.h>
+#endif
+
 extern BackgroundMesh& OPS_GetBackgroundMesh();
 
 std::map<int,PVDRecorder::VtkType> PVDRecorder::vtktypes;
@@ -58,6 +67,8 @@ void* OPS_PVDRecorder()
     numdata = OPS_GetNumRemainingInputArgs();
     int indent=2;
     int precision = 10;
+    int format = PVDRecorder::ASCII_DATA;
+    bool compress = false;
     PVDRecorder::NodeData nodedata;
     std::vector<PVDRecorder::EleData> eledata;
     while(numdata > 0) {
@@ -94,6 +105,16 @@ void* OPS_PVDRecorder()
 	    }
 	    numdata = 1;
 	    if(OPS_GetIntInput(&numdata,&precision) < 0) return 0;
+	} else if(type=="-binary") {
+	    format = PVDRecorder::BINARY_DATA;
+	} else if(type=="-base64") {
+	    format = PVDRecorder::BASE64_DATA;
+	} else if(type=="-compress") {
+#ifdef _ZLIB
+	    compress = true;
+#else
+	    opserr<<"WARNING: -compress needs OpenSees built with zlib, ignored\n";
+#endif
 	} else if(type=="eleResponse") {
 	    numdata = OPS_GetNumRemainingInputArgs();
 	    if(numdata < 1) {
@@ -111,21 +132,33 @@ void* OPS_PVDRecorder()
 	numdata = OPS_GetNumRemainingInputArgs();
     }
 
+    if (compress && format == PVDRecorder::ASCII_DATA) {
+	format = PVDRecorder::BINARY_DATA;
+    }
+
     // create recorder
-    return new PVDRecorder(name,nodedata,eledata,indent,precision);
+    return new PVDRecorder(name,nodedata,eledata,indent,precision,format,compress);
 }
 
 PVDRecorder::PVDRecorder(const char *name, const NodeData& ndata,
-			 const std::vector<EleData>& edata, int ind, int pre)
+			 const std::vector<EleData>& edata, int ind, int pre,
+			 int fmt, bool comp)
     :Recorder(RECORDER_TAGS_PVDRecorder), indentsize(ind), precision(pre),
      indentlevel(0), filename(name),
      timestep(), timeparts(), theFile(), quota('\"'), parts(),
-     nodedata(ndata), eledata(edata), theDomain(0), partnum()
+     nodedata(ndata), eledata(edata), theDomain(0), partnum(),
+     format(fmt), compress(comp), appended(), pointArrays(), cellArrays(),
+     section(0), domainStamp(-1), allNodes(), geometry(), rank(0), numProcs(1)
 {
+#ifdef _PARALLEL_INTERPRETERS
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &numProcs);
+#endif
 }
 
 PVDRecorder::PVDRecorder()
-    :Recorder(RECORDER_TAGS_PVDRecorder)
+    :Recorder(RECORDER_TAGS_PVDRecorder), format(ASCII_DATA), compress(false),
+     section(0), domainStamp(-1), rank(0), numProcs(1)
 {
 }
 
@@ -146,8 +179,8 @@ PVDRecorder::record(int ctag, double timestamp)
     // save vtu file
     if(vtu() < 0) return -1;
 
-    // save pvd file
-    if(pvd() < 0) return -1;
+    // save pvd file, the first process indexes the files of all
+    if(rank == 0 && pvd() < 0) return -1;
 
     return 0;
 }
@@ -157,6 +190,7 @@ PVDRecorder::restart()
 {
     timestep.clear();
     timeparts.clear();
+    domainStamp = -1;
     return 0;
 }
 
@@ -210,7 +244,7 @@ PVDRecorder::pvd()
 	    theFile<<" group="<<quota<<quota;
 	    theFile<<" part="<<quota<<partno(j)<<quota;
 	    theFile<<" file="<<quota<<filename.c_str()<<'/'<<filename.c_str()<<"_T"<<t<<"_P";
-	    theFile<<partno(j)<<".vtu"<<quota;
+	    theFile<<partno(j)<<(numProcs > 1 ? ".pvtu" : ".vtu")<<quota;
 	    theFile<<"/>\n";
 	}
     }
@@ -249,43 +283,102 @@ PVDRecorder::vtu()
     // get parts
     this->getParts();
 
-    // part 0
-    ID partno(0, (int)parts.size()+2);
+    // parts of all processes, -1 for the particles
+    BackgroundMesh& background = OPS_GetBackgroundMesh();
+    std::vector<int> localParts;
+    if (background.numParticleGroups() > 0) {
+	localParts.push_back(-1);
+    }
+    for(std::map<int,ID>::iterator it=parts.begin(); it!=parts.end(); it++) {
+	localParts.push_back(it->first);
+    }
+    std::map<int,std::vector<int> > owners;
+    this->gatherParts(localParts, owners, nodendf);
+
+    // part 0 holds all nodes, then the particles and a part for each
+    // element type
+    ID partno(0, (int)owners.size()+1);
     partno[0] = 0;
+    std::map<int,int> numbers;
+    for(std::map<int,std::vector<int> >::iterator it=owners.begin(); it!=owners.end(); it++) {
+	int no = partno.Size();
+	partno[no] = no;
+	numbers[it->first] = no;
+    }
+
+    // part 0
     if (this->savePart0(nodendf) < 0) {
 	return -1;
     }
+    if (numProcs > 1 && rank == 0) {
+	std::vector<int> all(numProcs);
+	for (int i=0; i<numProcs; i++) {
+	    all[i] = i;
+	}
+	if (this->writePVTU(0, all) < 0) return -1;
+    }
     
     // particle part
-    BackgroundMesh& background = OPS_GetBackgroundMesh();
     if (background.numParticleGroups() > 0) {
-	partno[1] = 1;
 	if (this->savePartParticle(nodendf) < 0) {
 	    return -1;
 	}
+	if (numProcs > 1 && owners[-1][0] == rank) {
+	    if (this->writePVTU(1, owners[-1]) < 0) return -1;
+	}
     }
 
-    // save other parts
-    // int index = 1;
+    // save other parts, the first process holding a part writes its index
     for(std::map<int,ID>::iterator it=parts.begin(); it!=parts.end(); it++) {
-	// int& no = partnum[it->first];
-	// if (no == 0) {
-	//     no = (int)partnum.size();
-	// }
-	int no = partno.Size();
-	partno[no] = no;
+	int no = numbers[it->first];
 	if(this->savePart(no,it->first,nodendf) < 0) return -1;
+	if (numProcs > 1 && owners[it->first][0] == rank) {
+	    if (this->writePVTU(no, owners[it->first]) < 0) return -1;
+	}
     }
-
     
     timeparts.push_back(partno);
     
-    // clear parts
-    parts.clear();
-    
     return 0;
 }
 
+void
+PVDRecorder::gatherParts(const std::vector<int>& localParts,
+			 std::map<int,std::vector<int> >& owners, int& nodendf)
+{
+#ifdef _PARALLEL_INTERPRETERS
+    if (numProcs > 1) {
+	int numLocal = (int)localParts.size();
+	std::vector<int> counts(numProcs), displs(numProcs);
+	MPI_Allgather(&numLocal, 1, MPI_INT, &counts[0], 1, MPI_INT, MPI_COMM_WORLD);
+	int total = 0;
+	for (int i=0; i<numProcs; i++) {
+	    displs[i] = total;
+	    total += counts[i];
+	}
+	std::vector<int> local(localParts);
+	local.push_back(0);
+	std::vector<int> all(total+1);
+	MPI_Allgatherv(&local[0], numLocal, MPI_INT,
+		       &all[0], &counts[0], &displs[0], MPI_INT, MPI_COMM_WORLD);
+	for (int i=0; i<numProcs; i++) {
+	    for (int j=0; j<counts[i]; j++) {
+		owners[all[displs[i]+j]].push_back(i);
+	    }
+	}
+
+	// same number of components everywhere
+	int maxndf = nodendf;
+	MPI_Allreduce(&nodendf, &maxndf, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+	nodendf = maxndf;
+	return;
+    }
+#endif
+    for (int i=0; i<(int)localParts.size(); i++) {
+	owners[localParts[i]].push_back(rank);
+    }
+}
+
 void
 PVDRecorder::getParts()
 {
@@ -293,6 +386,16 @@ PVDRecorder::getParts()
 	opserr<<"WARNING: setDomain has not been called -- PVDRecorder\n";
 	return;
     }
+
+    // only when the domain has changed
+    int stamp = theDomain->hasDomainChanged();
+    if (stamp == domainStamp) {
+	return;
+    }
+    domainStamp = stamp;
+    parts.clear();
+    geometry.clear();
+    allNodes.clear();
     
     ElementIter* eiter = &(theDomain->getElements());
     Element* theEle = 0;
@@ -301,28 +404,56 @@ PVDRecorder::getParts()
 	int etag = theEle->getTag();
 	parts[ctag].insert(etag);
     }
+
+    // get pressure nodes
+    ID ptags(0,theDomain->getNumPCs());
+    Pressure_ConstraintIter& thePCs = theDomain->getPCs();
+    Pressure_Constraint* thePC = 0;
+    while ((thePC = thePCs()) != 0) {
+	Node* pnode = thePC->getPressureNode();
+	if (pnode != 0) {
+	    ptags.insert(pnode->getTag());
+	}
+    }
+
+    // get all nodes except pressure nodes
+    NodeIter& theNodes = theDomain->getNodes();
+    Node* theNode = 0;
+    while ((theNode = theNodes()) != 0) {
+	int nd = theNode->getTag();
+	if (ptags.getLocationOrdered(nd) < 0) {
+	    allNodes.push_back(theNode);
+	}
+    }
 }
 
-int
-PVDRecorder::savePart0(int nodendf)
+std::string
+PVDRecorder::partName(int partno)
 {
-    if (theDomain == 0) {
-	opserr<<"WARNING: setDomain has not been called -- PVDRecorder\n";
-	return -1;
-    }
-    
     // get time and part
     std::stringstream ss;
     ss.precision(precision);
     ss << std::scientific;
-    ss << 0 << ' ' << timestep.back();
+    ss << partno << ' ' << timestep.back();
     std::string stime, spart;
     ss >> spart >> stime;
-    
+
+    return filename+"_T"+stime+"_P"+spart;
+}
+
+int
+PVDRecorder::openVTU(int partno)
+{
     // open file
     theFile.close();
-    std::string vtuname = filename+'/'+filename+"_T"+stime+"_P"+spart+".vtu";
-    theFile.open(vtuname.c_str(), std::ios::trunc|std::ios::out);
+    std::string vtuname = filename+'/'+this->partName(partno);
+    if (numProcs > 1) {
+	std::stringstream ss;
+	ss << "_R" << rank;
+	vtuname += ss.str();
+    }
+    vtuname += ".vtu";
+    theFile.open(vtuname.c_str(), std::ios::trunc|std::ios::out|std::ios::binary);
     if(theFile.fail()) {
 	opserr<<"WARNING: Failed to open file "<<vtuname.c_str()<<"\n";
 	return -1;
@@ -330,415 +461,475 @@ PVDRecorder::savePart0(int nodendf)
     theFile.precision(precision);
     theFile << std::scientific;
 
+    appended.clear();
+    pointArrays.clear();
+    cellArrays.clear();
+    section = 0;
+
     // header
     theFile<<"<VTKFile type="<<quota<<"UnstructuredGrid"<<quota;
     theFile<<" version="<<quota<<"1.0"<<quota;
     theFile<<" byte_order="<<quota<<"LittleEndian"<<quota;
-    theFile<<" compressor="<<quota<<"vtkZLibDataCompressor"<<quota;
+    if (format != ASCII_DATA) {
+	theFile<<" header_type="<<quota<<"UInt64"<<quota;
+    }
+    if (format == ASCII_DATA || compress) {
+	theFile<<" compressor="<<quota<<"vtkZLibDataCompressor"<<quota;
+    }
     theFile<<">\n";
     this->incrLevel();
     this->indent();
     theFile<<"<UnstructuredGrid>\n";
 
-    // get pressure nodes
-    ID ptags(0,theDomain->getNumPCs());
-    Pressure_ConstraintIter& thePCs = theDomain->getPCs();
-    Pressure_Constraint* thePC = 0;
-    while ((thePC = thePCs()) != 0) {
-	Node* pnode = thePC->getPressureNode();
-	if (pnode != 0) {
-	    ptags.insert(pnode->getTag());
-	}
+    return 0;
+}
+
+int
+PVDRecorder::closeVTU()
+{
+    this->indent();
+    theFile<<"</UnstructuredGrid>\n";
+
+    // the binary data follows the xml
+    if (format != ASCII_DATA) {
+	this->indent();
+	theFile<<"<AppendedData encoding="<<quota;
+	theFile<<(format == BINARY_DATA ? "raw" : "base64")<<quota<<">\n";
+	this->indent();
+	theFile<<'_';
+	theFile.write(appended.data(), appended.size());
+	theFile<<'\n';
+	this->indent();
+	theFile<<"</AppendedData>\n";
+	appended.clear();
     }
 
-    // get all nodes except pressure nodes
-    std::vector<Node*> nodes;
-    NodeIter& theNodes = theDomain->getNodes();
-    Node* theNode = 0;
-    while ((theNode = theNodes()) != 0) {
-	int nd = theNode->getTag();
-	if (ptags.getLocationOrdered(nd) < 0) {
-	    nodes.push_back(theNode);
-	}
+    this->decrLevel();
+    this->indent();
+    theFile<<"</VTKFile>\n";
+
+    theFile.close();
+
+    return 0;
+}
+
+int
+PVDRecorder::writePVTU(int partno, const std::vector<int>& ranks)
+{
+    std::string name = this->partName(partno);
+    std::string pvtuname = filename+'/'+name+".pvtu";
+    std::ofstream file(pvtuname.c_str(), std::ios::trunc|std::ios::out);
+    if(file.fail()) {
+	opserr<<"WARNING: Failed to open file "<<pvtuname.c_str()<<"\n";
+	return -1;
     }
 
-    // Piece
+    file<<"<VTKFile type="<<quota<<"PUnstructuredGrid"<<quota;
+    file<<" version="<<quota<<"1.0"<<quota;
+    file<<" byte_order="<<quota<<"LittleEndian"<<quota;
+    if (format != ASCII_DATA) {
+	file<<" header_type="<<quota<<"UInt64"<<quota;
+    }
+    file<<">\n";
+    file<<"  <PUnstructuredGrid GhostLevel="<<quota<<0<<quota<<">\n";
+    file<<"    <PPoints>\n";
+    file<<"      <PDataArray type="<<quota<<"Float64"<<quota;
+    file<<" NumberOfComponents="<<quota<<3<<quota<<"/>\n";
+    file<<"    </PPoints>\n";
+    file<<"    <PPointData>\n";
+    for (int i=0; i<(int)pointArrays.size(); i++) {
+	file<<"      "<<pointArrays[i]<<"\n";
+    }
+    file<<"    </PPointData>\n";
+    file<<"    <PCellData>\n";
+    for (int i=0; i<(int)cellArrays.size(); i++) {
+	file<<"      "<<cellArrays[i]<<"\n";
+    }
+    file<<"    </PCellData>\n";
+    for (int i=0; i<(int)ranks.size(); i++) {
+	file<<"    <Piece Source="<<quota<<name<<"_R"<<ranks[i]<<".vtu"<<quota<<"/>\n";
+    }
+    file<<"  </PUnstructuredGrid>\n";
+    file<<"</VTKFile>\n";
+
+    file.close();
+
+    return 0;
+}
+
+void
+PVDRecorder::beginPiece(int numPoints, int numCells)
+{
     this->incrLevel();
     this->indent();
-    theFile<<"<Piece NumberOfPoints="<<quota<<(int)nodes.size()<<quota;
-    theFile<<" NumberOfCells="<<quota<<1<<quota<<">\n";
-        
-    // points
+    theFile<<"<Piece NumberOfPoints="<<quota<<numPoints<<quota;
+    theFile<<" NumberOfCells="<<quota<<numCells<<quota<<">\n";
     this->incrLevel();
-    this->indent();
-    theFile<<"<Points>\n";
+}
 
-    // points header
-    this->incrLevel();
+void
+PVDRecorder::endPiece()
+{
+    this->decrLevel();
     this->indent();
-    theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-    theFile<<" Name="<<quota<<"Points"<<quota;
-    theFile<<" NumberOfComponents="<<quota<<3<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
+    theFile<<"</Piece>\n";
+    this->decrLevel();
+}
 
-    // points coordinates
-    this->incrLevel();
-    for(int i=0; i<(int)nodes.size(); i++) {
-	const Vector& crds = nodes[i]->getCrds();
-	this->indent();
-	for(int j=0; j<3; j++) {
-	    if(j < crds.Size()) {
-		theFile<<crds(j)<<' ';
-	    } else {
-		theFile<<0.0<<' ';
-	    }
+static const char base64Chars[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static void
+base64Encode(const unsigned char* data, size_t numBytes, std::string& result)
+{
+    size_t i = 0;
+    for (; i+2 < numBytes; i += 3) {
+	unsigned int n = (data[i] << 16) | (data[i+1] << 8) | data[i+2];
+	result += base64Chars[(n >> 18) & 63];
+	result += base64Chars[(n >> 12) & 63];
+	result += base64Chars[(n >> 6) & 63];
+	result += base64Chars[n & 63];
+    }
+    if (i < numBytes) {
+	unsigned int n = data[i] << 16;
+	if (i+1 < numBytes) {
+	    n |= data[i+1] << 8;
 	}
-	theFile<<std::endl;
+	result += base64Chars[(n >> 18) & 63];
+	result += base64Chars[(n >> 12) & 63];
+	result += (i+1 < numBytes) ? base64Chars[(n >> 6) & 63] : '=';
+	result += '=';
     }
+}
 
-    // points footer
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
-    this->decrLevel();
-    this->indent();
-    theFile<<"</Points>\n";
+void
+PVDRecorder::appendData(const void* data, size_t numBytes)
+{
+    // each array is preceded by its size in bytes, or for compressed data
+    // by the number of blocks, the block sizes and the compressed sizes
+#ifdef _ZLIB
+    if (compress) {
+	uLongf numCompressed = compressBound((uLong)numBytes);
+	std::vector<unsigned char> compressed(numCompressed+1);
+	compress2(&compressed[0], &numCompressed, (const Bytef*)data, (uLong)numBytes,
+		  Z_DEFAULT_COMPRESSION);
+	unsigned long long header[4] = {1, numBytes, numBytes, numCompressed};
+	if (format == BINARY_DATA) {
+	    appended.append((const char*)header, sizeof(header));
+	    appended.append((const char*)&compressed[0], numCompressed);
+	} else {
+	    base64Encode((const unsigned char*)header, sizeof(header), appended);
+	    base64Encode(&compressed[0], numCompressed, appended);
+	}
+	return;
+    }
+#endif
+    unsigned long long header = numBytes;
+    if (format == BINARY_DATA) {
+	appended.append((const char*)&header, sizeof(header));
+	appended.append((const char*)data, numBytes);
+    } else {
+	// header and data are encoded together
+	std::string block((const char*)&header, sizeof(header));
+	block.append((const char*)data, numBytes);
+	base64Encode((const unsigned char*)block.data(), block.size(), appended);
+    }
+}
 
-    // cells
-    this->indent();
-    theFile<<"<Cells>\n";
+void
+PVDRecorder::dataArrayHeader(const char* type, const std::string& name, int ncomp)
+{
+    std::stringstream ss;
+    ss<<"DataArray type="<<quota<<type<<quota;
+    if (name.empty() == false) {
+	ss<<" Name="<<quota<<name<<quota;
+    }
+    if (ncomp > 0) {
+	ss<<" NumberOfComponents="<<quota<<ncomp<<quota;
+    }
+
+    // what a .pvtu file must declare
+    if (section == 1) {
+	pointArrays.push_back("<P"+ss.str()+"/>");
+    } else if (section == 2) {
+	cellArrays.push_back("<P"+ss.str()+"/>");
+    }
 
-    // connectivity
-    this->incrLevel();
     this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"connectivity"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
+    theFile<<'<'<<ss.str();
+    if (format == ASCII_DATA) {
+	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
+    } else {
+	theFile<<" format="<<quota<<"appended"<<quota;
+	theFile<<" offset="<<quota<<appended.size()<<quota<<"/>\n";
+    }
+}
+
+void
+PVDRecorder::writeDataArray(const char* type, const std::string& name, int ncomp,
+			    const std::vector<double>& values, int perLine)
+{
+    this->dataArrayHeader(type, name, ncomp);
+
+    if (format != ASCII_DATA) {
+	this->appendData(values.empty() ? 0 : &values[0], values.size()*sizeof(double));
+	return;
+    }
+
+    if (perLine <= 0) {
+	perLine = (ncomp > 0) ? ncomp : 1;
+    }
     this->incrLevel();
-    for(int i=0; i<(int)nodes.size(); i++) {
+    for(int i=0; i<(int)values.size(); i+=perLine) {
 	this->indent();
-	theFile<<i<<std::endl;
+	for(int j=i; j<i+perLine && j<(int)values.size(); j++) {
+	    theFile<<values[j]<<' ';
+	}
+	theFile<<std::endl;
     }
     this->decrLevel();
     this->indent();
     theFile<<"</DataArray>\n";
+}
 
-    // offsets
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"offsets"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
+void
+PVDRecorder::writeDataArray(const char* type, const std::string& name, int ncomp,
+			    const std::vector<int>& values, int perLine)
+{
+    this->dataArrayHeader(type, name, ncomp);
+
+    if (format != ASCII_DATA) {
+	this->appendData(values.empty() ? 0 : &values[0], values.size()*sizeof(int));
+	return;
+    }
+
+    if (perLine <= 0) {
+	perLine = (ncomp > 0) ? ncomp : 1;
+    }
     this->incrLevel();
-    this->indent();
-    theFile<<(int)nodes.size()<<std::endl;
+    for(int i=0; i<(int)values.size(); i+=perLine) {
+	this->indent();
+	for(int j=i; j<i+perLine && j<(int)values.size(); j++) {
+	    theFile<<values[j]<<' ';
+	}
+	theFile<<std::endl;
+    }
     this->decrLevel();
     this->indent();
     theFile<<"</DataArray>\n";
+}
 
-    // types
+void
+PVDRecorder::writeCells(const std::vector<int>& connectivity, const std::vector<int>& offsets,
+			const std::vector<int>& types, int perLine)
+{
+    // cells
     this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"types"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
+    theFile<<"<Cells>\n";
     this->incrLevel();
-    this->indent();
-    theFile<<VTK_POLY_VERTEX<<std::endl;
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
-
-    // cells footer
+    this->writeDataArray("Int32", "connectivity", 0, connectivity, perLine);
+    this->writeDataArray("Int32", "offsets", 0, offsets);
+    this->writeDataArray("Int32", "types", 0, types);
     this->decrLevel();
     this->indent();
     theFile<<"</Cells>\n";
+}
 
-    // point data
-    this->indent();
-    theFile<<"<PointData>\n";
+// the first ndf components of a vector, 0 past its end
+static void
+addComponents(std::vector<double>& values, const Vector& vec, int ndf)
+{
+    for(int j=0; j<ndf; j++) {
+	values.push_back(j < vec.Size() ? vec(j) : 0.0);
+    }
+}
+
+int
+PVDRecorder::writeNodeData(const std::vector<Node*>& nodes, int nodendf)
+{
+    int numNodes = (int)nodes.size();
+    std::vector<double> values;
+    values.reserve(numNodes*nodendf);
 
     // node tags
-    this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"NodeTag"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    for(int i=0; i<(int)nodes.size(); i++) {
-	this->indent();
-	theFile<<nodes[i]->getTag()<<std::endl;
+    std::vector<int> tags(numNodes);
+    for(int i=0; i<numNodes; i++) {
+	tags[i] = nodes[i]->getTag();
     }
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
+    this->writeDataArray("Int32", "NodeTag", 0, tags);
 
     // node velocity
     if(nodedata.vel) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"Velocity"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)nodes.size(); i++) {
-	    const Vector& vel = nodes[i]->getTrialVel();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
+	values.clear();
+	for(int i=0; i<numNodes; i++) {
+	    addComponents(values, nodes[i]->getTrialVel(), nodendf);
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->writeDataArray("Float64", "Velocity", nodendf, values);
     }
 
     // node displacement
     if(nodedata.disp) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"Displacement"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)nodes.size(); i++) {
-	    const Vector& vel = nodes[i]->getTrialDisp();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
+	values.clear();
+	for(int i=0; i<numNodes; i++) {
+	    addComponents(values, nodes[i]->getTrialDisp(), nodendf);
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->writeDataArray("Float64", "Displacement", nodendf, values);
     }
 
     // node incr displacement
     if(nodedata.incrdisp) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"IncrDisplacement"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)nodes.size(); i++) {
-	    const Vector& vel = nodes[i]->getIncrDisp();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
+	values.clear();
+	for(int i=0; i<numNodes; i++) {
+	    addComponents(values, nodes[i]->getIncrDisp(), nodendf);
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->writeDataArray("Float64", "IncrDisplacement", nodendf, values);
     }
 
     // node acceleration
     if(nodedata.accel) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"Acceleration"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)nodes.size(); i++) {
-	    const Vector& vel = nodes[i]->getTrialAccel();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
+	values.clear();
+	for(int i=0; i<numNodes; i++) {
+	    addComponents(values, nodes[i]->getTrialAccel(), nodendf);
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->writeDataArray("Float64", "Acceleration", nodendf, values);
     }
 
     // node pressure
     if(nodedata.pressure) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"Pressure"<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)nodes.size(); i++) {
+	values.clear();
+	for(int i=0; i<numNodes; i++) {
 	    double pressure = 0.0;
 	    Pressure_Constraint* thePC = theDomain->getPressure_Constraint(nodes[i]->getTag());
 	    if(thePC != 0) {
 		pressure = thePC->getPressure();
 	    }
-	    this->indent();
-	    theFile<<pressure<<std::endl;
+	    values.push_back(pressure);
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->writeDataArray("Float64", "Pressure", 0, values);
     }
 
     // node reaction
     if(nodedata.reaction) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"Reaction"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)nodes.size(); i++) {
-	    const Vector& vel = nodes[i]->getReaction();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
+	values.clear();
+	for(int i=0; i<numNodes; i++) {
+	    addComponents(values, nodes[i]->getReaction(), nodendf);
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->writeDataArray("Float64", "Reaction", nodendf, values);
     }
     
     // node unbalanced load
     if(nodedata.unbalanced) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"UnbalancedLoad"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)nodes.size(); i++) {
-	    const Vector& vel = nodes[i]->getUnbalancedLoad();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
+	values.clear();
+	for(int i=0; i<numNodes; i++) {
+	    addComponents(values, nodes[i]->getUnbalancedLoad(), nodendf);
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->writeDataArray("Float64", "UnbalancedLoad", nodendf, values);
     }
 
     // node mass
     if(nodedata.mass) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"NodeMass"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)nodes.size(); i++) {
+	values.clear();
+	for(int i=0; i<numNodes; i++) {
 	    const Matrix& mat = nodes[i]->getMass();
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
-		if(j < mat.noRows()) {
-		    theFile<<mat(j,j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
+		values.push_back(j < mat.noRows() ? mat(j,j) : 0.0);
 	    }
-	    theFile<<std::endl;
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->writeDataArray("Float64", "NodeMass", nodendf, values);
     }
 
     // node eigen vector
     for(int k=0; k<nodedata.numeigen; k++) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"EigenVector"<<k+1<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)nodes.size(); i++) {
+	values.clear();
+	for(int i=0; i<numNodes; i++) {
 	    const Matrix& eigens = nodes[i]->getEigenvectors();
 	    if(k >= eigens.noCols()) {
 		opserr<<"WARNING: eigenvector "<<k+1<<" is too large\n";
 		return -1;
 	    }
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
-		if(j < eigens.noRows()) {
-		    theFile<<eigens(j,k)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
+		values.push_back(j < eigens.noRows() ? eigens(j,k) : 0.0);
 	    }
-	    theFile<<std::endl;
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	std::stringstream ss;
+	ss << "EigenVector" << k+1;
+	this->writeDataArray("Float64", ss.str(), nodendf, values);
     }
 
-    // point data footer
-    this->decrLevel();
-    this->indent();
-    theFile<<"</PointData>\n";
+    return 0;
+}
 
-    // cell data
-    this->indent();
-    theFile<<"<CellData>\n";
+int
+PVDRecorder::savePart0(int nodendf)
+{
+    if (theDomain == 0) {
+	opserr<<"WARNING: setDomain has not been called -- PVDRecorder\n";
+	return -1;
+    }
+    
+    // open file
+    if (this->openVTU(0) < 0) {
+	return -1;
+    }
 
-    // element tags
-    this->incrLevel();
+    // all nodes except pressure nodes
+    const std::vector<Node*>& nodes = allNodes;
+    int numNodes = (int)nodes.size();
+
+    // Piece
+    this->beginPiece(numNodes, 1);
+        
+    // points
     this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"ElementTag"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
+    theFile<<"<Points>\n";
     this->incrLevel();
-    this->indent();
-    theFile<<0<<std::endl;
+    std::vector<double> points;
+    points.reserve(3*numNodes);
+    for(int i=0; i<numNodes; i++) {
+	addComponents(points, nodes[i]->getCrds(), 3);
+    }
+    this->writeDataArray("Float64", "Points", 3, points);
     this->decrLevel();
     this->indent();
-    theFile<<"</DataArray>\n";
+    theFile<<"</Points>\n";
 
-    // cell data footer
-    this->decrLevel();
-    this->indent();
-    theFile<<"</CellData>\n";
+    // cells
+    std::vector<int> connectivity(numNodes);
+    for(int i=0; i<numNodes; i++) {
+	connectivity[i] = i;
+    }
+    std::vector<int> offsets(1, numNodes);
+    std::vector<int> types(1, VTK_POLY_VERTEX);
+    this->writeCells(connectivity, offsets, types, 1);
 
-    // footer
-    this->decrLevel();
+    // point data
     this->indent();
-    theFile<<"</Piece>\n";
-
+    theFile<<"<PointData>\n";
+    this->incrLevel();
+    section = 1;
+    if (this->writeNodeData(nodes, nodendf) < 0) {
+	return -1;
+    }
     this->decrLevel();
     this->indent();
-    theFile<<"</UnstructuredGrid>\n";
+    theFile<<"</PointData>\n";
 
+    // cell data
+    this->indent();
+    theFile<<"<CellData>\n";
+    this->incrLevel();
+    section = 2;
+    std::vector<int> eletags(1, 0);
+    this->writeDataArray("Int32", "ElementTag", 0, eletags);
     this->decrLevel();
     this->indent();
-    theFile<<"</VTKFile>\n";
+    theFile<<"</CellData>\n";
+    section = 0;
 
-    theFile.close();
+    // footer
+    this->endPiece();
 
-    return 0;
+    return this->closeVTU();
 }
 
 int
@@ -749,34 +940,10 @@ PVDRecorder::savePartParticle(int nodendf)
 	return -1;
     }
     
-    // get time and part
-    std::stringstream ss;
-    ss.precision(precision);
-    ss << std::scientific;
-    ss << 1 << ' ' << timestep.back();
-    std::string stime, spart;
-    ss >> spart >> stime;
-    
     // open file
-    theFile.close();
-    std::string vtuname = filename+'/'+filename+"_T"+stime+"_P"+spart+".vtu";
-    theFile.open(vtuname.c_str(), std::ios::trunc|std::ios::out);
-    if(theFile.fail()) {
-	opserr<<"WARNING: Failed to open file "<<vtuname.c_str()<<"\n";
+    if (this->openVTU(1) < 0) {
 	return -1;
     }
-    theFile.precision(precision);
-    theFile << std::scientific;
-
-    // header
-    theFile<<"<VTKFile type="<<quota<<"UnstructuredGrid"<<quota;
-    theFile<<" version="<<quota<<"1.0"<<quota;
-    theFile<<" byte_order="<<quota<<"LittleEndian"<<quota;
-    theFile<<" compressor="<<quota<<"vtkZLibDataCompressor"<<quota;
-    theFile<<">\n";
-    this->incrLevel();
-    this->indent();
-    theFile<<"<UnstructuredGrid>\n";
 
     // get all particles
     std::vector<Particle*> particles;
@@ -790,299 +957,84 @@ PVDRecorder::savePartParticle(int nodendf)
 	    particles.push_back(p);
 	}
     }
+    int numParticles = (int)particles.size();
 
     // Piece
-    this->incrLevel();
-    this->indent();
-    theFile<<"<Piece NumberOfPoints="<<quota<<(int)particles.size()<<quota;
-    theFile<<" NumberOfCells="<<quota<<1<<quota<<">\n";
+    this->beginPiece(numParticles, 1);
         
     // points
-    this->incrLevel();
     this->indent();
     theFile<<"<Points>\n";
-
-    // points header
     this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-    theFile<<" Name="<<quota<<"Points"<<quota;
-    theFile<<" NumberOfComponents="<<quota<<3<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-
-    // points coordinates
-    this->incrLevel();
-    for(int i=0; i<(int)particles.size(); i++) {
-	const Vector& crds = particles[i]->getCrds();
-	this->indent();
-	for(int j=0; j<3; j++) {
-	    if(j < crds.Size()) {
-		theFile<<crds(j)<<' ';
-	    } else {
-		theFile<<0.0<<' ';
-	    }
-	}
-	theFile<<std::endl;
+    std::vector<double> points;
+    points.reserve(3*numParticles);
+    for(int i=0; i<numParticles; i++) {
+	addComponents(points, particles[i]->getCrds(), 3);
     }
-
-    // points footer
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
+    this->writeDataArray("Float64", "Points", 3, points);
     this->decrLevel();
     this->indent();
     theFile<<"</Points>\n";
 
     // cells
-    this->indent();
-    theFile<<"<Cells>\n";
-
-    // connectivity
-    this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"connectivity"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    for(int i=0; i<(int)particles.size(); i++) {
-	this->indent();
-	theFile<<i<<std::endl;
+    std::vector<int> connectivity(numParticles);
+    for(int i=0; i<numParticles; i++) {
+	connectivity[i] = i;
     }
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
-
-    // offsets
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"offsets"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    this->indent();
-    theFile<<(int)particles.size()<<std::endl;
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
-
-    // types
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"types"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    this->indent();
-    theFile<<VTK_POLY_VERTEX<<std::endl;
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
-
-    // cells footer
-    this->decrLevel();
-    this->indent();
-    theFile<<"</Cells>\n";
+    std::vector<int> offsets(1, numParticles);
+    std::vector<int> types(1, VTK_POLY_VERTEX);
+    this->writeCells(connectivity, offsets, types, 1);
 
     // point data
     this->indent();
     theFile<<"<PointData>\n";
+    this->incrLevel();
+    section = 1;
 
     // node tags
-    this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"NodeTag"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    for(int i=0; i<(int)particles.size(); i++) {
-	this->indent();
-	theFile<<i<<std::endl;
-    }
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
+    this->writeDataArray("Int32", "NodeTag", 0, connectivity);
 
-    // node velocity
+    // particles only have velocity and pressure
+    std::vector<double> values;
+    std::vector<double> zeros(numParticles*nodendf, 0.0);
     if(nodedata.vel) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"Velocity"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)particles.size(); i++) {
-	    const Vector& vel = particles[i]->getVel();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
+	values.clear();
+	for(int i=0; i<numParticles; i++) {
+	    addComponents(values, particles[i]->getVel(), nodendf);
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->writeDataArray("Float64", "Velocity", nodendf, values);
     }
-
-    // node displacement
     if(nodedata.disp) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"Displacement"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)particles.size(); i++) {
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		theFile<<0.0<<' ';
-	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->writeDataArray("Float64", "Displacement", nodendf, zeros);
     }
-
-    // node incr displacement
     if(nodedata.incrdisp) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"IncrDisplacement"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)particles.size(); i++) {
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		theFile<<0.0<<' ';
-	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->writeDataArray("Float64", "IncrDisplacement", nodendf, zeros);
     }
-
-    // node acceleration
     if(nodedata.accel) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"Acceleration"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)particles.size(); i++) {
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		theFile<<0.0<<' ';
-	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->writeDataArray("Float64", "Acceleration", nodendf, zeros);
     }
-
-    // node pressure
     if(nodedata.pressure) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"Pressure"<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)particles.size(); i++) {
-	    double pressure = particles[i]->getPressure();
-	    this->indent();
-	    theFile<<pressure<<std::endl;
+	values.clear();
+	for(int i=0; i<numParticles; i++) {
+	    values.push_back(particles[i]->getPressure());
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->writeDataArray("Float64", "Pressure", 0, values);
     }
-
-    // node reaction
     if(nodedata.reaction) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"Reaction"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)particles.size(); i++) {
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		theFile<<0.0<<' ';
-	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->writeDataArray("Float64", "Reaction", nodendf, zeros);
     }
-    
-    // node unbalanced load
     if(nodedata.unbalanced) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"UnbalancedLoad"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)particles.size(); i++) {
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		theFile<<0.0<<' ';
-	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->writeDataArray("Float64", "UnbalancedLoad", nodendf, zeros);
     }
-
-    // node mass
     if(nodedata.mass) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"NodeMass"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)particles.size(); i++) {
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		theFile<<0.0<<' ';
-	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->writeDataArray("Float64", "NodeMass", nodendf, zeros);
     }
-
-    // node eigen vector
     for(int k=0; k<nodedata.numeigen; k++) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"EigenVector"<<k+1<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<(int)particles.size(); i++) {
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		theFile<<0.0<<' ';
-	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	std::stringstream ss;
+	ss << "EigenVector" << k+1;
+	this->writeDataArray("Float64", ss.str(), nodendf, zeros);
     }
 
-    // point data footer
     this->decrLevel();
     this->indent();
     theFile<<"</PointData>\n";
@@ -1090,41 +1042,19 @@ PVDRecorder::savePartParticle(int nodendf)
     // cell data
     this->indent();
     theFile<<"<CellData>\n";
-
-    // element tags
-    this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"ElementTag"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
     this->incrLevel();
-    this->indent();
-    theFile<<0<<std::endl;
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
-
-    // cell data footer
+    section = 2;
+    std::vector<int> eletags(1, 0);
+    this->writeDataArray("Int32", "ElementTag", 0, eletags);
     this->decrLevel();
     this->indent();
     theFile<<"</CellData>\n";
+    section = 0;
 
     // footer
-    this->decrLevel();
-    this->indent();
-    theFile<<"</Piece>\n";
-
-    this->decrLevel();
-    this->indent();
-    theFile<<"</UnstructuredGrid>\n";
-
-    this->decrLevel();
-    this->indent();
-    theFile<<"</VTKFile>\n";
-
-    theFile.close();
+    this->endPiece();
 
-    return 0;
+    return this->closeVTU();
 }
 
 int
@@ -1134,418 +1064,107 @@ PVDRecorder::savePart(int partno, int ctag, int nodendf)
 	opserr<<"WARNING: setDomain has not been called -- PVDRecorder\n";
 	return -1;
     }
-    
-    // get time and part
-    std::stringstream ss;
-    ss.precision(precision);
-    ss << std::scientific;
-    ss << partno << ' ' << timestep.back();
-    std::string stime, spart;
-    ss >> spart >> stime;
-    
-    // open file
-    theFile.close();
-    std::string vtuname = filename+'/'+filename+"_T"+stime+"_P"+spart+".vtu";
-    theFile.open(vtuname.c_str(), std::ios::trunc|std::ios::out);
-    if(theFile.fail()) {
-	opserr<<"WARNING: Failed to open file "<<vtuname.c_str()<<"\n";
+
+    int type = vtktypes[ctag];
+    if (type == 0) {
+	opserr<<"WARNING: the element type cannot be assigned a VTK type\n";
 	return -1;
     }
-    theFile.precision(precision);
-    theFile << std::scientific;
-
-    // header
-    theFile<<"<VTKFile type="<<quota<<"UnstructuredGrid"<<quota;
-    theFile<<" version="<<quota<<"1.0"<<quota;
-    theFile<<" byte_order="<<quota<<"LittleEndian"<<quota;
-    theFile<<" compressor="<<quota<<"vtkZLibDataCompressor"<<quota;
-    theFile<<">\n";
-    this->incrLevel();
-    this->indent();
-    theFile<<"<UnstructuredGrid>\n";
 
-    // get nodes
+    // the nodes and connectivity, worked out once after each domain change
     const ID& eletags = parts[ctag];
-    ID ndtags(0,eletags.Size()*3);
-    std::vector<Element*> eles(eletags.Size());
-    int numelenodes = 0;
-    int increlenodes = 1;
-    for(int i=0; i<eletags.Size(); i++) {
-	eles[i] = theDomain->getElement(eletags(i));
-	if (eles[i] == 0) {
-	    opserr<<"WARNING: element "<<eletags(i)<<" is not defined--pvdRecorder\n";
-	    return -1;
+    std::map<int,PartGeometry>::iterator git = geometry.find(ctag);
+    if (git == geometry.end()) {
+	PartGeometry& part = geometry[ctag];
+	part.eles.resize(eletags.Size());
+	part.numelenodes = 0;
+	int increlenodes = 1;
+	for(int i=0; i<eletags.Size(); i++) {
+	    part.eles[i] = theDomain->getElement(eletags(i));
+	    if (part.eles[i] == 0) {
+		opserr<<"WARNING: element "<<eletags(i)<<" is not defined--pvdRecorder\n";
+		geometry.erase(ctag);
+		return -1;
+	    }
+	    const ID& elenodes = part.eles[i]->getExternalNodes();
+	    if(part.numelenodes == 0) {
+		part.numelenodes = elenodes.Size();
+		if(ctag==ELE_TAG_PFEMElement2D||ctag==ELE_TAG_PFEMElement2DCompressible||
+		   ctag==ELE_TAG_PFEMElement2DBubble||ctag==ELE_TAG_PFEMElement2Dmini) {
+		    part.numelenodes = 3;
+		    increlenodes = 2;
+		}
+	    }
+	    for(int j=0; j<part.numelenodes; j++) {
+		part.ndtags.push_back(elenodes(j*increlenodes));
+	    }
 	}
-	const ID& elenodes = eles[i]->getExternalNodes();
-	if(numelenodes == 0) {
-	    numelenodes = elenodes.Size();
-	    if(ctag==ELE_TAG_PFEMElement2D||ctag==ELE_TAG_PFEMElement2DCompressible||
-	       ctag==ELE_TAG_PFEMElement2DBubble||ctag==ELE_TAG_PFEMElement2Dmini) {
-		numelenodes = 3;
-		increlenodes = 2;
+	std::sort(part.ndtags.begin(), part.ndtags.end());
+	part.ndtags.erase(std::unique(part.ndtags.begin(), part.ndtags.end()), part.ndtags.end());
+
+	part.nodes.resize(part.ndtags.size());
+	for(int i=0; i<(int)part.ndtags.size(); i++) {
+	    part.nodes[i] = theDomain->getNode(part.ndtags[i]);
+	    if(part.nodes[i] == 0) {
+		opserr<<"WARNIG: Node "<<part.ndtags[i]<<" is not defined -- pvdRecorder\n";
+		geometry.erase(ctag);
+		return -1;
 	    }
 	}
-	for(int j=0; j<numelenodes; j++) {
-	    ndtags.insert(elenodes(j*increlenodes));
+
+	part.connectivity.reserve(eletags.Size()*part.numelenodes);
+	part.offsets.resize(eletags.Size());
+	for(int i=0; i<eletags.Size(); i++) {
+	    const ID& elenodes = part.eles[i]->getExternalNodes();
+	    for(int j=0; j<part.numelenodes; j++) {
+		int nd = elenodes(j*increlenodes);
+		part.connectivity.push_back((int)(std::lower_bound(part.ndtags.begin(),
+								   part.ndtags.end(), nd)
+						  - part.ndtags.begin()));
+	    }
+	    part.offsets[i] = (i+1)*part.numelenodes;
 	}
+	git = geometry.find(ctag);
+    }
+    const PartGeometry& part = git->second;
+    const std::vector<Element*>& eles = part.eles;
+    const std::vector<Node*>& nodes = part.nodes;
+    int numNodes = (int)nodes.size();
+    
+    // open file
+    if (this->openVTU(partno) < 0) {
+	return -1;
     }
 
     // Piece
-    this->incrLevel();
-    this->indent();
-    theFile<<"<Piece NumberOfPoints="<<quota<<ndtags.Size()<<quota;
-    theFile<<" NumberOfCells="<<quota<<eletags.Size()<<quota<<">\n";
+    this->beginPiece(numNodes, eletags.Size());
         
     // points
-    this->incrLevel();
     this->indent();
     theFile<<"<Points>\n";
-
-    // points header
     this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-    theFile<<" Name="<<quota<<"Points"<<quota;
-    theFile<<" NumberOfComponents="<<quota<<3<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-
-    // points coordinates
-    this->incrLevel();
-    std::vector<Node*> nodes(ndtags.Size());
-    for(int i=0; i<ndtags.Size(); i++) {
-	nodes[i] = theDomain->getNode(ndtags(i));
-	if(nodes[i] == 0) {
-	    opserr<<"WARNIG: Node "<<ndtags(i)<<" is not defined -- pvdRecorder\n";
-	    return -1;
-	}
-	const Vector& crds = nodes[i]->getCrds();
-	this->indent();
-	for(int j=0; j<3; j++) {
-	    if(j < crds.Size()) {
-		theFile<<crds(j)<<' ';
-	    } else {
-		theFile<<0.0<<' ';
-	    }
-	}
-	theFile<<std::endl;
+    std::vector<double> points;
+    points.reserve(3*numNodes);
+    for(int i=0; i<numNodes; i++) {
+	addComponents(points, nodes[i]->getCrds(), 3);
     }
-
-    // points footer
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
+    this->writeDataArray("Float64", "Points", 3, points);
     this->decrLevel();
     this->indent();
     theFile<<"</Points>\n";
 
     // cells
-    this->indent();
-    theFile<<"<Cells>\n";
-
-    // connectivity
-    this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"connectivity"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    for(int i=0; i<eletags.Size(); i++) {
-	const ID& elenodes = eles[i]->getExternalNodes();
-	this->indent();
-	for(int j=0; j<numelenodes; j++) {
-	    theFile<<ndtags.getLocationOrdered(elenodes(j*increlenodes))<<' ';
-	}
-	theFile<<std::endl;
-    }
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
-
-    // offsets
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"offsets"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    int offset = numelenodes;
-    for(int i=0; i<eletags.Size(); i++) {
-	this->indent();
-	theFile<<offset<<std::endl;
-	offset += numelenodes;
-    }
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
-
-    // types
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"types"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    int type = vtktypes[ctag];
-    if (type == 0) {
-	opserr<<"WARNING: the element type cannot be assigned a VTK type\n";
-	return -1;
-    }
-    for(int i=0; i<eletags.Size(); i++) {
-	this->indent();
-	theFile<<type<<std::endl;
-    }
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
-
-    // cells footer
-    this->decrLevel();
-    this->indent();
-    theFile<<"</Cells>\n";
+    std::vector<int> types(eletags.Size(), type);
+    this->writeCells(part.connectivity, part.offsets, types, part.numelenodes);
 
     // point data
     this->indent();
     theFile<<"<PointData>\n";
-
-    // node tags
     this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"NodeTag"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    for(int i=0; i<ndtags.Size(); i++) {
-	this->indent();
-	theFile<<ndtags(i)<<std::endl;
-    }
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
-
-    // node velocity
-    if(nodedata.vel) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"Velocity"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<ndtags.Size(); i++) {
-	    const Vector& vel = nodes[i]->getTrialVel();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
-    }
-
-    // node displacement
-    if(nodedata.disp) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"Displacement"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<ndtags.Size(); i++) {
-	    const Vector& vel = nodes[i]->getTrialDisp();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
-    }
-
-    // node incr displacement
-    if(nodedata.incrdisp) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"IncrDisplacement"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<ndtags.Size(); i++) {
-	    const Vector& vel = nodes[i]->getIncrDisp();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
-    }
-
-    // node acceleration
-    if(nodedata.accel) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"Acceleration"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<ndtags.Size(); i++) {
-	    const Vector& vel = nodes[i]->getTrialAccel();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
-    }
-
-    // node pressure
-    if(nodedata.pressure) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"Pressure"<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<ndtags.Size(); i++) {
-	    double pressure = 0.0;
-	    Pressure_Constraint* thePC = theDomain->getPressure_Constraint(ndtags(i));
-	    if(thePC != 0) {
-		pressure = thePC->getPressure();
-	    }
-	    this->indent();
-	    theFile<<pressure<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
-    }
-
-    // node reaction
-    if(nodedata.reaction) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"Reaction"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<ndtags.Size(); i++) {
-	    const Vector& vel = nodes[i]->getReaction();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
-    }
-    
-    // node unbalanced load
-    if(nodedata.unbalanced) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"UnbalancedLoad"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<ndtags.Size(); i++) {
-	    const Vector& vel = nodes[i]->getUnbalancedLoad();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
-    }
-
-    // node mass
-    if(nodedata.mass) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"NodeMass"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<ndtags.Size(); i++) {
-	    const Matrix& mat = nodes[i]->getMass();
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < mat.noRows()) {
-		    theFile<<mat(j,j)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
-    }
-
-    // node eigen vector
-    for(int k=0; k<nodedata.numeigen; k++) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<"EigenVector"<<k+1<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
-	for(int i=0; i<ndtags.Size(); i++) {
-	    const Matrix& eigens = nodes[i]->getEigenvectors();
-	    if(k >= eigens.noCols()) {
-		opserr<<"WARNING: eigenvector "<<k+1<<" is too large\n";
-		return -1;
-	    }
-	    this->indent();
-	    for(int j=0; j<nodendf; j++) {
-		if(j < eigens.noRows()) {
-		    theFile<<eigens(j,k)<<' ';
-		} else {
-		    theFile<<0.0<<' ';
-		}
-	    }
-	    theFile<<std::endl;
-	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+    section = 1;
+    if (this->writeNodeData(nodes, nodendf) < 0) {
+	return -1;
     }
-
-    // point data footer
     this->decrLevel();
     this->indent();
     theFile<<"</PointData>\n";
@@ -1553,21 +1172,15 @@ PVDRecorder::savePart(int partno, int ctag, int nodendf)
     // cell data
     this->indent();
     theFile<<"<CellData>\n";
+    this->incrLevel();
+    section = 2;
 
     // element tags
-    this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"ElementTag"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
+    std::vector<int> tags(eletags.Size());
     for(int i=0; i<eletags.Size(); i++) {
-	this->indent();
-	theFile<<eletags(i)<<std::endl;
+	tags[i] = eletags(i);
     }
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
+    this->writeDataArray("Int32", "ElementTag", 0, tags);
 
     // element response
     for(int i=0; i<(int)eledata.size(); i++) {
@@ -1587,58 +1200,32 @@ PVDRecorder::savePart(int partno, int ctag, int nodendf)
 	if(eressize == 0) continue;
 
 	// save data
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float64"<<quota;
-	theFile<<" Name="<<quota<<eles[0]->getClassType();
+	std::string name = eles[0]->getClassType();
 	for(int j=0; j<argc; j++) {
-	    theFile<<argv[j];
+	    name += argv[j];
 	}
-	theFile<<quota;
-	theFile<<" NumberOfComponents="<<quota<<eressize<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	std::vector<double> values;
+	values.reserve(eletags.Size()*eressize);
 	for(int j=0; j<eletags.Size(); j++) {
 	    data=theDomain->getElementResponse(eletags(j),&(argv[0]),argc);
 	    if(data==0) {
 		opserr<<"WARNING: can't get response for element "<<eletags(j)<<"\n";
 		return -1;
 	    }
-	    this->indent();
-	    for(int k=0; k<eressize; k++) {
-		if (k>=data->Size()) {
-		    theFile<<0.0<<" ";
-		} else {
-		    theFile<<(*data)(k)<<" ";
-		}
-	    }
-	    theFile<<std::endl;
+	    addComponents(values, *data, eressize);
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->writeDataArray("Float64", name, eressize, values);
     }
 
-    // cell data footer
     this->decrLevel();
     this->indent();
     theFile<<"</CellData>\n";
+    section = 0;
 
     // footer
-    this->decrLevel();
-    this->indent();
-    theFile<<"</Piece>\n";
-
-    this->decrLevel();
-    this->indent();
-    theFile<<"</UnstructuredGrid>\n";
+    this->endPiece();
 
-    this->decrLevel();
-    this->indent();
-    theFile<<"</VTKFile>\n";
-
-    theFile.close();
-
-    return 0;
+    return this->closeVTU();
 }
 
 void
@@ -28,6 +28,11 @@
 //
 // Description: This file contains the class definition for 
 // PVDRecorder. A PVDRecorder is used to store all responses in pvd format.
+// The DataArrays are written as ascii, or as binary appended data either
+// raw or base64 encoded (and zlib compressed if built with _ZLIB). The
+// parts and their connectivity are only worked out again after the domain
+// changes. In a parallel run each process writes its own .vtu files and a
+// .pvtu file indexes the pieces of each part.
 
 
 #include <string>
@@ -51,10 +56,12 @@ public:
 	int numeigen;
     };
     typedef std::vector<std::string> EleData;
+    enum DataFormat {ASCII_DATA=0, BINARY_DATA=1, BASE64_DATA=2};
     
 public:
     PVDRecorder(const char *filename, const NodeData& ndata,
-		const std::vector<EleData>& edata, int ind=2, int pre=10);
+		const std::vector<EleData>& edata, int ind=2, int pre=10,
+		int format=ASCII_DATA, bool compress=false);
     PVDRecorder();
     ~PVDRecorder();
 
@@ -79,6 +86,34 @@ private:
     virtual int savePart(int partno, int ctag, int ndf);
     virtual int savePart0(int ndf);
     virtual int savePartParticle(int ndf);
+
+    // the files and the data arrays
+    std::string partName(int partno);
+    int openVTU(int partno);
+    int closeVTU();
+    int writePVTU(int partno, const std::vector<int>& ranks);
+    void beginPiece(int numPoints, int numCells);
+    void endPiece();
+    void writeDataArray(const char* type, const std::string& name, int numComponents,
+			const std::vector<double>& values, int perLine=0);
+    void writeDataArray(const char* type, const std::string& name, int numComponents,
+			const std::vector<int>& values, int perLine=0);
+    void dataArrayHeader(const char* type, const std::string& name, int numComponents);
+    void appendData(const void* data, size_t numBytes);
+    void writeCells(const std::vector<int>& connectivity, const std::vector<int>& offsets,
+		    const std::vector<int>& types, int perLine);
+    int writeNodeData(const std::vector<Node*>& nodes, int ndf);
+    void gatherParts(const std::vector<int>& localParts,
+		     std::map<int,std::vector<int> >& owners, int& ndf);
+
+    // the nodes & connectivity of a part, kept until the domain changes
+    struct PartGeometry {
+	std::vector<Element*> eles;
+	std::vector<int> ndtags;
+	std::vector<Node*> nodes;
+	std::vector<int> connectivity, offsets;
+	int numelenodes;
+    };
     
 private:
     int indentsize, precision, indentlevel;
@@ -93,6 +128,19 @@ private:
     Domain* theDomain;
     std::map<int,int> partnum;
 
+    int format;
+    bool compress;
+    std::string appended;                 // the appended data of the file
+    std::vector<std::string> pointArrays; // PDataArray declarations
+    std::vector<std::string> cellArrays;
+    int section;                          // 1 in PointData, 2 in CellData
+
+    int domainStamp;
+    std::vector<Node*> allNodes;
+    std::map<int,PartGeometry> geometry;
+
+    int rank, numProcs;
+
 public:
     enum VtkType {
 	VTK_VERTEX=1,VTK_POLY_VERTEX=2,VTK_LINE=3,VTK_POLY_LINE=4,
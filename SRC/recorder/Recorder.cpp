@@ -33,11 +33,14 @@
 
 #include <Recorder.h>
 #include <OPS_Globals.h>
+#include <chrono>
 
 int Recorder::lastRecorderTag(0);
 
 Recorder::Recorder(int classTag)
-  :MovableObject(classTag), TaggedObject(lastRecorderTag)
+  :MovableObject(classTag), TaggedObject(lastRecorderTag),
+   numCalls(0), numSkipped(0), recordTime(0.0), lowPriority(false),
+   decimation(1), numSinceRecord(0)
 {
   lastRecorderTag++;
 }
@@ -47,6 +50,49 @@ Recorder::~Recorder()
 
 }
 
+int
+Recorder::recordTimed(int commitTag, double timeStamp)
+{
+  if (decimation > 1) {
+    numSinceRecord++;
+    if (numSinceRecord < decimation) {
+      numSkipped++;
+      return 0;
+    }
+    numSinceRecord = 0;
+  }
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  int res = this->record(commitTag, timeStamp);
+  recordTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  numCalls++;
+
+  return res;
+}
+
+OPS_Stream *
+Recorder::getOutputStream(void)
+{
+  return 0;
+}
+
+void
+Recorder::resetCost(void)
+{
+  numCalls = 0;
+  numSkipped = 0;
+  recordTime = 0.0;
+}
+
+void
+Recorder::setDecimation(int n)
+{
+  if (n < 1)
+    n = 1;
+  decimation = n;
+  numSinceRecord = 0;
+}
+
 int 
 Recorder::restart(void)
 {
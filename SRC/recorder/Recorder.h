@@ -37,6 +37,7 @@
 // What: "@(#) Recorder.h, revA"
 
 class Domain;
+class OPS_Stream;
 #include <MovableObject.h>
 #include <TaggedObject.h>
 
@@ -48,6 +49,10 @@ class Recorder: public MovableObject, public TaggedObject
     virtual ~Recorder();
 
     virtual int record(int commitTag, double timeStamp) =0;
+
+    // record() timed and counted, skipping all but one in every
+    // decimation calls; this is what the Domain invokes
+    int recordTimed(int commitTag, double timeStamp);
     
     virtual int restart(void);
     virtual int domainChanged(void);
@@ -58,10 +63,28 @@ class Recorder: public MovableObject, public TaggedObject
 
     virtual void Print(OPS_Stream &s, int flag); 
 
+    // cost accounting
+    virtual OPS_Stream *getOutputStream(void);
+    int getNumCalls(void) {return numCalls;};
+    int getNumSkipped(void) {return numSkipped;};
+    double getRecordTime(void) {return recordTime;};
+    void resetCost(void);
+    void setLowPriority(bool onOff) {lowPriority = onOff;};
+    bool isLowPriority(void) {return lowPriority;};
+    void setDecimation(int n);
+    int getDecimation(void) {return decimation;};
+
   protected:
     
   private:	
     static int lastRecorderTag;
+
+    int numCalls;
+    int numSkipped;
+    double recordTime;
+    bool lowPriority;
+    int decimation;
+    int numSinceRecord;
 };
 
 
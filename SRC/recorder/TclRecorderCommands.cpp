@@ -74,6 +74,10 @@ extern void* OPS_MPCORecorder();
  #include <DataFileStreamAdd.h>
  #include <XmlFileStream.h>
  #include <BinaryFileStream.h>
+#include <ColumnarBinaryStream.h>
+#include <CompressedStream.h>
+#include <AsyncStream.h>
+#include <StatisticsStream.h>
  #include <DatabaseStream.h>
  #include <DummyStream.h>
  #include <TCP_Stream.h>
@@ -103,7 +107,7 @@ extern void* OPS_MPCORecorder();
 
  static ExternalRecorderCommand *theExternalRecorderCommands = NULL;
 
-enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BINARY_STREAM, DATA_STREAM_CSV, TCP_STREAM, DATA_STREAM_ADD};
+enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BINARY_STREAM, DATA_STREAM_CSV, TCP_STREAM, DATA_STREAM_ADD, COLUMNAR_STREAM, COMPRESSED_STREAM};
 
 
  #include <EquiSolnAlgo.h>
@@ -165,6 +169,9 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
        const char *inetAddr = 0;
        int inetPort;
        bool closeOnWrite = false;
+       bool doAsync = false;
+       bool processFiles = false;
+       StatisticsOptions statsOptions;
        int writeBufferSize = 0;
        bool doScientific = false;
 
@@ -347,6 +354,26 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
 	   closeOnWrite = true;
 	   loc +=1;
 	 }
+
+	 else if (strcmp(argv[loc],"-async") == 0) {
+	   doAsync = true;
+	   loc +=1;
+	 }
+
+	 else if (strcmp(argv[loc],"-perProcess") == 0) {
+	   processFiles = true;
+	   loc +=1;
+	 }
+
+	 else if (strncmp(argv[loc],"-stats",6) == 0) {
+	   OPS_ResetInputNoBuilder(clientData, interp, loc+1, argc, argv, &theDomain);
+	   int result = statsOptions.parse(argv[loc]);
+	   if (result == 0)
+	     opserr << "WARNING recorder - unknown option " << argv[loc] << endln;
+	   if (result <= 0)
+	     return TCL_ERROR;
+	   loc = argc - OPS_GetNumRemainingInputArgs();
+	 }
      
 	 else if (strcmp(argv[loc],"-buffer") == 0 ||
        strcmp(argv[loc],"-bufferSize") == 0)  {
@@ -413,6 +440,22 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
 	   loc += 2;
 	 }	    
 
+	 else if ((strcmp(argv[loc],"-binaryColumnar") == 0)) {
+	   fileName = argv[loc+1];
+	   const char *pwd = getInterpPWD(interp);
+	   simulationInfo.addOutputFile(fileName, pwd);
+	   eMode = COLUMNAR_STREAM;
+	   loc += 2;
+	 }	    
+
+	 else if ((strcmp(argv[loc],"-compressed") == 0)) {
+	   fileName = argv[loc+1];
+	   const char *pwd = getInterpPWD(interp);
+	   simulationInfo.addOutputFile(fileName, pwd);
+	   eMode = COMPRESSED_STREAM;
+	   loc += 2;
+	 }	    
+
 	 else {
 	   // first unknown string then is assumed to start 
 	   // element response request starts
@@ -434,6 +477,13 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
 
 
        // construct the DataHandler
+#ifdef _PARALLEL_PROCESSING
+       // these streams write the file themselves, they can not be sent
+       if (eMode == COLUMNAR_STREAM || eMode == COMPRESSED_STREAM) {
+	 opserr << "WARNING recorder - -binaryColumnar and -compressed output are not available in a parallel run\n";
+	 return TCL_ERROR;
+       }
+#endif
        if (eMode == DATA_STREAM && fileName != 0) {
 	 theOutputStream = new DataFileStream(fileName, OVERWRITE, 2, 0, closeOnWrite, precision, doScientific);
        } else if (eMode == DATA_STREAM_ADD && fileName != 0) {
@@ -446,11 +496,35 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
 	 theOutputStream = new DatabaseStream(theDatabase, tableName);
        } else if (eMode == BINARY_STREAM && fileName != 0) {
 	 theOutputStream = new BinaryFileStream(fileName);
+       } else if (eMode == COLUMNAR_STREAM && fileName != 0) {
+	 theOutputStream = new ColumnarBinaryStream(fileName);
+       } else if (eMode == COMPRESSED_STREAM && fileName != 0) {
+	 theOutputStream = new CompressedStream(fileName);
        } else if (eMode == TCP_STREAM && inetAddr != 0) {
 	 theOutputStream = new TCP_Stream(inetPort, inetAddr);
        } else 
 	 theOutputStream = new StandardStream();
 
+       // each process writes its own file, merged with mergeProcessFiles
+       if (processFiles == true) {
+	 if (theOutputStream->getClassTag() == OPS_STREAM_TAGS_DataFileStream)
+	   ((DataFileStream *)theOutputStream)->setProcessFiles(true);
+	 else if (theOutputStream->getClassTag() == OPS_STREAM_TAGS_BinaryFileStream)
+	   ((BinaryFileStream *)theOutputStream)->setProcessFiles(true);
+	 else
+	   opserr << "WARNING recorder " << argv[1] << " - -perProcess needs -file, -csv or -binary\n";
+       }
+
+       // keep only running statistics of the output, an envelope is already a summary
+       if (statsOptions.on == true && strncmp(argv[1],"Envelope",8) == 0)
+	 opserr << "WARNING recorder " << argv[1] << " - -stats options ignored\n";
+       else if (statsOptions.on == true)
+	 theOutputStream = new StatisticsStream(theOutputStream, statsOptions);
+
+       // format and write the output on the writer thread
+       if (doAsync == true)
+	 theOutputStream = new AsyncStream(theOutputStream);
+
        theOutputStream->setPrecision(precision);
 
        if (strcmp(argv[1],"Element") == 0) {
@@ -1077,6 +1151,9 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
        int inetPort;
 
        bool closeOnWrite = false;
+       bool doAsync = false;
+       bool processFiles = false;
+       StatisticsOptions statsOptions;
        int writeBufferSize = 0;
 
 
@@ -1120,6 +1197,26 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
 	   pos += 1;
 	 }
 
+	 else if (strcmp(argv[pos],"-async") == 0)  {
+	   doAsync = true;
+	   pos += 1;
+	 }
+
+	 else if (strcmp(argv[pos],"-perProcess") == 0)  {
+	   processFiles = true;
+	   pos += 1;
+	 }
+
+	 else if (strncmp(argv[pos],"-stats",6) == 0) {
+	   OPS_ResetInputNoBuilder(clientData, interp, pos+1, argc, argv, &theDomain);
+	   int result = statsOptions.parse(argv[pos]);
+	   if (result == 0)
+	     opserr << "WARNING recorder - unknown option " << argv[pos] << endln;
+	   if (result <= 0)
+	     return TCL_ERROR;
+	   pos = argc - OPS_GetNumRemainingInputArgs();
+	 }
+
 	 else if (strcmp(argv[pos],"-buffer") == 0 ||
        strcmp(argv[pos],"-bufferSize") == 0)  {
        pos++;
@@ -1176,6 +1273,22 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
 	   pos += 2;
 	 }	    
 
+	 else if ((strcmp(argv[pos],"-binaryColumnar") == 0)) {
+	   fileName = argv[pos+1];
+	   const char *pwd = getInterpPWD(interp);
+	   simulationInfo.addOutputFile(fileName, pwd);
+	   eMode = COLUMNAR_STREAM;
+	   pos += 2;
+	 }	    
+
+	 else if ((strcmp(argv[pos],"-compressed") == 0)) {
+	   fileName = argv[pos+1];
+	   const char *pwd = getInterpPWD(interp);
+	   simulationInfo.addOutputFile(fileName, pwd);
+	   eMode = COMPRESSED_STREAM;
+	   pos += 2;
+	 }	    
+
 
 	 else if (strcmp(argv[pos],"-dT") == 0) {
 	   pos ++;
@@ -1338,6 +1451,13 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
 
 
        // construct the DataHandler
+#ifdef _PARALLEL_PROCESSING
+       // these streams write the file themselves, they can not be sent
+       if (eMode == COLUMNAR_STREAM || eMode == COMPRESSED_STREAM) {
+	 opserr << "WARNING recorder - -binaryColumnar and -compressed output are not available in a parallel run\n";
+	 return TCL_ERROR;
+       }
+#endif
        if (eMode == DATA_STREAM && fileName != 0) {
 	 theOutputStream = new DataFileStream(fileName, OVERWRITE, 2, 0, closeOnWrite, precision, doScientific);
        } else if (eMode == DATA_STREAM_ADD && fileName != 0) {
@@ -1350,12 +1470,36 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
 	 theOutputStream = new DatabaseStream(theDatabase, tableName);
        } else if (eMode == BINARY_STREAM && fileName != 0) {
 	 theOutputStream = new BinaryFileStream(fileName);
+       } else if (eMode == COLUMNAR_STREAM && fileName != 0) {
+	 theOutputStream = new ColumnarBinaryStream(fileName);
+       } else if (eMode == COMPRESSED_STREAM && fileName != 0) {
+	 theOutputStream = new CompressedStream(fileName);
        } else if (eMode == TCP_STREAM && inetAddr != 0) {
 	 theOutputStream = new TCP_Stream(inetPort, inetAddr);
        } else {
 	 theOutputStream = new StandardStream();
        }
 
+       // each process writes its own file, merged with mergeProcessFiles
+       if (processFiles == true) {
+	 if (theOutputStream->getClassTag() == OPS_STREAM_TAGS_DataFileStream)
+	   ((DataFileStream *)theOutputStream)->setProcessFiles(true);
+	 else if (theOutputStream->getClassTag() == OPS_STREAM_TAGS_BinaryFileStream)
+	   ((BinaryFileStream *)theOutputStream)->setProcessFiles(true);
+	 else
+	   opserr << "WARNING recorder " << argv[1] << " - -perProcess needs -file, -csv or -binary\n";
+       }
+
+       // keep only running statistics of the output, an envelope is already a summary
+       if (statsOptions.on == true && strncmp(argv[1],"Envelope",8) == 0)
+	 opserr << "WARNING recorder " << argv[1] << " - -stats options ignored\n";
+       else if (statsOptions.on == true)
+	 theOutputStream = new StatisticsStream(theOutputStream, statsOptions);
+
+       // format and write the output on the writer thread
+       if (doAsync == true)
+	 theOutputStream = new AsyncStream(theOutputStream);
+
        theOutputStream->setPrecision(precision);
 
        if (theTimeSeries != 0 && theTimeSeriesID.Size() < theDofs.Size()) {
@@ -1434,6 +1578,9 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
        int precision = 6;
        bool doScientific = false;
        bool closeOnWrite = false;
+       bool doAsync = false;
+       bool processFiles = false;
+       StatisticsOptions statsOptions;
 
        while (pos < argc) {
 
@@ -1482,6 +1629,22 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
 	   pos += 2;
 	 }	    
 
+	 else if ((strcmp(argv[pos],"-binaryColumnar") == 0)) {
+	   fileName = argv[pos+1];
+	   const char *pwd = getInterpPWD(interp);
+	   simulationInfo.addOutputFile(fileName, pwd);
+	   eMode = COLUMNAR_STREAM;
+	   pos += 2;
+	 }	    
+
+	 else if ((strcmp(argv[pos],"-compressed") == 0)) {
+	   fileName = argv[pos+1];
+	   const char *pwd = getInterpPWD(interp);
+	   simulationInfo.addOutputFile(fileName, pwd);
+	   eMode = COMPRESSED_STREAM;
+	   pos += 2;
+	 }	    
+
 	 else if ((strcmp(argv[pos],"-nees") == 0) || (strcmp(argv[pos],"-xml") == 0)) {
 	   // allow user to specify load pattern other than current
 	   fileName = argv[pos+1];
@@ -1496,6 +1659,26 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
 	   pos ++;
 	 }
 
+	 else if (strcmp(argv[pos],"-async") == 0) {
+	   doAsync = true;
+	   pos ++;
+	 }
+
+	 else if (strcmp(argv[pos],"-perProcess") == 0) {
+	   processFiles = true;
+	   pos ++;
+	 }
+
+	 else if (strncmp(argv[pos],"-stats",6) == 0) {
+	   OPS_ResetInputNoBuilder(clientData, interp, pos+1, argc, argv, &theDomain);
+	   int result = statsOptions.parse(argv[pos]);
+	   if (result == 0)
+	     opserr << "WARNING recorder - unknown option " << argv[pos] << endln;
+	   if (result <= 0)
+	     return TCL_ERROR;
+	   pos = argc - OPS_GetNumRemainingInputArgs();
+	 }
+
 	 else if (strcmp(argv[pos],"-scientific") == 0) {
 	   doScientific = true;
 	   pos ++;
@@ -1579,6 +1762,13 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
 
 
        // construct the DataHandler
+#ifdef _PARALLEL_PROCESSING
+       // these streams write the file themselves, they can not be sent
+       if (eMode == COLUMNAR_STREAM || eMode == COMPRESSED_STREAM) {
+	 opserr << "WARNING recorder - -binaryColumnar and -compressed output are not available in a parallel run\n";
+	 return TCL_ERROR;
+       }
+#endif
        if (eMode == DATA_STREAM && fileName != 0) {
 	 theOutputStream = new DataFileStream(fileName, OVERWRITE, 2, 0, closeOnWrite, precision, doScientific);
        } else if (eMode == DATA_STREAM_CSV && fileName != 0) {
@@ -1589,9 +1779,33 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
 	 theOutputStream = new DatabaseStream(theDatabase, tableName);
        } else if (eMode == BINARY_STREAM) {
 	 theOutputStream = new BinaryFileStream(fileName);
+       } else if (eMode == COLUMNAR_STREAM) {
+	 theOutputStream = new ColumnarBinaryStream(fileName);
+       } else if (eMode == COMPRESSED_STREAM) {
+	 theOutputStream = new CompressedStream(fileName);
        } else
 	 theOutputStream = new StandardStream();
 
+       // each process writes its own file, merged with mergeProcessFiles
+       if (processFiles == true) {
+	 if (theOutputStream->getClassTag() == OPS_STREAM_TAGS_DataFileStream)
+	   ((DataFileStream *)theOutputStream)->setProcessFiles(true);
+	 else if (theOutputStream->getClassTag() == OPS_STREAM_TAGS_BinaryFileStream)
+	   ((BinaryFileStream *)theOutputStream)->setProcessFiles(true);
+	 else
+	   opserr << "WARNING recorder " << argv[1] << " - -perProcess needs -file, -csv or -binary\n";
+       }
+
+       // keep only running statistics of the output, an envelope is already a summary
+       if (statsOptions.on == true && strncmp(argv[1],"Envelope",8) == 0)
+	 opserr << "WARNING recorder " << argv[1] << " - -stats options ignored\n";
+       else if (statsOptions.on == true)
+	 theOutputStream = new StatisticsStream(theOutputStream, statsOptions);
+
+       // format and write the output on the writer thread
+       if (doAsync == true)
+	 theOutputStream = new AsyncStream(theOutputStream);
+
        // Subtract one from dof and perpDirn for C indexing
        if (strcmp(argv[1],"Drift") == 0) 
 	 (*theRecorder) = new DriftRecorder(iNodes, jNodes, dof-1, perpDirn-1,
@@ -88,3 +88,9 @@ ElementResponse::getResponseSensitivity(int gradNumber)
 {
   return theElement->getResponseSensitivity(responseID, gradNumber, myInfo);
 }
+
+const Vector *
+ElementResponse::getResponseStorage(void)
+{
+  return theElement->getResponseStorage(responseID);
+}
@@ -54,6 +54,7 @@ public:
 
 	int getResponse(void);
 	int getResponseSensitivity(int gradNumber);
+	const Vector *getResponseStorage(void);
 
 private:
 	Element *theElement;
@@ -82,3 +82,9 @@ MaterialResponse::getResponseSensitivity(int gradNumber)
 {
   return theMaterial->getResponseSensitivity(responseID, gradNumber, myInfo);
 }
+
+const Vector *
+MaterialResponse::getResponseStorage(void)
+{
+  return theMaterial->getResponseStorage(responseID);
+}
@@ -52,6 +52,7 @@ class MaterialResponse : public Response
   
   int getResponse(void);
   int getResponseSensitivity(int gradNumber);
+  const Vector *getResponseStorage(void);
 
 private:
   Material *theMaterial;
@@ -51,6 +51,8 @@ class Response
   
   virtual int getResponse(void) = 0;
   virtual int getResponseSensitivity(int gradNumber) {return 0;}
+  // storage always holding the current response, 0 if getResponse() is needed
+  virtual const Vector *getResponseStorage(void) {return 0;}
   virtual Information &getInformation(void);
 
   virtual void Print(OPS_Stream &s, int flag = 0);
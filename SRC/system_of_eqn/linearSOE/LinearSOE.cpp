@@ -32,6 +32,8 @@
 
 #include<LinearSOE.h>
 #include<LinearSOESolver.h>
+#include <PhaseProfiler.h>
+#include <LinearSOECapture.h>
 
 LinearSOE::LinearSOE(LinearSOESolver &theLinearSOESolver, int classtag)
     :MovableObject(classtag), theModel(0), theSolver(&theLinearSOESolver)
@@ -55,6 +57,10 @@ LinearSOE::~LinearSOE()
 int 
 LinearSOE::solve(void)
 {
+  PhaseTimer theTimer(PROFILE_LINEAR_SOLVE);
+  if (LinearSOECapture::isRequested() == true)
+    LinearSOECapture::check(*this, theModel);
+
   if (theSolver != 0)
     return (theSolver->solve());
   else 
@@ -40,6 +40,7 @@
 // What: "@(#) LinearSOE.h, revA"
 
 #include <MovableObject.h>
+#include <vector>
 
 class LinearSOESolver;
 class Graph;
@@ -77,6 +78,10 @@ class LinearSOE : public MovableObject
     virtual const Vector &getX(void) = 0;
     virtual const Vector &getB(void) = 0;    
     virtual const Matrix *getA(void) {return 0;};    
+    // the nonzero entries of A as (row, col, value), for a symmetric storage
+    // only one triangle and symmetric set true; used to capture the system
+    virtual int getEntries(std::vector<int> &rows, std::vector<int> &cols,
+			   std::vector<double> &values, bool &symmetric) {return -1;};
     virtual double getDeterminant(void);
     virtual double normRHS(void) = 0;
 
@@ -0,0 +1,282 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+// Description: This file contains the class implementation for LinearSOECapture.
+
+#include <LinearSOECapture.h>
+#include <LinearSOE.h>
+#include <AnalysisModel.h>
+#include <Domain.h>
+#include <Vector.h>
+#include <OPS_Globals.h>
+
+#include <string.h>
+#include <stdio.h>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+
+static const char SOE_MAGIC[8] = {'O','P','S','S','O','E','1','\0'};
+
+struct LinearSOECaptureHeader {
+  char magic[8];
+  int size;
+  int nnz;
+  int symmetric;
+  int reserved;
+  double check;
+};
+
+bool LinearSOECapture::requested = false;
+
+static int requestedStep = 0;
+static int requestedIteration = 1;
+static std::string requestedFile;
+static bool requestedBinary = false;
+
+static int currentStep = -1;
+static int currentIteration = 0;
+
+void
+LinearSOECapture::request(int step, int iteration, const char *fileName, bool binary)
+{
+  requestedStep = step;
+  requestedIteration = (iteration < 1) ? 1 : iteration;
+  requestedFile = fileName;
+  requestedBinary = binary;
+  currentStep = -1;
+  currentIteration = 0;
+  requested = true;
+}
+
+void
+LinearSOECapture::cancel(void)
+{
+  requested = false;
+}
+
+void
+LinearSOECapture::check(LinearSOE &theSOE, AnalysisModel *theModel)
+{
+  int step = 0;
+  if (theModel != 0 && theModel->getDomainPtr() != 0)
+    step = theModel->getDomainPtr()->getCommitTag() + 1;
+
+  if (step != currentStep) {
+    currentStep = step;
+    currentIteration = 0;
+  }
+  currentIteration++;
+
+  if (requestedStep > 0 && (step != requestedStep || currentIteration != requestedIteration))
+    return;
+
+  requested = false;
+  if (LinearSOECapture::write(theSOE, requestedFile.c_str(), requestedBinary) == 0) {
+    opserr << "LinearSOECapture - system of " << theSOE.getNumEqn() << " equations at step ";
+    opserr << step << " iteration " << currentIteration << " written to ";
+    opserr << requestedFile.c_str() << endln;
+  }
+}
+
+int
+LinearSOECapture::write(LinearSOE &theSOE, const char *fileName, bool binary)
+{
+  std::vector<int> rows, cols;
+  std::vector<double> values;
+  bool symmetric = false;
+  if (theSOE.getEntries(rows, cols, values, symmetric) < 0) {
+    opserr << "WARNING LinearSOECapture::write() - " << theSOE.getClassType();
+    opserr << " can not provide the entries of A\n";
+    return -1;
+  }
+
+  int size = theSOE.getNumEqn();
+  const Vector &B = theSOE.getB();
+  int nnz = (int)values.size();
+
+  if (binary == true) {
+    std::ofstream theFile(fileName, std::ios::out | std::ios::binary);
+    if (!theFile.is_open()) {
+      opserr << "WARNING LinearSOECapture::write() - could not open file " << fileName << endln;
+      return -1;
+    }
+
+    LinearSOECaptureHeader header;
+    memcpy(header.magic, SOE_MAGIC, 8);
+    header.size = size;
+    header.nnz = nnz;
+    header.symmetric = symmetric ? 1 : 0;
+    header.reserved = 0;
+    header.check = 1.0;
+    theFile.write((char *)&header, sizeof(LinearSOECaptureHeader));
+    if (nnz != 0) {
+      theFile.write((char *)&rows[0], nnz*sizeof(int));
+      theFile.write((char *)&cols[0], nnz*sizeof(int));
+      theFile.write((char *)&values[0], nnz*sizeof(double));
+    }
+    for (int i=0; i<size; i++) {
+      double value = B(i);
+      theFile.write((char *)&value, sizeof(double));
+    }
+    theFile.close();
+    return 0;
+  }
+
+  std::ofstream theFile(fileName, std::ios::out);
+  if (!theFile.is_open()) {
+    opserr << "WARNING LinearSOECapture::write() - could not open file " << fileName << endln;
+    return -1;
+  }
+  theFile << "%%MatrixMarket matrix coordinate real " << (symmetric ? "symmetric" : "general") << "\n";
+  theFile << size << " " << size << " " << nnz << "\n";
+  theFile << std::setprecision(17);
+  for (int i=0; i<nnz; i++) {
+    // Matrix Market symmetric holds the lower triangle
+    int row = rows[i], col = cols[i];
+    if (symmetric == true && row < col) {
+      row = cols[i];
+      col = rows[i];
+    }
+    theFile << row+1 << " " << col+1 << " " << values[i] << "\n";
+  }
+  theFile.close();
+
+  std::string rhsName(fileName);
+  rhsName += ".rhs";
+  std::ofstream rhsFile(rhsName.c_str(), std::ios::out);
+  if (!rhsFile.is_open()) {
+    opserr << "WARNING LinearSOECapture::write() - could not open file " << rhsName.c_str() << endln;
+    return -1;
+  }
+  rhsFile << "%%MatrixMarket matrix array real general\n";
+  rhsFile << size << " 1\n";
+  rhsFile << std::setprecision(17);
+  for (int i=0; i<size; i++)
+    rhsFile << B(i) << "\n";
+  rhsFile.close();
+
+  return 0;
+}
+
+// the next line of a Matrix Market file that is not a comment
+static bool
+getDataLine(std::ifstream &theFile, std::string &line)
+{
+  while (std::getline(theFile, line))
+    if (line.empty() == false && line[0] != '%')
+      return true;
+  return false;
+}
+
+int
+LinearSOECapture::read(const char *fileName, int &size,
+		       std::vector<int> &rows, std::vector<int> &cols,
+		       std::vector<double> &values, bool &symmetric,
+		       std::vector<double> &B)
+{
+  std::ifstream theFile(fileName, std::ios::in | std::ios::binary);
+  if (!theFile.is_open()) {
+    opserr << "WARNING LinearSOECapture::read() - could not open file " << fileName << endln;
+    return -1;
+  }
+
+  LinearSOECaptureHeader header;
+  theFile.read((char *)&header, sizeof(LinearSOECaptureHeader));
+  if (theFile && memcmp(header.magic, SOE_MAGIC, 8) == 0) {
+    if (header.check != 1.0) {
+      opserr << "WARNING LinearSOECapture::read() - " << fileName;
+      opserr << " was written on a machine of different byte order\n";
+      return -1;
+    }
+    size = header.size;
+    symmetric = (header.symmetric != 0);
+    int nnz = header.nnz;
+    rows.resize(nnz);
+    cols.resize(nnz);
+    values.resize(nnz);
+    B.resize(size);
+    if (nnz != 0) {
+      theFile.read((char *)&rows[0], nnz*sizeof(int));
+      theFile.read((char *)&cols[0], nnz*sizeof(int));
+      theFile.read((char *)&values[0], nnz*sizeof(double));
+    }
+    if (size != 0)
+      theFile.read((char *)&B[0], size*sizeof(double));
+    if (!theFile) {
+      opserr << "WARNING LinearSOECapture::read() - " << fileName << " is truncated\n";
+      return -1;
+    }
+    return 0;
+  }
+
+  // Matrix Market
+  theFile.close();
+  theFile.open(fileName, std::ios::in);
+  std::string line;
+  if (!std::getline(theFile, line) || line.find("%%MatrixMarket") != 0 ||
+      line.find("coordinate") == std::string::npos) {
+    opserr << "WARNING LinearSOECapture::read() - " << fileName;
+    opserr << " is neither a captured binary system nor a Matrix Market coordinate matrix\n";
+    return -1;
+  }
+  symmetric = (line.find("symmetric") != std::string::npos);
+
+  int numCols, nnz;
+  if (getDataLine(theFile, line) == false) {
+    opserr << "WARNING LinearSOECapture::read() - " << fileName << " holds no size line\n";
+    return -1;
+  }
+  std::istringstream sizeLine(line);
+  sizeLine >> size >> numCols >> nnz;
+  if (size != numCols) {
+    opserr << "WARNING LinearSOECapture::read() - " << fileName << " is not square\n";
+    return -1;
+  }
+
+  rows.resize(nnz);
+  cols.resize(nnz);
+  values.resize(nnz);
+  for (int i=0; i<nnz; i++) {
+    if (!(theFile >> rows[i] >> cols[i] >> values[i])) {
+      opserr << "WARNING LinearSOECapture::read() - " << fileName << " is truncated\n";
+      return -1;
+    }
+    rows[i]--;
+    cols[i]--;
+  }
+
+  // B if there is one, zero otherwise
+  B.assign(size, 0.0);
+  std::string rhsName(fileName);
+  rhsName += ".rhs";
+  std::ifstream rhsFile(rhsName.c_str(), std::ios::in);
+  if (rhsFile.is_open() && getDataLine(rhsFile, line) == true) {
+    for (int i=0; i<size; i++)
+      if (!(rhsFile >> B[i])) {
+	opserr << "WARNING LinearSOECapture::read() - " << rhsName.c_str() << " is truncated\n";
+	return -1;
+      }
+  }
+
+  return 0;
+}
@@ -0,0 +1,74 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+#ifndef LinearSOECapture_h
+#define LinearSOECapture_h
+
+// Description: This file contains the class definition for LinearSOECapture.
+// LinearSOECapture writes the A and B of a LinearSOE to file just before
+// it is solved, at a requested analysis step and iteration, so the system
+// can be replayed outside the model (EXAMPLES/Benchmarks/soeReplay). The
+// step is the number of the step being solved, one more than the number of
+// commits of the domain, and the iteration counts the solves of that step,
+// both starting at 1; a step of 0 captures the next solve.
+//
+// Two formats are written. Matrix Market: A in fileName as a coordinate
+// real general or symmetric matrix, B in fileName.rhs as an array. Binary:
+// one file of a 32 byte header
+//
+//    char   magic[8]   "OPSSOE1"
+//    int    size       number of equations
+//    int    nnz        number of entries
+//    int    symmetric  1 if only one triangle is stored
+//    int    reserved
+//    double check      1.0, used to detect a file of the wrong byte order
+//
+// followed by the int rows, int cols and double values of the nnz entries
+// (0 based) and the size doubles of B.
+//
+// The storage must provide LinearSOE::getEntries().
+
+#include <vector>
+
+class LinearSOE;
+class AnalysisModel;
+
+class LinearSOECapture
+{
+  public:
+    static void request(int step, int iteration, const char *fileName, bool binary);
+    static void cancel(void);
+    static bool isRequested(void) {return requested;};
+
+    // invoked by LinearSOE::solve() while a capture is requested
+    static void check(LinearSOE &theSOE, AnalysisModel *theModel);
+
+    static int write(LinearSOE &theSOE, const char *fileName, bool binary);
+    static int read(const char *fileName, int &size,
+		    std::vector<int> &rows, std::vector<int> &cols,
+		    std::vector<double> &values, bool &symmetric,
+		    std::vector<double> &B);
+
+  private:
+    static bool requested;
+};
+
+#endif
@@ -38,6 +38,7 @@
 #include <BandGenLinLapackSolver.h>
 #include <BandGenLinSOE.h>
 #include <math.h>
+#include <PhaseProfiler.h>
 
 void* OPS_BandGenLinLapack()
 {
@@ -115,6 +116,7 @@ BandGenLinLapackSolver::solve(void)
     Xptr = theSOE->X;
 
     // now solve AX = B
+    PhaseTimer theTimer(theSOE->factored == false ? PROFILE_FACTOR : PROFILE_TRI_SOLVE);
 
 #ifdef _WIN32
     {if (theSOE->factored == false)  
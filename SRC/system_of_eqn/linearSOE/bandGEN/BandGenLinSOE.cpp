@@ -39,6 +39,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <iostream>
+#include <MemoryReport.h>
 using std::nothrow;
 
 BandGenLinSOE::BandGenLinSOE(BandGenLinSolver &theSolvr)
@@ -494,6 +495,39 @@ BandGenLinSOE::getB(void)
 }
 
 
+int
+BandGenLinSOE::getEntries(std::vector<int> &rows, std::vector<int> &cols,
+			  std::vector<double> &values, bool &symmetric)
+{
+  if (factored == true) {
+    opserr << "WARNING BandGenLinSOE::getEntries() - A holds its factors\n";
+    return -1;
+  }
+
+  symmetric = false;
+  int ldA = 2*numSubD + numSuperD + 1;
+  for (int col=0; col<size; col++) {
+    double *coliiPtr = A + col*ldA + numSubD + numSuperD;
+    for (int row=col-numSuperD; row<=col+numSubD; row++) {
+      if (row < 0 || row >= size || coliiPtr[row-col] == 0.0)
+	continue;
+      rows.push_back(row);
+      cols.push_back(col);
+      values.push_back(coliiPtr[row-col]);
+    }
+  }
+
+  return 0;
+}
+
+void
+BandGenLinSOE::reportMemory(MemoryReport &theReport)
+{
+  // vectX and vectB hold their data in X and B
+  size_t bytes = sizeof(BandGenLinSOE) + 2*sizeof(Vector) + (Asize + 2*Bsize)*sizeof(double);
+  theReport.add(*this, bytes);
+}
+
 double 
 BandGenLinSOE::normRHS(void)
 {
@@ -67,6 +67,9 @@ class BandGenLinSOE : public LinearSOE
     virtual const Vector &getX(void);
     virtual const Vector &getB(void);
     virtual double normRHS(void);
+    virtual int getEntries(std::vector<int> &rows, std::vector<int> &cols,
+			   std::vector<double> &values, bool &symmetric);
+    virtual void reportMemory(MemoryReport &theReport);
 
     virtual void setX(int loc, double value);    
     virtual void setX(const Vector &x);    
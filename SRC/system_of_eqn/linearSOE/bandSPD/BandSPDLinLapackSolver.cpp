@@ -34,6 +34,7 @@
 #include <BandSPDLinSOE.h>
 //#include <f2c.h>
 #include <math.h>
+#include <PhaseProfiler.h>
 
 void* OPS_BandSPDLinLapack()
 {
@@ -102,6 +103,7 @@ BandSPDLinLapackSolver::solve(void)
     Xptr = theSOE->X;
 
     // now solve AX = Y
+    PhaseTimer theTimer(theSOE->factored == false ? PROFILE_FACTOR : PROFILE_TRI_SOLVE);
 
 	
 
@@ -42,6 +42,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <iostream>
+#include <MemoryReport.h>
 using std::nothrow;
 
 BandSPDLinSOE::BandSPDLinSOE(BandSPDLinSolver &the_Solver)
@@ -461,6 +462,39 @@ BandSPDLinSOE::getB(void)
     return *vectB;
 }
 
+int
+BandSPDLinSOE::getEntries(std::vector<int> &rows, std::vector<int> &cols,
+			  std::vector<double> &values, bool &symmetric)
+{
+  if (factored == true) {
+    opserr << "WARNING BandSPDLinSOE::getEntries() - A holds its factors\n";
+    return -1;
+  }
+
+  // the upper triangle
+  symmetric = true;
+  for (int col=0; col<size; col++) {
+    double *coliiPtr = A + (col+1)*half_band - 1;
+    for (int row=col-half_band+1; row<=col; row++) {
+      if (row < 0 || coliiPtr[row-col] == 0.0)
+	continue;
+      rows.push_back(row);
+      cols.push_back(col);
+      values.push_back(coliiPtr[row-col]);
+    }
+  }
+
+  return 0;
+}
+
+void
+BandSPDLinSOE::reportMemory(MemoryReport &theReport)
+{
+  // vectX and vectB hold their data in X and B
+  size_t bytes = sizeof(BandSPDLinSOE) + 2*sizeof(Vector) + (Asize + 2*Bsize)*sizeof(double);
+  theReport.add(*this, bytes);
+}
+
 double 
 BandSPDLinSOE::normRHS(void)
 {
@@ -40,6 +40,7 @@
 
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <MemoryReport.h>
 
 DiagonalSOE::DiagonalSOE(DiagonalSolver &the_Solver)
 :LinearSOE(the_Solver, LinSOE_TAGS_DiagonalSOE),
@@ -340,6 +341,35 @@ DiagonalSOE::getB(void)
   return *vectB;
 }
 
+int
+DiagonalSOE::getEntries(std::vector<int> &rows, std::vector<int> &cols,
+			std::vector<double> &values, bool &symmetric)
+{
+  if (isAfactored == true) {
+    opserr << "WARNING DiagonalSOE::getEntries() - A holds its factors\n";
+    return -1;
+  }
+
+  symmetric = false;
+  for (int i=0; i<size; i++) {
+    if (A[i] == 0.0)
+      continue;
+    rows.push_back(i);
+    cols.push_back(i);
+    values.push_back(A[i]);
+  }
+
+  return 0;
+}
+
+void
+DiagonalSOE::reportMemory(MemoryReport &theReport)
+{
+  // vectX and vectB hold their data in X and B
+  size_t bytes = sizeof(DiagonalSOE) + 2*sizeof(Vector) + 3*size*sizeof(double);
+  theReport.add(*this, bytes);
+}
+
 double 
 DiagonalSOE::normRHS(void)
 {
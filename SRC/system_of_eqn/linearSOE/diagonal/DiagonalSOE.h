@@ -64,6 +64,9 @@ class DiagonalSOE : public LinearSOE
     const Vector &getX(void);
     const Vector &getB(void);
     double normRHS(void);
+    int getEntries(std::vector<int> &rows, std::vector<int> &cols,
+		   std::vector<double> &values, bool &symmetric);
+    void reportMemory(MemoryReport &theReport);
 
     int setDiagonalSolver(DiagonalSolver &newSolver);    
     
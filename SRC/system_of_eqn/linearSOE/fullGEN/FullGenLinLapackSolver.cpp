@@ -37,6 +37,7 @@
 #include <math.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <PhaseProfiler.h>
 
 void* OPS_FullGenLinLapackSolver()
 {
@@ -108,6 +109,7 @@ FullGenLinLapackSolver::solve(void)
     Xptr = theSOE->X;
 
     // now solve AX = Y
+    PhaseTimer theTimer(theSOE->factored == false ? PROFILE_FACTOR : PROFILE_TRI_SOLVE);
 
 #ifdef _WIN32
     {if (theSOE->factored == false)  
@@ -44,6 +44,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <iostream>
+#include <MemoryReport.h>
 using std::nothrow;
 
 FullGenLinSOE::FullGenLinSOE(FullGenLinSolver &theSolvr)
@@ -454,6 +455,38 @@ FullGenLinSOE::getA(void)
     return matA;
 }
 
+int
+FullGenLinSOE::getEntries(std::vector<int> &rows, std::vector<int> &cols,
+			  std::vector<double> &values, bool &symmetric)
+{
+  if (factored == true) {
+    opserr << "WARNING FullGenLinSOE::getEntries() - A holds its factors\n";
+    return -1;
+  }
+
+  symmetric = false;
+  for (int col=0; col<size; col++) {
+    double *startColiPtr = A + col*size;
+    for (int row=0; row<size; row++) {
+      if (startColiPtr[row] == 0.0)
+	continue;
+      rows.push_back(row);
+      cols.push_back(col);
+      values.push_back(startColiPtr[row]);
+    }
+  }
+
+  return 0;
+}
+
+void
+FullGenLinSOE::reportMemory(MemoryReport &theReport)
+{
+  // vectX and vectB hold their data in X and B
+  size_t bytes = sizeof(FullGenLinSOE) + 2*sizeof(Vector) + sizeof(Matrix) + (Asize + 2*Bsize)*sizeof(double);
+  theReport.add(*this, bytes);
+}
+
 double 
 FullGenLinSOE::normRHS(void)
 {
@@ -69,6 +69,9 @@ class FullGenLinSOE : public LinearSOE
     const Matrix *getA(void);
 
     double normRHS(void);
+    int getEntries(std::vector<int> &rows, std::vector<int> &cols,
+		   std::vector<double> &values, bool &symmetric);
+    void reportMemory(MemoryReport &theReport);
 
     void setX(int loc, double value);        
     void setX(const Vector &x);        
@@ -42,6 +42,7 @@
 
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <PhaseProfiler.h>
 //#include <Timer.h>
 
 void* OPS_ProfileSPDLinDirectSolver()
@@ -159,7 +160,9 @@ ProfileSPDLinDirectSolver::solve(void)
       opserr << endln;
       */
 
-    
+
+    PhaseTimer theTimer(theSOE->isAfactored == false ? PROFILE_FACTOR : PROFILE_TRI_SOLVE);
+
     if (theSOE->isAfactored == false)  {
 
 	// FACTOR & SOLVE
@@ -41,6 +41,7 @@
 #include <FEM_ObjectBroker.h>
 
 #include <iostream>
+#include <MemoryReport.h>
 using std::nothrow;
 
 
@@ -536,6 +537,40 @@ ProfileSPDLinSOE::getB(void)
     return *vectB;
 }
 
+int
+ProfileSPDLinSOE::getEntries(std::vector<int> &rows, std::vector<int> &cols,
+			     std::vector<double> &values, bool &symmetric)
+{
+  if (isAfactored == true) {
+    opserr << "WARNING ProfileSPDLinSOE::getEntries() - A holds its factors\n";
+    return -1;
+  }
+
+  // the upper triangle, column by column inside the profile
+  symmetric = true;
+  for (int col=0; col<size; col++) {
+    double *coliiPtr = &A[iDiagLoc[col] -1]; // -1 as fortran indexing
+    int minColRow = (col == 0) ? 0 : col - (iDiagLoc[col] - iDiagLoc[col-1]) + 1;
+    for (int row=minColRow; row<=col; row++) {
+      if (coliiPtr[row-col] == 0.0)
+	continue;
+      rows.push_back(row);
+      cols.push_back(col);
+      values.push_back(coliiPtr[row-col]);
+    }
+  }
+
+  return 0;
+}
+
+void
+ProfileSPDLinSOE::reportMemory(MemoryReport &theReport)
+{
+  // vectX and vectB hold their data in X and B
+  size_t bytes = sizeof(ProfileSPDLinSOE) + 2*sizeof(Vector) + Bsize*sizeof(int) + (Asize + 2*Bsize)*sizeof(double);
+  theReport.add(*this, bytes);
+}
+
 double 
 ProfileSPDLinSOE::normRHS(void)
 {
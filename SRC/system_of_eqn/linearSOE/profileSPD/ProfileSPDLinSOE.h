@@ -66,6 +66,9 @@ class ProfileSPDLinSOE : public LinearSOE
     virtual const Vector &getX(void);
     virtual const Vector &getB(void);
     virtual double normRHS(void);
+    virtual int getEntries(std::vector<int> &rows, std::vector<int> &cols,
+			   std::vector<double> &values, bool &symmetric);
+    virtual void reportMemory(MemoryReport &theReport);
 
     virtual int setProfileSPDSolver(ProfileSPDLinSolver &newSolver);    
     virtual int sendSelf(int commitTag, Channel &theChannel);
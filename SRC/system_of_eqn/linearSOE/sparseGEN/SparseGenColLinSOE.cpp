@@ -43,6 +43,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <iostream>
+#include <MemoryReport.h>
 using std::nothrow;
 
 SparseGenColLinSOE::SparseGenColLinSOE(SparseGenColLinSolver &the_Solver)
@@ -482,6 +483,36 @@ SparseGenColLinSOE::getB(void)
     return *vectB;
 }
 
+int
+SparseGenColLinSOE::getEntries(std::vector<int> &rows, std::vector<int> &cols,
+			       std::vector<double> &values, bool &symmetric)
+{
+  // the solvers factor into storage of their own, A is kept
+  symmetric = false;
+  rows.reserve(nnz);
+  cols.reserve(nnz);
+  values.reserve(nnz);
+  for (int col=0; col<size; col++)
+    for (int k=colStartA[col]; k<colStartA[col+1]; k++) {
+      if (A[k] == 0.0)
+	continue;
+      rows.push_back(rowA[k]);
+      cols.push_back(col);
+      values.push_back(A[k]);
+    }
+
+  return 0;
+}
+
+void
+SparseGenColLinSOE::reportMemory(MemoryReport &theReport)
+{
+  // vectX and vectB hold their data in X and B
+  size_t bytes = sizeof(SparseGenColLinSOE) + 2*sizeof(Vector);
+  bytes += Asize*(sizeof(double) + sizeof(int)) + Bsize*(2*sizeof(double) + sizeof(int));
+  theReport.add(*this, bytes);
+}
+
 double 
 SparseGenColLinSOE::normRHS(void)
 {
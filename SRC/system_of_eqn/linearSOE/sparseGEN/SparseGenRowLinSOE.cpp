@@ -38,6 +38,7 @@
 
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <MemoryReport.h>
 
 SparseGenRowLinSOE::SparseGenRowLinSOE(SparseGenRowLinSolver &the_Solver)
 :LinearSOE(the_Solver, LinSOE_TAGS_SparseGenRowLinSOE),
@@ -444,6 +445,35 @@ SparseGenRowLinSOE::getB(void)
     return *vectB;
 }
 
+int
+SparseGenRowLinSOE::getEntries(std::vector<int> &rows, std::vector<int> &cols,
+			       std::vector<double> &values, bool &symmetric)
+{
+  symmetric = false;
+  rows.reserve(nnz);
+  cols.reserve(nnz);
+  values.reserve(nnz);
+  for (int row=0; row<size; row++)
+    for (int k=rowStartA[row]; k<rowStartA[row+1]; k++) {
+      if (A[k] == 0.0)
+	continue;
+      rows.push_back(row);
+      cols.push_back(colA[k]);
+      values.push_back(A[k]);
+    }
+
+  return 0;
+}
+
+void
+SparseGenRowLinSOE::reportMemory(MemoryReport &theReport)
+{
+  // vectX and vectB hold their data in X and B
+  size_t bytes = sizeof(SparseGenRowLinSOE) + 2*sizeof(Vector);
+  bytes += Asize*(sizeof(double) + sizeof(int)) + Bsize*(2*sizeof(double) + sizeof(int));
+  theReport.add(*this, bytes);
+}
+
 double 
 SparseGenRowLinSOE::normRHS(void)
 {
@@ -60,6 +60,9 @@ class SparseGenRowLinSOE : public LinearSOE
     const Vector &getX(void);
     const Vector &getB(void);    
     double normRHS(void);
+    int getEntries(std::vector<int> &rows, std::vector<int> &cols,
+		   std::vector<double> &values, bool &symmetric);
+    void reportMemory(MemoryReport &theReport);
 
     void setX(int loc, double value);        
     void setX(const Vector &x);        
@@ -27,6 +27,7 @@
 #include <FEM_ObjectBroker.h>
 
 #include <iostream>
+#include <MemoryReport.h>
 using std::nothrow;
 
 SymSparseLinSOE::SymSparseLinSOE(SymSparseLinSolver &the_Solver, int lSparse)
@@ -570,6 +571,82 @@ SymSparseLinSOE::getB(void)
     return *vectB;
 }
 
+int
+SymSparseLinSOE::getEntries(std::vector<int> &rows, std::vector<int> &cols,
+			    std::vector<double> &values, bool &symmetric)
+{
+  if (factored == true) {
+    opserr << "WARNING SymSparseLinSOE::getEntries() - A holds its factors\n";
+    return -1;
+  }
+
+  // the lower triangle is stored in the reordered equation numbers,
+  // invp maps the original number to the new one
+  std::vector<int> perm(size);
+  for (int i=0; i<size; i++)
+    perm[invp[i]] = i;
+
+  symmetric = true;
+  for (int i=0; i<size; i++) {
+    if (diag[i] != 0.0) {
+      rows.push_back(perm[i]);
+      cols.push_back(perm[i]);
+      values.push_back(diag[i]);
+    }
+
+    // the row inside the envelope of its diagonal block
+    int length = penv[i+1] - penv[i];
+    for (int j=i-length; j<i; j++) {
+      double value = penv[i][j-(i-length)];
+      if (value == 0.0)
+	continue;
+      rows.push_back(perm[i]);
+      cols.push_back(perm[j]);
+      values.push_back(value);
+    }
+  }
+
+  // the row segments left of the diagonal blocks
+  for (int blk=0; blk<nblks; blk++) {
+    int blkend = xblk[blk+1];
+    for (OFFDBLK *is = begblk[blk]; is->beg < blkend; is = is->bnext)
+      for (int j=is->beg; j<blkend; j++) {
+	double value = is->nz[j - is->beg];
+	if (value == 0.0)
+	  continue;
+	rows.push_back(perm[is->row]);
+	cols.push_back(perm[j]);
+	values.push_back(value);
+      }
+  }
+
+  return 0;
+}
+
+void
+SymSparseLinSOE::reportMemory(MemoryReport &theReport)
+{
+  // vectX and vectB hold their data in X and B
+  size_t bytes = sizeof(SymSparseLinSOE) + 2*sizeof(Vector) + 2*Bsize*sizeof(double);
+  if (rowStartA != 0)
+    bytes += (size+1 + nnz)*sizeof(int);
+
+  // the factor: diagonal, envelopes of the diagonal blocks and the row
+  // segments left of them, allocated by the symbolic factorization
+  if (diag != 0 && penv != 0) {
+    bytes += 3*(size+1)*sizeof(int) + (nblks+1)*(sizeof(int) + sizeof(OFFDBLK *));
+    bytes += (size+1)*(sizeof(double) + sizeof(double *));
+    bytes += (penv[size] - penv[0] + 1)*sizeof(double);
+    for (int blk=0; blk<nblks; blk++) {
+      int blkend = xblk[blk+1];
+      for (OFFDBLK *is = begblk[blk]; is->beg < blkend; is = is->bnext)
+	bytes += sizeof(OFFDBLK) + (blkend - is->beg)*sizeof(double);
+    }
+  }
+
+  theReport.add(*this, bytes);
+}
+
 double 
 SymSparseLinSOE::normRHS(void)
 {
@@ -49,6 +49,9 @@ class SymSparseLinSOE : public LinearSOE
     const Vector &getX(void);
     const Vector &getB(void);    
     double normRHS(void);
+    int getEntries(std::vector<int> &rows, std::vector<int> &cols,
+		   std::vector<double> &values, bool &symmetric);
+    void reportMemory(MemoryReport &theReport);
 
     void setX(int loc, double value);        
     void setX(const Vector &x);        
@@ -46,6 +46,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <ID.h>
+#include <MemoryReport.h>
 
 UmfpackGenLinSOE::UmfpackGenLinSOE(UmfpackGenLinSolver &the_Solver)
     :LinearSOE(the_Solver, LinSOE_TAGS_UmfpackGenLinSOE), X(), B(), Ap(), Ai(), Ax()
@@ -318,6 +319,33 @@ UmfpackGenLinSOE::getB(void)
     return B;
 }
 
+int
+UmfpackGenLinSOE::getEntries(std::vector<int> &rows, std::vector<int> &cols,
+			     std::vector<double> &values, bool &symmetric)
+{
+  // umfpack factors into storage of its own, Ax is kept
+  symmetric = false;
+  int size = (int)Ap.size() - 1;
+  for (int col=0; col<size; col++)
+    for (int k=Ap[col]; k<Ap[col+1]; k++) {
+      if (Ax[k] == 0.0)
+	continue;
+      rows.push_back(Ai[k]);
+      cols.push_back(col);
+      values.push_back(Ax[k]);
+    }
+
+  return 0;
+}
+
+void
+UmfpackGenLinSOE::reportMemory(MemoryReport &theReport)
+{
+  size_t bytes = sizeof(UmfpackGenLinSOE) + MemoryReport::bytes(X) + MemoryReport::bytes(B);
+  bytes += (Ap.capacity() + Ai.capacity())*sizeof(int) + Ax.capacity()*sizeof(double);
+  theReport.add(*this, bytes);
+}
+
 double
 UmfpackGenLinSOE::normRHS(void)
 {
@@ -74,26 +74,19 @@ MapOfTaggedObjects::setSize(int newSize)
 bool 
 MapOfTaggedObjects::addComponent(TaggedObject *newComponent)
 {
-    MAP_TAGGED_ITERATOR theEle;
     int tag = newComponent->getTag();
 
-    // check if the ele already in map, if not we add
-    theEle = theMap.find(tag);
-    if (theEle == theMap.end()) {
-	theMap.insert(MAP_TAGGED_TYPE(tag,newComponent));
-		      
-	// check if sucessfully added 
-	theEle = theMap.find(tag);
-	if (theEle == theMap.end()) {
-	  opserr << "MapOfTaggedObjects::addComponent - map STL failed to add object with tag : " << 
-	    newComponent->getTag() << "\n";
-	  return false;
-	}
+    // components added in increasing tag order, as models generated
+    // in bulk mostly are, go at the end of the map in constant time
+    if (theMap.empty() || tag > theMap.rbegin()->first) {
+	theMap.insert(theMap.end(), MAP_TAGGED_TYPE(tag,newComponent));
+	return true;
     }
-    
-    // if ele already there map cannot add even if allowMultiple is true
-    // as the map template does not allow multiple entries wih the same tag
-    else {	
+
+    // otherwise add if not already in the map; if ele already there map
+    // cannot add even if allowMultiple is true as the map template does
+    // not allow multiple entries wih the same tag
+    if (theMap.insert(MAP_TAGGED_TYPE(tag,newComponent)).second == false) {
       opserr << "MapOfTaggedObjects::addComponent - not adding as one with similar tag exists, tag: " <<
 	newComponent->getTag() << "\n";
       return false;
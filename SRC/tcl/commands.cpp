@@ -45,6 +45,11 @@ extern "C" {
 }
 
 #include <OPS_Globals.h>
+#include <PhaseProfiler.h>
+#include <ClassProfiler.h>
+#include <LinearSOECapture.h>
+#include <MemoryReport.h>
+#include <ConvergenceLog.h>
 #include <TclModelBuilder.h>
 #include <Matrix.h>
 
@@ -669,6 +674,36 @@ convertBinaryToText(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Cha
 int
 convertTextToBinary(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int
+convertCompressedToText(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int
+mergeProcessFiles(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int
+snapshot(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int
+saveModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int
+loadModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int
+recorderCost(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int
+profile(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int
+captureSOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int
+memoryReport(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int
+convergenceLog(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 int
 maxOpenFiles(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
@@ -883,8 +918,24 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
     Tcl_CreateCommand(interp, "algorithmRecorder", &addAlgoRecorder, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+    Tcl_CreateCommand(interp, "recorderCost", &recorderCost, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+    Tcl_CreateCommand(interp, "profile", &profile, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+    Tcl_CreateCommand(interp, "captureSOE", &captureSOE, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+    Tcl_CreateCommand(interp, "memoryReport", &memoryReport, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+    Tcl_CreateCommand(interp, "convergenceLog", &convergenceLog, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
     Tcl_CreateCommand(interp, "database", &addDatabase, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+    Tcl_CreateCommand(interp, "snapshot", &snapshot, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+    Tcl_CreateCommand(interp, "saveModel", &saveModel, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+    Tcl_CreateCommand(interp, "loadModel", &loadModel, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
     Tcl_CreateCommand(interp, "eigen", &eigenAnalysis, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
     Tcl_CreateCommand(interp, "video", &videoPlayer, 
@@ -987,6 +1038,8 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
     Tcl_CreateCommand(interp, "stripXML", &stripOpenSeesXML,(ClientData)NULL, NULL);
     Tcl_CreateCommand(interp, "convertBinaryToText", &convertBinaryToText,(ClientData)NULL, NULL);
     Tcl_CreateCommand(interp, "convertTextToBinary", &convertTextToBinary,(ClientData)NULL, NULL);
+    Tcl_CreateCommand(interp, "convertCompressedToText", &convertCompressedToText,(ClientData)NULL, NULL);
+    Tcl_CreateCommand(interp, "mergeProcessFiles", &mergeProcessFiles,(ClientData)NULL, NULL);
 
     Tcl_CreateCommand(interp, "getEleTags", &getEleTags, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
@@ -1364,7 +1417,9 @@ wipeModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
   if (theDatabase != 0)
     delete theDatabase;
 
+  theDomain.printRecorderCosts(opserr, 10);
   theDomain.clearAll();
+  ConvergenceLog::close();
   OPS_clearAllUniaxialMaterial();
   OPS_clearAllNDMaterial();
   OPS_clearAllSectionForceDeformation();
@@ -5165,6 +5220,334 @@ addDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv
   return TclAddDatabase(clientData, interp, argc, argv, theDomain, theBroker);
 }
 
+int 
+recorderCost(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  // with no options return tag, calls, skipped, time, bytes, flushTime of each recorder
+  if (argc < 2) {
+    Vector data;
+    theDomain.getRecorderCosts(data);
+    char buffer[40];
+    for (int i=0; i<data.Size(); i++) {
+      sprintf(buffer, "%.10g ", data(i));
+      Tcl_AppendResult(interp, buffer, NULL);
+    }
+    return TCL_OK;
+  }
+
+  int loc = 1;
+  while (loc < argc) {
+    if (strcmp(argv[loc],"-print") == 0) {
+      int numMax = 0;
+      if (loc+1 < argc && Tcl_GetInt(interp, argv[loc+1], &numMax) == TCL_OK)
+	loc++;
+      theDomain.printRecorderCosts(opserr, numMax);
+    } else if (strcmp(argv[loc],"-maxOverhead") == 0) {
+      double maxOverhead;
+      if (loc+1 >= argc || Tcl_GetDouble(interp, argv[loc+1], &maxOverhead) != TCL_OK) {
+	opserr << "WARNING recorderCost -maxOverhead fraction?\n";
+	return TCL_ERROR;
+      }
+      theDomain.setRecorderMaxOverhead(maxOverhead);
+      loc++;
+    } else if (strcmp(argv[loc],"-lowPriority") == 0) {
+      int tag;
+      while (loc+1 < argc && Tcl_GetInt(interp, argv[loc+1], &tag) == TCL_OK) {
+	if (theDomain.setRecorderLowPriority(tag) < 0)
+	  return TCL_ERROR;
+	loc++;
+      }
+    } else if (strcmp(argv[loc],"-reset") == 0) {
+      theDomain.resetRecorderCosts();
+    } else {
+      opserr << "WARNING recorderCost - unknown option " << argv[loc] << endln;
+      return TCL_ERROR;
+    }
+    loc++;
+  }
+
+  Tcl_ResetResult(interp);
+  return TCL_OK;
+}
+
+int 
+profile(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 2) {
+    opserr << "WARNING profile on|off|reset|report\n";
+    return TCL_ERROR;
+  }
+
+  if (strcmp(argv[1],"on") == 0) {
+    bool cpuTime = false;
+    for (int i=2; i<argc; i++) {
+      if (strcmp(argv[i],"-cpu") == 0)
+	cpuTime = true;
+      else if (strcmp(argv[i],"-classes") == 0)
+	ClassProfiler::setEnabled(true);
+      else if (strcmp(argv[i],"-trace") == 0) {
+	int maxEvents;
+	if (i+1 >= argc || Tcl_GetInt(interp, argv[i+1], &maxEvents) != TCL_OK) {
+	  opserr << "WARNING profile on -trace maxEvents?\n";
+	  return TCL_ERROR;
+	}
+	PhaseProfiler::setTrace(maxEvents);
+	i++;
+      }
+    }
+    PhaseProfiler::setEnabled(true, cpuTime);
+
+  } else if (strcmp(argv[1],"off") == 0) {
+    PhaseProfiler::setEnabled(false);
+    PhaseProfiler::setTrace(0);
+    ClassProfiler::setEnabled(false);
+
+  } else if (strcmp(argv[1],"reset") == 0) {
+    PhaseProfiler::reset();
+    ClassProfiler::reset();
+
+  } else if (strcmp(argv[1],"report") == 0) {
+    bool written = false;
+    int numClasses = 20;
+    for (int i=2; i+1<argc; i+=2) {
+      int res = 0;
+      if (strcmp(argv[i],"-classes") == 0) {
+	if (Tcl_GetInt(interp, argv[i+1], &numClasses) != TCL_OK) {
+	  opserr << "WARNING profile report -classes numMax?\n";
+	  return TCL_ERROR;
+	}
+	continue;
+      } else if (strcmp(argv[i],"-json") == 0)
+	res = PhaseProfiler::writeJSON(argv[i+1]);
+      else if (strcmp(argv[i],"-trace") == 0)
+	res = PhaseProfiler::writeTrace(argv[i+1]);
+      else {
+	opserr << "WARNING profile report - unknown option " << argv[i] << endln;
+	return TCL_ERROR;
+      }
+      if (res < 0)
+	return TCL_ERROR;
+      written = true;
+    }
+    if (written == false) {
+      PhaseProfiler::report(opserr);
+      ClassProfiler::report(opserr, numClasses);
+    }
+
+    // name count wall cpu of each phase
+    char buffer[80];
+    for (int i=0; i<PROFILE_NUM_PHASES; i++) {
+      sprintf(buffer, "%s %d %.10g %.10g ", PhaseProfiler::getName(i), PhaseProfiler::getCount(i),
+	      PhaseProfiler::getWallTime(i), PhaseProfiler::getCPUTime(i));
+      Tcl_AppendResult(interp, buffer, NULL);
+    }
+
+  } else {
+    opserr << "WARNING profile - unknown action " << argv[1] << ", valid on, off, reset, report\n";
+    return TCL_ERROR;
+  }
+
+  return TCL_OK;
+}
+
+int 
+captureSOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 2) {
+    opserr << "WARNING captureSOE fileName <-step step?> <-iteration iter?> <-binary> | captureSOE -off\n";
+    return TCL_ERROR;
+  }
+
+  if (strcmp(argv[1],"-off") == 0) {
+    LinearSOECapture::cancel();
+    return TCL_OK;
+  }
+
+  int step = 0;
+  int iteration = 1;
+  bool binary = false;
+  for (int i=2; i<argc; i++) {
+    if (strcmp(argv[i],"-binary") == 0)
+      binary = true;
+    else if (strcmp(argv[i],"-step") == 0) {
+      if (i+1 >= argc || Tcl_GetInt(interp, argv[i+1], &step) != TCL_OK) {
+	opserr << "WARNING captureSOE -step step?\n";
+	return TCL_ERROR;
+      }
+      i++;
+    } else if (strcmp(argv[i],"-iteration") == 0) {
+      if (i+1 >= argc || Tcl_GetInt(interp, argv[i+1], &iteration) != TCL_OK) {
+	opserr << "WARNING captureSOE -iteration iter?\n";
+	return TCL_ERROR;
+      }
+      i++;
+    } else {
+      opserr << "WARNING captureSOE - unknown option " << argv[i] << endln;
+      return TCL_ERROR;
+    }
+  }
+
+  LinearSOECapture::request(step, iteration, argv[1], binary);
+
+  return TCL_OK;
+}
+
+int 
+memoryReport(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  const char *fileName = 0;
+  int numClasses = 20;
+  for (int i=1; i+1<argc; i+=2) {
+    if (strcmp(argv[i],"-json") == 0)
+      fileName = argv[i+1];
+    else if (strcmp(argv[i],"-classes") == 0) {
+      if (Tcl_GetInt(interp, argv[i+1], &numClasses) != TCL_OK) {
+	opserr << "WARNING memoryReport -classes numMax?\n";
+	return TCL_ERROR;
+      }
+    } else {
+      opserr << "WARNING memoryReport - unknown option " << argv[i] << endln;
+      return TCL_ERROR;
+    }
+  }
+
+  MemoryReport theReport;
+  theDomain.reportMemory(theReport);
+  if (theAnalysisModel != 0)
+    theAnalysisModel->reportMemory(theReport);
+  if (theSOE != 0)
+    theSOE->reportMemory(theReport);
+
+  if (fileName != 0) {
+    if (theReport.writeJSON(fileName) < 0)
+      return TCL_ERROR;
+  } else
+    theReport.report(opserr, numClasses);
+
+  char buffer[40];
+  sprintf(buffer, "%.0f", theReport.getTotal());
+  Tcl_SetResult(interp, buffer, TCL_VOLATILE);
+
+  return TCL_OK;
+}
+
+int 
+convergenceLog(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 2) {
+    opserr << "WARNING convergenceLog fileName <-binary> | convergenceLog -close | -last | -norms | -algorithm\n";
+    return TCL_ERROR;
+  }
+
+  // the last step: step, time, dt, result, iterations, solves,
+  // factorizations, wall, firstNorm, lastNorm, algorithm class tag
+  if (strcmp(argv[1],"-last") == 0 || strcmp(argv[1],"-norms") == 0) {
+    const Vector &data = (strcmp(argv[1],"-last") == 0) ?
+      ConvergenceLog::getLastStep() : ConvergenceLog::getLastNorms();
+    char buffer[40];
+    for (int i=0; i<data.Size(); i++) {
+      sprintf(buffer, "%.10g ", data(i));
+      Tcl_AppendResult(interp, buffer, NULL);
+    }
+    return TCL_OK;
+  }
+
+  if (strcmp(argv[1],"-algorithm") == 0) {
+    Tcl_SetResult(interp, (char *)ConvergenceLog::getLastAlgorithm(), TCL_VOLATILE);
+    return TCL_OK;
+  }
+
+  if (strcmp(argv[1],"-close") == 0) {
+    ConvergenceLog::close();
+    return TCL_OK;
+  }
+
+  bool binary = false;
+  for (int i=2; i<argc; i++) {
+    if (strcmp(argv[i],"-binary") == 0)
+      binary = true;
+    else {
+      opserr << "WARNING convergenceLog - unknown option " << argv[i] << endln;
+      return TCL_ERROR;
+    }
+  }
+
+  if (ConvergenceLog::open(argv[1], binary) < 0)
+    return TCL_ERROR;
+
+  return TCL_OK;
+}
+
+extern int createSnapshot(const char *name, Domain &theDomain, FEM_ObjectBroker &theBroker);
+extern int restoreSnapshot(const char *name, Domain &theDomain);
+extern int dropSnapshot(const char *name);
+
+int 
+snapshot(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 2) {
+    opserr << "WARNING snapshot create|restore|drop <name>\n";
+    return TCL_ERROR;
+  }
+
+  if (strcmp(argv[1],"drop") == 0) {
+    if (dropSnapshot(argc > 2 ? argv[2] : 0) < 0)
+      return TCL_ERROR;
+    return TCL_OK;
+  }
+
+  if (argc < 3) {
+    opserr << "WARNING snapshot " << argv[1] << " name?\n";
+    return TCL_ERROR;
+  }
+
+  int result = 0;
+  if (strcmp(argv[1],"create") == 0)
+    result = createSnapshot(argv[2], theDomain, theBroker);
+  else if (strcmp(argv[1],"restore") == 0)
+    result = restoreSnapshot(argv[2], theDomain);
+  else {
+    opserr << "WARNING snapshot - unknown action " << argv[1] << ", valid create, restore, drop\n";
+    return TCL_ERROR;
+  }
+
+  if (result < 0)
+    return TCL_ERROR;
+
+  return TCL_OK;
+}
+
+extern int saveModel(const char *fileName, Domain &theDomain, FEM_ObjectBroker &theBroker);
+extern int loadModel(const char *fileName, Domain &theDomain, FEM_ObjectBroker &theBroker);
+
+int 
+saveModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 2) {
+    opserr << "WARNING saveModel fileName\n";
+    return TCL_ERROR;
+  }
+
+  if (saveModel(argv[1], theDomain, theBroker) < 0)
+    return TCL_ERROR;
+
+  return TCL_OK;
+}
+
+int 
+loadModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 2) {
+    opserr << "WARNING loadModel fileName\n";
+    return TCL_ERROR;
+  }
+
+  if (loadModel(argv[1], theDomain, theBroker) < 0)
+    return TCL_ERROR;
+
+  return TCL_OK;
+}
+
 
 /*
 int 
@@ -8875,6 +9258,10 @@ int stripOpenSeesXML(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Ch
 
 extern int binaryToText(const char *inputFilename, const char *outputFilename);
 extern int textToBinary(const char *inputFilename, const char *outputFilename);
+#include <TimeSeriesFile.h>
+extern int drmTextToBinary(const char *inputFilename, const char *outputFilename, int numNodes);
+extern int expandCompressedFile(const char *inputFilename, const char *outputFilename);
+extern int mergeProcessFiles(const char *indexName, const char *outputName);
 
 int convertBinaryToText(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
@@ -8890,6 +9277,34 @@ int convertBinaryToText(ClientData clientData, Tcl_Interp *interp, int argc, TCL
 }
 
 
+int convertCompressedToText(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 3) {
+    opserr << "ERROR incorrect # args - convertCompressedToText inputFile outputFile\n";
+    return -1;
+  }
+
+  const char *inputFile = argv[1];
+  const char *outputFile = argv[2];
+
+  return expandCompressedFile(inputFile, outputFile);
+}
+
+
+int mergeProcessFiles(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 3) {
+    opserr << "ERROR incorrect # args - mergeProcessFiles indexFile outputFile\n";
+    return -1;
+  }
+
+  const char *indexFile = argv[1];
+  const char *outputFile = argv[2];
+
+  return mergeProcessFiles(indexFile, outputFile);
+}
+
+
 int convertTextToBinary(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
   if (argc < 3) {
@@ -8900,6 +9315,25 @@ int convertTextToBinary(ClientData clientData, Tcl_Interp *interp, int argc, TCL
   const char *inputFile = argv[1];
   const char *outputFile = argv[2];
 
+  // -timeSeries writes the mapped format read by PathSeries & PathTimeSeries,
+  // -time if the text holds time & value pairs
+  if (argc > 3 && strcmp(argv[3],"-timeSeries") == 0) {
+    int numCols = 1;
+    if (argc > 4 && strcmp(argv[4],"-time") == 0)
+      numCols = 2;
+    return TimeSeriesFile::textToBinary(inputFile, outputFile, numCols);
+  }
+
+  // -drm numNodes writes the binary format read by the DRM input handlers
+  if (argc > 4 && strcmp(argv[3],"-drm") == 0) {
+    int numNodes;
+    if (Tcl_GetInt(interp, argv[4], &numNodes) != TCL_OK) {
+      opserr << "ERROR convertTextToBinary - invalid numNodes " << argv[4] << endln;
+      return TCL_ERROR;
+    }
+    return drmTextToBinary(inputFile, outputFile, numNodes);
+  }
+
   return textToBinary(inputFile, outputFile);
 }
 
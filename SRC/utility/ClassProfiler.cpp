@@ -0,0 +1,190 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+// Description: This file contains the class implementation for ClassProfiler.
+
+#include <ClassProfiler.h>
+#include <MovableObject.h>
+#include <OPS_Globals.h>
+
+#include <map>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <ostream>
+
+struct ClassProfile {
+  std::string name;
+  bool isMaterial;
+  int count[CLASS_PROFILE_NUM_CALLS];
+  double time[CLASS_PROFILE_NUM_CALLS];
+  long long numIters;
+  int numMaxHits;
+
+  double totalTime(void) const {
+    double total = 0.0;
+    for (int i=0; i<CLASS_PROFILE_NUM_CALLS; i++)
+      total += time[i];
+    return total;
+  }
+};
+
+static const char *callNames[CLASS_PROFILE_NUM_CALLS] = {
+  "update",
+  "tangent",
+  "resist",
+  "commit",
+  "trial",
+  "commit"
+};
+
+// element and material class tags overlap, so the key is (isMaterial, classTag)
+static std::map<std::pair<int,int>, ClassProfile> theProfiles;
+
+bool ClassProfiler::enabled = false;
+
+static ClassProfile &
+getProfile(const MovableObject *theObject, bool isMaterial)
+{
+  std::pair<int,int> key(isMaterial ? 1 : 0, theObject->getClassTag());
+  std::map<std::pair<int,int>, ClassProfile>::iterator it = theProfiles.find(key);
+  if (it != theProfiles.end())
+    return it->second;
+
+  ClassProfile &theProfile = theProfiles[key];
+  theProfile.name = theObject->getClassType();
+  theProfile.isMaterial = isMaterial;
+  for (int i=0; i<CLASS_PROFILE_NUM_CALLS; i++) {
+    theProfile.count[i] = 0;
+    theProfile.time[i] = 0.0;
+  }
+  theProfile.numIters = 0;
+  theProfile.numMaxHits = 0;
+
+  return theProfile;
+}
+
+void
+ClassProfiler::reset(void)
+{
+  theProfiles.clear();
+}
+
+void
+ClassProfiler::add(int call, const MovableObject *theObject, double time)
+{
+  if (theObject == 0)
+    return;
+
+  ClassProfile &theProfile = getProfile(theObject, call >= CLASS_PROFILE_MAT_TRIAL);
+  theProfile.count[call]++;
+  theProfile.time[call] += time;
+}
+
+void
+ClassProfiler::addIterations(const MovableObject *theObject, int numIters, int numMaxHits)
+{
+  if (theObject == 0)
+    return;
+
+  ClassProfile &theProfile = getProfile(theObject, false);
+  theProfile.numIters += numIters;
+  theProfile.numMaxHits += numMaxHits;
+}
+
+static bool
+moreTime(const ClassProfile *a, const ClassProfile *b)
+{
+  return a->totalTime() > b->totalTime();
+}
+
+static void
+getRanked(std::vector<const ClassProfile *> &ranked)
+{
+  std::map<std::pair<int,int>, ClassProfile>::iterator it;
+  for (it = theProfiles.begin(); it != theProfiles.end(); it++)
+    ranked.push_back(&(it->second));
+  std::stable_sort(ranked.begin(), ranked.end(), moreTime);
+}
+
+void
+ClassProfiler::report(OPS_Stream &s, int numMax)
+{
+  std::vector<const ClassProfile *> ranked;
+  getRanked(ranked);
+  if (ranked.empty())
+    return;
+
+  double elementTime = 0.0;
+  for (size_t i=0; i<ranked.size(); i++)
+    if (ranked[i]->isMaterial == false)
+      elementTime += ranked[i]->totalTime();
+
+  s << "Class profile (seconds, element times include their materials)\n";
+
+  int numPrint = (int)ranked.size();
+  if (numMax > 0 && numMax < numPrint)
+    numPrint = numMax;
+
+  for (int i=0; i<numPrint; i++) {
+    const ClassProfile &theProfile = *ranked[i];
+    double total = theProfile.totalTime();
+    s << "  " << (theProfile.isMaterial ? "material " : "element ") << theProfile.name.c_str();
+    s << ": " << total;
+    if (elementTime > 0.0)
+      s << " (" << 100.0*total/elementTime << "% of element time)";
+    int first = theProfile.isMaterial ? CLASS_PROFILE_MAT_TRIAL : 0;
+    int last = theProfile.isMaterial ? CLASS_PROFILE_NUM_CALLS : CLASS_PROFILE_MAT_TRIAL;
+    for (int j=first; j<last; j++)
+      if (theProfile.count[j] != 0)
+	s << " " << callNames[j] << " " << theProfile.count[j] << "/" << theProfile.time[j];
+    if (theProfile.numIters != 0)
+      s << " iters " << (double)theProfile.numIters << " maxIterHits " << theProfile.numMaxHits;
+    s << endln;
+  }
+
+  if (numPrint < (int)ranked.size())
+    s << "  ... " << (int)ranked.size() - numPrint << " more\n";
+}
+
+int
+ClassProfiler::writeJSON(std::ostream &s)
+{
+  std::vector<const ClassProfile *> ranked;
+  getRanked(ranked);
+
+  s << "[";
+  for (size_t i=0; i<ranked.size(); i++) {
+    const ClassProfile &theProfile = *ranked[i];
+    s << (i == 0 ? "\n" : ",\n");
+    s << "    {\"class\": \"" << theProfile.name << "\", \"kind\": \"";
+    s << (theProfile.isMaterial ? "material" : "element") << "\"";
+    int first = theProfile.isMaterial ? CLASS_PROFILE_MAT_TRIAL : 0;
+    int last = theProfile.isMaterial ? CLASS_PROFILE_NUM_CALLS : CLASS_PROFILE_MAT_TRIAL;
+    for (int j=first; j<last; j++)
+      s << ", \"" << callNames[j] << "\": {\"count\": " << theProfile.count[j]
+	<< ", \"time\": " << theProfile.time[j] << "}";
+    s << ", \"iters\": " << theProfile.numIters << ", \"maxIterHits\": " << theProfile.numMaxHits << "}";
+  }
+  s << (ranked.empty() ? "]" : "\n  ]");
+
+  return 0;
+}
@@ -0,0 +1,93 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+#ifndef ClassProfiler_h
+#define ClassProfiler_h
+
+// Description: This file contains the class definition for ClassProfiler.
+// ClassProfiler accumulates, for each element and material class, the
+// number of calls and the wall time spent in the element update, tangent,
+// resisting force and commit calls and in the fiber material trial and
+// commit calls, together with the local iterations reported by elements
+// that iterate (e.g. ForceBeamColumn) and how often those hit their
+// maximum. It is off by default; when off a ClassTimer costs a test of a
+// flag. Material calls are made within element calls, so element times
+// include the time of their materials.
+
+#include <chrono>
+#include <iosfwd>
+
+class OPS_Stream;
+class MovableObject;
+
+enum ClassProfileCall {
+  CLASS_PROFILE_UPDATE,
+  CLASS_PROFILE_TANGENT,
+  CLASS_PROFILE_RESIST,
+  CLASS_PROFILE_COMMIT,
+  CLASS_PROFILE_MAT_TRIAL,
+  CLASS_PROFILE_MAT_COMMIT,
+  CLASS_PROFILE_NUM_CALLS
+};
+
+class ClassProfiler
+{
+  public:
+    static void setEnabled(bool onOff) {enabled = onOff;};
+    static bool isEnabled(void) {return enabled;};
+    static void reset(void);
+
+    static void add(int call, const MovableObject *theObject, double time);
+    static void addIterations(const MovableObject *theObject, int numIters, int numMaxHits);
+
+    // ranked by total time, numMax 0 for all classes
+    static void report(OPS_Stream &s, int numMax = 0);
+    static int writeJSON(std::ostream &s);
+
+  private:
+    static bool enabled;
+};
+
+class ClassTimer
+{
+  public:
+    ClassTimer(int call, const MovableObject *object)
+      :theCall(call), theObject(object), active(ClassProfiler::isEnabled())
+    {
+      if (active == true)
+	start = std::chrono::steady_clock::now();
+    };
+
+    ~ClassTimer()
+    {
+      if (active == true)
+	ClassProfiler::add(theCall, theObject,
+			   std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    };
+
+  private:
+    int theCall;
+    const MovableObject *theObject;
+    bool active;
+    std::chrono::steady_clock::time_point start;
+};
+
+#endif
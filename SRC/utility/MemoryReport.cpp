@@ -0,0 +1,246 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+// Description: This file contains the class implementation for MemoryReport.
+
+#include <MemoryReport.h>
+#include <MovableObject.h>
+#include <OPS_Globals.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <ID.h>
+
+#include <Node.h>
+#include <Element.h>
+#include <SectionForceDeformation.h>
+#include <Material.h>
+#include <LinearSOE.h>
+#include <AnalysisModel.h>
+
+#include <vector>
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+static const char *
+getKind(const MovableObject &theObject)
+{
+  MovableObject *theObjectPtr = const_cast<MovableObject *>(&theObject);
+
+  if (dynamic_cast<Node *>(theObjectPtr) != 0)
+    return "node";
+  if (dynamic_cast<Element *>(theObjectPtr) != 0)
+    return "element";
+  if (dynamic_cast<SectionForceDeformation *>(theObjectPtr) != 0)
+    return "section";
+  if (dynamic_cast<Material *>(theObjectPtr) != 0)
+    return "material";
+  if (dynamic_cast<LinearSOE *>(theObjectPtr) != 0)
+    return "soe";
+  if (dynamic_cast<AnalysisModel *>(theObjectPtr) != 0)
+    return "analysis";
+
+  return "other";
+}
+
+MemoryReport::MemoryReport()
+{
+
+}
+
+MemoryReportEntry &
+MemoryReport::getEntry(const char *kind, const char *className)
+{
+  std::pair<std::string,std::string> key(kind, className);
+  std::map<std::pair<std::string,std::string>, MemoryReportEntry>::iterator it = theEntries.find(key);
+  if (it != theEntries.end())
+    return it->second;
+
+  MemoryReportEntry &theEntry = theEntries[key];
+  theEntry.count = 0;
+  theEntry.numUnreported = 0;
+  theEntry.bytes = 0.0;
+
+  return theEntry;
+}
+
+void
+MemoryReport::add(const MovableObject &theObject, size_t bytes)
+{
+  MemoryReportEntry &theEntry = this->getEntry(getKind(theObject), theObject.getClassType());
+  theEntry.count++;
+  theEntry.bytes += bytes;
+}
+
+void
+MemoryReport::addUnreported(const MovableObject &theObject)
+{
+  MemoryReportEntry &theEntry = this->getEntry(getKind(theObject), theObject.getClassType());
+  theEntry.count++;
+  theEntry.numUnreported++;
+}
+
+void
+MemoryReport::add(const char *kind, const char *className, size_t bytes, int count)
+{
+  MemoryReportEntry &theEntry = this->getEntry(kind, className);
+  theEntry.count += count;
+  theEntry.bytes += bytes;
+}
+
+double
+MemoryReport::getTotal(void) const
+{
+  double total = 0.0;
+  std::map<std::pair<std::string,std::string>, MemoryReportEntry>::const_iterator it;
+  for (it = theEntries.begin(); it != theEntries.end(); it++)
+    total += it->second.bytes;
+
+  return total;
+}
+
+typedef std::pair<const std::pair<std::string,std::string>, MemoryReportEntry> MemoryReportItem;
+
+static bool
+moreBytes(const MemoryReportItem *a, const MemoryReportItem *b)
+{
+  return a->second.bytes > b->second.bytes;
+}
+
+static void
+getRanked(const std::map<std::pair<std::string,std::string>, MemoryReportEntry> &theEntries,
+	  std::vector<const MemoryReportItem *> &ranked)
+{
+  std::map<std::pair<std::string,std::string>, MemoryReportEntry>::const_iterator it;
+  for (it = theEntries.begin(); it != theEntries.end(); it++)
+    ranked.push_back(&(*it));
+  std::stable_sort(ranked.begin(), ranked.end(), moreBytes);
+}
+
+void
+MemoryReport::report(OPS_Stream &s, int numMax) const
+{
+  std::vector<const MemoryReportItem *> ranked;
+  getRanked(theEntries, ranked);
+
+  double total = this->getTotal();
+
+  // totals of each kind
+  std::map<std::string, double> kinds;
+  for (size_t i=0; i<ranked.size(); i++)
+    kinds[ranked[i]->first.first] += ranked[i]->second.bytes;
+
+  s << "Memory report (MB): total " << total/1048576.0 << endln;
+  std::map<std::string, double>::iterator it;
+  for (it = kinds.begin(); it != kinds.end(); it++)
+    s << "  " << it->first.c_str() << ": " << it->second/1048576.0 << endln;
+
+  int numPrint = (int)ranked.size();
+  if (numMax > 0 && numMax < numPrint)
+    numPrint = numMax;
+
+  for (int i=0; i<numPrint; i++) {
+    const MemoryReportEntry &theEntry = ranked[i]->second;
+    s << "  " << ranked[i]->first.first.c_str() << " " << ranked[i]->first.second.c_str();
+    s << ": " << theEntry.count << " objects";
+    if (theEntry.count > theEntry.numUnreported) {
+      s << " " << theEntry.bytes/1048576.0 << " MB";
+      if (total > 0.0)
+	s << " (" << 100.0*theEntry.bytes/total << "%)";
+      s << " " << theEntry.bytes/(theEntry.count - theEntry.numUnreported) << " bytes each";
+    }
+    if (theEntry.numUnreported != 0)
+      s << " " << theEntry.numUnreported << " unreported";
+    s << endln;
+  }
+
+  if (numPrint < (int)ranked.size())
+    s << "  ... " << (int)ranked.size() - numPrint << " more\n";
+}
+
+int
+MemoryReport::writeJSON(const char *fileName) const
+{
+  std::ofstream theFile(fileName, std::ios::out);
+  if (!theFile.is_open()) {
+    opserr << "WARNING MemoryReport::writeJSON() - could not open file " << fileName << endln;
+    return -1;
+  }
+
+  std::vector<const MemoryReportItem *> ranked;
+  getRanked(theEntries, ranked);
+
+  theFile << std::setprecision(12);
+  theFile << "{\n  \"total\": " << this->getTotal() << ",\n  \"classes\": [";
+  for (size_t i=0; i<ranked.size(); i++) {
+    const MemoryReportEntry &theEntry = ranked[i]->second;
+    theFile << (i == 0 ? "\n" : ",\n");
+    theFile << "    {\"kind\": \"" << ranked[i]->first.first << "\", \"class\": \"";
+    theFile << ranked[i]->first.second << "\", \"count\": " << theEntry.count;
+    theFile << ", \"unreported\": " << theEntry.numUnreported << ", \"bytes\": " << theEntry.bytes << "}";
+  }
+  theFile << (ranked.empty() ? "]" : "\n  ]") << "\n}\n";
+  theFile.close();
+
+  return 0;
+}
+
+size_t
+MemoryReport::bytes(const Vector *theVector)
+{
+  if (theVector == 0)
+    return 0;
+  return sizeof(Vector) + bytes(*theVector);
+}
+
+size_t
+MemoryReport::bytes(const Matrix *theMatrix)
+{
+  if (theMatrix == 0)
+    return 0;
+  return sizeof(Matrix) + bytes(*theMatrix);
+}
+
+size_t
+MemoryReport::bytes(const ID *theID)
+{
+  if (theID == 0)
+    return 0;
+  return sizeof(ID) + bytes(*theID);
+}
+
+size_t
+MemoryReport::bytes(const Vector &theVector)
+{
+  return sizeof(double)*theVector.Size();
+}
+
+size_t
+MemoryReport::bytes(const Matrix &theMatrix)
+{
+  return sizeof(double)*theMatrix.noRows()*theMatrix.noCols();
+}
+
+size_t
+MemoryReport::bytes(const ID &theID)
+{
+  return sizeof(int)*theID.Size();
+}
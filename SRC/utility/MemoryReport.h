@@ -0,0 +1,83 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+#ifndef MemoryReport_h
+#define MemoryReport_h
+
+// Description: This file contains the class definition for MemoryReport.
+// A MemoryReport collects the heap used by the objects of a model,
+// aggregated by kind (node, element, material, section, analysis, graph,
+// soe) and class. Objects add themselves through
+// MovableObject::reportMemory(), giving the bytes of the object and of the
+// storage it owns, then invoke reportMemory() on the objects they own that
+// are counted separately (e.g. an element its materials). Classes that do
+// not implement reportMemory() are still counted, as unreported, so the
+// report shows which classes it does not cover.
+//
+// The bytes() helpers give the storage of a Vector, Matrix or ID: for a
+// pointer the object and its data, 0 for a null pointer; for a reference,
+// a member held by value, only its data.
+
+#include <map>
+#include <string>
+#include <stddef.h>
+
+class OPS_Stream;
+class MovableObject;
+class Vector;
+class Matrix;
+class ID;
+
+struct MemoryReportEntry {
+  int count;
+  int numUnreported;
+  double bytes;
+};
+
+class MemoryReport
+{
+  public:
+    MemoryReport();
+
+    void add(const MovableObject &theObject, size_t bytes);
+    void addUnreported(const MovableObject &theObject);
+    void add(const char *kind, const char *className, size_t bytes, int count = 1);
+
+    double getTotal(void) const;
+
+    // ranked by bytes, numMax 0 for all classes
+    void report(OPS_Stream &s, int numMax = 0) const;
+    int writeJSON(const char *fileName) const;
+
+    static size_t bytes(const Vector *theVector);
+    static size_t bytes(const Matrix *theMatrix);
+    static size_t bytes(const ID *theID);
+    static size_t bytes(const Vector &theVector);
+    static size_t bytes(const Matrix &theMatrix);
+    static size_t bytes(const ID &theID);
+
+  private:
+    MemoryReportEntry &getEntry(const char *kind, const char *className);
+
+    std::map<std::pair<std::string,std::string>, MemoryReportEntry> theEntries;
+};
+
+#endif
@@ -0,0 +1,221 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+// Description: This file contains the class implementation for PhaseProfiler.
+
+#include <PhaseProfiler.h>
+#include <ClassProfiler.h>
+#include <OPS_Globals.h>
+
+#include <vector>
+#include <fstream>
+#include <iomanip>
+
+struct PhaseProfile {
+  int count;
+  double wallTime;
+  double cpuTime;
+};
+
+struct PhaseEvent {
+  int phase;
+  double start;     // microseconds since the profile was reset
+  double duration;
+};
+
+static const char *phaseNames[PROFILE_NUM_PHASES] = {
+  "newStep",
+  "formTangent",
+  "formUnbalance",
+  "linearSolve",
+  "factor",
+  "triSolve",
+  "update",
+  "test",
+  "commit",
+  "record"
+};
+
+static PhaseProfile theProfiles[PROFILE_NUM_PHASES];
+static std::vector<PhaseEvent> theEvents;
+static int maxEvents = 0;
+static std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+
+bool PhaseProfiler::enabled = true;
+bool PhaseProfiler::timingCPU = false;
+
+void
+PhaseProfiler::setEnabled(bool onOff, bool cpuTime)
+{
+  enabled = onOff;
+  timingCPU = cpuTime;
+}
+
+void
+PhaseProfiler::setTrace(int numEvents)
+{
+  if (numEvents < 0)
+    numEvents = 0;
+  maxEvents = numEvents;
+  if ((int)theEvents.size() > maxEvents)
+    theEvents.resize(maxEvents);
+  if (maxEvents > 0)
+    theEvents.reserve(maxEvents < 65536 ? maxEvents : 65536);
+}
+
+void
+PhaseProfiler::reset(void)
+{
+  for (int i=0; i<PROFILE_NUM_PHASES; i++) {
+    theProfiles[i].count = 0;
+    theProfiles[i].wallTime = 0.0;
+    theProfiles[i].cpuTime = 0.0;
+  }
+  theEvents.clear();
+  epoch = std::chrono::steady_clock::now();
+}
+
+const char *
+PhaseProfiler::getName(int phase)
+{
+  if (phase < 0 || phase >= PROFILE_NUM_PHASES)
+    return "unknown";
+  return phaseNames[phase];
+}
+
+int
+PhaseProfiler::getCount(int phase)
+{
+  if (phase < 0 || phase >= PROFILE_NUM_PHASES)
+    return 0;
+  return theProfiles[phase].count;
+}
+
+double
+PhaseProfiler::getWallTime(int phase)
+{
+  if (phase < 0 || phase >= PROFILE_NUM_PHASES)
+    return 0.0;
+  return theProfiles[phase].wallTime;
+}
+
+double
+PhaseProfiler::getCPUTime(int phase)
+{
+  if (phase < 0 || phase >= PROFILE_NUM_PHASES)
+    return 0.0;
+  return theProfiles[phase].cpuTime;
+}
+
+void
+PhaseProfiler::add(int phase, std::chrono::steady_clock::time_point start,
+		   std::chrono::steady_clock::time_point end, double cpu)
+{
+  double wall = std::chrono::duration<double>(end - start).count();
+  PhaseProfile &theProfile = theProfiles[phase];
+  theProfile.count++;
+  theProfile.wallTime += wall;
+  theProfile.cpuTime += cpu;
+
+  if ((int)theEvents.size() < maxEvents) {
+    PhaseEvent theEvent;
+    theEvent.phase = phase;
+    theEvent.start = std::chrono::duration<double, std::micro>(start - epoch).count();
+    theEvent.duration = 1.0e6*wall;
+    theEvents.push_back(theEvent);
+  }
+}
+
+void
+PhaseProfiler::report(OPS_Stream &s)
+{
+  s << "Phase profile (inclusive times in seconds";
+  if (timingCPU == false)
+    s << ", no CPU times";
+  s << ")\n";
+
+  for (int i=0; i<PROFILE_NUM_PHASES; i++) {
+    const PhaseProfile &theProfile = theProfiles[i];
+    if (theProfile.count == 0)
+      continue;
+    s << "  " << phaseNames[i] << ": count " << theProfile.count;
+    s << " wall " << theProfile.wallTime;
+    if (timingCPU == true)
+      s << " cpu " << theProfile.cpuTime;
+    s << " avg " << theProfile.wallTime/theProfile.count << endln;
+  }
+
+  if (maxEvents > 0 && (int)theEvents.size() == maxEvents)
+    s << "  trace full at " << maxEvents << " events\n";
+}
+
+int
+PhaseProfiler::writeJSON(const char *fileName)
+{
+  std::ofstream theFile(fileName, std::ios::out);
+  if (!theFile.is_open()) {
+    opserr << "WARNING PhaseProfiler::writeJSON() - could not open file " << fileName << endln;
+    return -1;
+  }
+
+  theFile << std::setprecision(9);
+  theFile << "{\n  \"cpuTimes\": " << (timingCPU ? "true" : "false") << ",\n";
+  theFile << "  \"phases\": [";
+  for (int i=0; i<PROFILE_NUM_PHASES; i++) {
+    const PhaseProfile &theProfile = theProfiles[i];
+    theFile << (i == 0 ? "\n" : ",\n");
+    theFile << "    {\"name\": \"" << phaseNames[i] << "\", \"count\": " << theProfile.count;
+    theFile << ", \"wall\": " << theProfile.wallTime << ", \"cpu\": " << theProfile.cpuTime << "}";
+  }
+  theFile << "\n  ],\n  \"classes\": ";
+  ClassProfiler::writeJSON(theFile);
+  theFile << "\n}\n";
+  theFile.close();
+
+  return 0;
+}
+
+int
+PhaseProfiler::writeTrace(const char *fileName)
+{
+  std::ofstream theFile(fileName, std::ios::out);
+  if (!theFile.is_open()) {
+    opserr << "WARNING PhaseProfiler::writeTrace() - could not open file " << fileName << endln;
+    return -1;
+  }
+
+  if (maxEvents == 0)
+    opserr << "WARNING PhaseProfiler::writeTrace() - tracing is off, no events written\n";
+
+  // complete events, times in microseconds
+  theFile << std::fixed << std::setprecision(3);
+  theFile << "{\"traceEvents\": [";
+  for (size_t i=0; i<theEvents.size(); i++) {
+    const PhaseEvent &theEvent = theEvents[i];
+    theFile << (i == 0 ? "\n" : ",\n");
+    theFile << "{\"name\": \"" << phaseNames[theEvent.phase] << "\", \"ph\": \"X\", \"ts\": ";
+    theFile << theEvent.start << ", \"dur\": " << theEvent.duration << ", \"pid\": 0, \"tid\": 0}";
+  }
+  theFile << "\n], \"displayTimeUnit\": \"ms\"}\n";
+  theFile.close();
+
+  return 0;
+}
@@ -0,0 +1,115 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+#ifndef PhaseProfiler_h
+#define PhaseProfiler_h
+
+// Description: This file contains the class definition for PhaseProfiler.
+// PhaseProfiler accumulates the number of calls and the wall (and, if
+// asked for, CPU) time spent in each phase of the analysis loop. A phase
+// is timed by a PhaseTimer on the stack:
+//
+//    PhaseTimer theTimer(PROFILE_FORM_TANGENT);
+//
+// Profiling is on by default; when off a PhaseTimer costs a test of a
+// flag. Phases nest, e.g. factor and triSolve are part of linearSolve and
+// record is part of commit, so the times are inclusive. When tracing,
+// each timed phase is also kept as an event, up to a maximum number, for
+// output in the Chrome trace event format.
+
+#include <chrono>
+#include <ctime>
+
+class OPS_Stream;
+
+enum ProfilePhase {
+  PROFILE_NEW_STEP,
+  PROFILE_FORM_TANGENT,
+  PROFILE_FORM_UNBALANCE,
+  PROFILE_LINEAR_SOLVE,       // LinearSOE::solve()
+  PROFILE_FACTOR,             // solves factoring the matrix
+  PROFILE_TRI_SOLVE,          // solves using an existing factorization
+  PROFILE_UPDATE,             // AnalysisModel::updateDomain()
+  PROFILE_TEST,               // ConvergenceTest::test()
+  PROFILE_COMMIT,
+  PROFILE_RECORD,
+  PROFILE_NUM_PHASES
+};
+
+class PhaseProfiler
+{
+  public:
+    static void setEnabled(bool onOff, bool cpuTime = false);
+    static bool isEnabled(void) {return enabled;};
+    static bool isTimingCPU(void) {return timingCPU;};
+    static void setTrace(int maxEvents);      // 0 stops tracing
+    static void reset(void);
+
+    static const char *getName(int phase);
+    static int getCount(int phase);
+    static double getWallTime(int phase);
+    static double getCPUTime(int phase);
+
+    static void report(OPS_Stream &s);
+    static int writeJSON(const char *fileName);
+    static int writeTrace(const char *fileName);
+
+    // used by PhaseTimer
+    static void add(int phase, std::chrono::steady_clock::time_point start,
+		    std::chrono::steady_clock::time_point end, double cpu);
+
+  private:
+    static bool enabled;
+    static bool timingCPU;
+};
+
+class PhaseTimer
+{
+  public:
+    PhaseTimer(int phase)
+      :thePhase(phase), active(PhaseProfiler::isEnabled()), cpuStart(0)
+    {
+      if (active == true) {
+	if (PhaseProfiler::isTimingCPU() == true)
+	  cpuStart = std::clock();
+	start = std::chrono::steady_clock::now();
+      }
+    };
+
+    ~PhaseTimer()
+    {
+      if (active == true) {
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	double cpu = 0.0;
+	if (PhaseProfiler::isTimingCPU() == true)
+	  cpu = (double)(std::clock() - cpuStart)/CLOCKS_PER_SEC;
+	PhaseProfiler::add(thePhase, start, end, cpu);
+      }
+    };
+
+  private:
+    int thePhase;
+    bool active;
+    std::clock_t cpuStart;
+    std::chrono::steady_clock::time_point start;
+};
+
+#endif